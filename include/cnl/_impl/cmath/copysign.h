@@ -0,0 +1,42 @@
+
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_CMATH_COPYSIGN_H)
+#define CNL_IMPL_CMATH_COPYSIGN_H
+
+#include "../config.h"
+
+namespace cnl {
+    namespace _impl {
+        // constexpr equivalent of std::copysign which,
+        // where intrinsics are available, compiles to bitwise operations
+
+#if defined(CNL_GCC_INTRINSICS_ENABLED)
+        [[nodiscard]] constexpr auto copysign(float magnitude, float sign)
+        {
+            return __builtin_copysignf(magnitude, sign);
+        }
+
+        [[nodiscard]] constexpr auto copysign(double magnitude, double sign)
+        {
+            return __builtin_copysign(magnitude, sign);
+        }
+
+        [[nodiscard]] constexpr auto copysign(long double magnitude, long double sign)
+        {
+            return __builtin_copysignl(magnitude, sign);
+        }
+#else
+        template<typename T>
+        [[nodiscard]] constexpr auto copysign(T const& magnitude, T const& sign)
+        {
+            return (sign < T{}) ? -magnitude : magnitude;
+        }
+#endif
+    }
+}
+
+#endif  // CNL_IMPL_CMATH_COPYSIGN_H
@@ -0,0 +1,30 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_COLUMN_FILE_BLOCK_H)
+#define CNL_IMPL_COLUMN_FILE_BLOCK_H
+
+#include "type.h"
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief summary of consecutive elements of a column file
+    ///
+    /// A column of `count` elements with a block size of `block_size` has
+    /// `ceil(count / block_size)` blocks; the last may summarize fewer than `block_size` elements.
+    /// Blocks allow a reader to skip ranges of values which cannot satisfy a query.
+    ///
+    /// \sa cnl::column_reader::blocks
+    template<column_value T>
+    struct column_block {
+        /// least element of the block
+        T min;
+
+        /// greatest element of the block
+        T max;
+    };
+}
+
+#endif  // CNL_IMPL_COLUMN_FILE_BLOCK_H
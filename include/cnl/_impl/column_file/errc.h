@@ -0,0 +1,75 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_COLUMN_FILE_ERRC_H)
+#define CNL_IMPL_COLUMN_FILE_ERRC_H
+
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief errors reported by \ref cnl::column_reader and \ref cnl::column_writer in addition
+    /// to those of the operating system
+    enum class column_errc {
+        /// the file does not start with a column header
+        not_a_column_file = 1,
+
+        /// the file was written by an incompatible version of the format
+        unsupported_version,
+
+        /// the header describes a different element type than the reader's
+        type_mismatch,
+
+        /// the file is shorter than its header says
+        truncated,
+    };
+
+    namespace _impl {
+        class column_category : public std::error_category {
+        public:
+            [[nodiscard]] auto name() const noexcept -> char const* override
+            {
+                return "cnl::column";
+            }
+
+            [[nodiscard]] auto message(int condition) const -> std::string override
+            {
+                switch (static_cast<column_errc>(condition)) {
+                case column_errc::not_a_column_file:
+                    return "not a column file";
+                case column_errc::unsupported_version:
+                    return "unsupported column file version";
+                case column_errc::type_mismatch:
+                    return "column file element type does not match";
+                case column_errc::truncated:
+                    return "column file is truncated";
+                }
+                return "unknown column file error";
+            }
+        };
+    }
+
+    /// \brief the category of \ref cnl::column_errc values
+    [[nodiscard]] inline auto column_category() -> std::error_category const&
+    {
+        static auto const category = _impl::column_category{};
+        return category;
+    }
+
+    [[nodiscard]] inline auto make_error_code(column_errc e) -> std::error_code
+    {
+        return std::error_code{static_cast<int>(e), column_category()};
+    }
+}
+
+namespace std {
+    template<>
+    struct is_error_code_enum<cnl::column_errc> : true_type {
+    };
+}
+
+#endif  // CNL_IMPL_COLUMN_FILE_ERRC_H
@@ -0,0 +1,124 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_COLUMN_FILE_HEADER_H)
+#define CNL_IMPL_COLUMN_FILE_HEADER_H
+
+#include "../cstdint/types.h"
+#include "../serialize/serialize.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <system_error>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief the fields of the 64-byte header at the start of a column file
+    ///
+    /// Every field is written with \ref cnl::serialize in the order declared, followed by zeros up
+    /// to \ref column_header::size bytes. The fields up to and including `radix` describe the
+    /// element type and are compared against \ref cnl::column_header_of when a file is opened.
+    ///
+    /// \sa cnl::column_reader, cnl::column_writer
+    struct column_header {
+        /// bytes at the start of every column file
+        static constexpr std::array<char, 8> magic{'C', 'N', 'L', 'C', 'O', 'L', '\r', '\n'};
+
+        /// format version written by this version of CNL
+        static constexpr uint16 current_version = 1;
+
+        /// bytes occupied by the header; also the offset of the first element
+        static constexpr int size = 64;
+
+        uint16 version = current_version;
+
+        /// bytes occupied by each element, i.e. the size of its fundamental rep
+        uint8 rep_bytes = 0;
+
+        /// 1 if the element type is signed, otherwise 0
+        uint8 is_signed = 0;
+
+        /// \ref cnl::digits of the element type
+        uint16 digits = 0;
+
+        /// identifier of the rounding tag; see \ref cnl::column_header_of
+        uint8 rounding = 0;
+
+        /// identifier of the overflow tag; see \ref cnl::column_header_of
+        uint8 overflow = 0;
+
+        int32 exponent = 0;
+        int32 radix = 2;
+
+        /// number of elements summarized by each \ref cnl::column_block
+        uint32 block_size = 0;
+
+        /// number of elements in the column
+        uint64 count = 0;
+
+        /// offset in bytes of the first \ref cnl::column_block from the start of the file
+        uint64 blocks_offset = 0;
+
+        /// true iff both headers describe the same element type
+        [[nodiscard]] constexpr auto same_type(column_header const& other) const
+        {
+            return version == other.version && rep_bytes == other.rep_bytes
+                && is_signed == other.is_signed && digits == other.digits
+                && rounding == other.rounding && overflow == other.overflow
+                && exponent == other.exponent && radix == other.radix;
+        }
+    };
+
+    namespace _impl {
+        // applies Function to every field of header in file order until it returns false
+        template<typename Header, typename Function>
+        constexpr auto for_each_column_header_field(Header& header, Function&& function)
+        {
+            return function(header.version) && function(header.rep_bytes)
+                && function(header.is_signed) && function(header.digits)
+                && function(header.rounding) && function(header.overflow)
+                && function(header.exponent) && function(header.radix)
+                && function(header.block_size) && function(header.count)
+                && function(header.blocks_offset);
+        }
+
+        [[nodiscard]] constexpr auto write_column_header(column_header const& header)
+        {
+            auto bytes = std::array<std::byte, column_header::size>{};
+            std::transform(
+                    begin(column_header::magic), end(column_header::magic), begin(bytes),
+                    [](char c) { return static_cast<std::byte>(c); });
+            auto out = std::span(bytes).subspan(column_header::magic.size());
+            for_each_column_header_field(header, [&out](auto const& field) {
+                auto const result = cnl::serialize(out, field);
+                out = out.subspan(result.ptr - out.data());
+                return result.ec == std::errc{};
+            });
+            return bytes;
+        }
+
+        // returns false if bytes do not start with a column header
+        [[nodiscard]] constexpr auto read_column_header(
+                std::span<std::byte const> bytes, column_header& header)
+        {
+            if (bytes.size() < column_header::size
+                || !std::equal(
+                        begin(column_header::magic), end(column_header::magic), begin(bytes),
+                        [](char c, std::byte b) { return static_cast<std::byte>(c) == b; })) {
+                return false;
+            }
+            auto in = bytes.subspan(column_header::magic.size());
+            return for_each_column_header_field(header, [&in](auto& field) {
+                auto const result = cnl::deserialize(in, field);
+                in = in.subspan(result.ptr - in.data());
+                return result.ec == std::errc{};
+            });
+        }
+    }
+}
+
+#endif  // CNL_IMPL_COLUMN_FILE_HEADER_H
@@ -0,0 +1,204 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_COLUMN_FILE_READER_H)
+#define CNL_IMPL_COLUMN_FILE_READER_H
+
+#if __has_include(<sys/mman.h>)
+
+#include "../cstdint/types.h"
+#include "../wrapper/rep_span.h"
+#include "block.h"
+#include "errc.h"
+#include "header.h"
+#include "type.h"
+
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <span>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief maps a column file into memory and views its elements as `T`
+    ///
+    /// \tparam T type of the elements; must match the type with which the file was written
+    ///
+    /// Elements are not parsed or copied: \ref values views the mapped file directly. For this
+    /// reason, the reader is only available on little-endian platforms with `mmap`.
+    ///
+    /// Example:
+    /// \code
+    /// auto reader = cnl::column_reader<cnl::scaled_integer<cnl::int32, cnl::power<-16>>>{};
+    /// if (auto const ec = reader.open("samples.col")) { /* handle error */ }
+    /// auto const total = std::accumulate(begin(reader.values()), end(reader.values()), 0.);
+    /// \endcode
+    ///
+    /// \sa cnl::column_writer
+    template<column_value T>
+    class column_reader {
+        static_assert(
+                std::endian::native == std::endian::little,
+                "column files can only be mapped on little-endian platforms");
+        static_assert(sizeof(column_block<T>) == 2 * sizeof(T));
+
+        using rep = _impl::wire_integer_t<T>;
+
+    public:
+        column_reader() = default;
+
+        column_reader(column_reader const&) = delete;
+
+        column_reader(column_reader&& other) noexcept
+            : _mapping(std::exchange(other._mapping, nullptr))
+            , _mapping_size(std::exchange(other._mapping_size, 0))
+            , _header(other._header)
+        {
+        }
+
+        ~column_reader()
+        {
+            close();
+        }
+
+        auto operator=(column_reader const&) -> column_reader& = delete;
+
+        auto operator=(column_reader&& other) noexcept -> column_reader&
+        {
+            close();
+            _mapping = std::exchange(other._mapping, nullptr);
+            _mapping_size = std::exchange(other._mapping_size, 0);
+            _header = other._header;
+            return *this;
+        }
+
+        /// \brief maps the file at `path` and validates its header against \ref cnl::column_header_of
+        ///
+        /// \return an error from the operating system, a \ref cnl::column_errc or an empty error code
+        auto open(char const* path) -> std::error_code
+        {
+            close();
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+            auto const descriptor = ::open(path, O_RDONLY | O_CLOEXEC);
+            if (descriptor == -1) {
+                return std::error_code{errno, std::generic_category()};
+            }
+
+            struct stat status {
+            };
+            auto ec = std::error_code{};
+            if (::fstat(descriptor, &status) == -1) {
+                ec = std::error_code{errno, std::generic_category()};
+            } else if (status.st_size < column_header::size) {
+                ec = column_errc::not_a_column_file;
+            } else {
+                _mapping_size = static_cast<std::size_t>(status.st_size);
+                _mapping = ::mmap(nullptr, _mapping_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+                if (_mapping == MAP_FAILED) {
+                    _mapping = nullptr;
+                    ec = std::error_code{errno, std::generic_category()};
+                }
+            }
+            ::close(descriptor);
+
+            if (!ec) {
+                ec = validate();
+            }
+            if (ec) {
+                close();
+            }
+            return ec;
+        }
+
+        void close()
+        {
+            if (_mapping) {
+                ::munmap(std::exchange(_mapping, nullptr), std::exchange(_mapping_size, 0));
+            }
+            _header = column_header{};
+        }
+
+        [[nodiscard]] auto is_open() const
+        {
+            return _mapping != nullptr;
+        }
+
+        [[nodiscard]] auto header() const -> column_header const&
+        {
+            return _header;
+        }
+
+        /// the elements of the column
+        [[nodiscard]] auto values() const -> std::span<T const>
+        {
+            return from_rep_span<T>(std::span(
+                    reinterpret_cast<rep const*>(bytes().data() + column_header::size),
+                    _header.count));
+        }
+
+        /// summaries of consecutive elements of the column; see \ref cnl::column_block
+        [[nodiscard]] auto blocks() const -> std::span<column_block<T> const>
+        {
+            return std::span(
+                    reinterpret_cast<column_block<T> const*>(bytes().data() + _header.blocks_offset),
+                    num_blocks());
+        }
+
+    private:
+        [[nodiscard]] auto bytes() const -> std::span<std::byte const>
+        {
+            return std::span(static_cast<std::byte const*>(_mapping), _mapping_size);
+        }
+
+        [[nodiscard]] auto num_blocks() const -> std::size_t
+        {
+            return _header.block_size ? (_header.count + _header.block_size - 1) / _header.block_size
+                                      : 0;
+        }
+
+        auto validate() -> std::error_code
+        {
+            if (!_impl::read_column_header(bytes(), _header)) {
+                return column_errc::not_a_column_file;
+            }
+            if (_header.version != column_header::current_version) {
+                return column_errc::unsupported_version;
+            }
+            if (!_header.same_type(column_header_of<T>)) {
+                return column_errc::type_mismatch;
+            }
+            if (_header.count && !_header.block_size) {
+                return column_errc::not_a_column_file;
+            }
+
+            auto const size = bytes().size();
+            auto const max_count = (size - column_header::size) / sizeof(rep);
+            if (_header.count > max_count
+                || _header.blocks_offset < column_header::size + _header.count * sizeof(rep)
+                || _header.blocks_offset % alignof(column_block<T>) != 0
+                || _header.blocks_offset > size
+                || (size - _header.blocks_offset) / sizeof(column_block<T>) < num_blocks()) {
+                return column_errc::truncated;
+            }
+            return std::error_code{};
+        }
+
+        void* _mapping = nullptr;
+        std::size_t _mapping_size = 0;
+        column_header _header;
+    };
+}
+
+#endif  // __has_include(<sys/mman.h>)
+
+#endif  // CNL_IMPL_COLUMN_FILE_READER_H
@@ -0,0 +1,141 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_COLUMN_FILE_TYPE_H)
+#define CNL_IMPL_COLUMN_FILE_TYPE_H
+
+#include "../elastic_tag/declaration.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/rep_of.h"
+#include "../num_traits/tag_of.h"
+#include "../numbers/signedness.h"
+#include "../overflow/is_overflow_tag.h"
+#include "../overflow/native.h"
+#include "../overflow/saturated.h"
+#include "../overflow/throwing.h"
+#include "../overflow/trapping.h"
+#include "../overflow/undefined.h"
+#include "../rounding/is_rounding_tag.h"
+#include "../rounding/native_rounding_tag.h"
+#include "../rounding/nearest_rounding_tag.h"
+#include "../rounding/neg_inf_rounding_tag.h"
+#include "../rounding/stochastic_rounding_tag.h"
+#include "../rounding/tie_to_even_rounding_tag.h"
+#include "../rounding/tie_to_pos_inf_rounding_tag.h"
+#include "../scaled/is_scaled_tag.h"
+#include "../serialize/serialize.h"
+#include "../type_traits/is_integral.h"
+#include "../wrapper/is_wrapper.h"
+#include "../wrapper/rep_span.h"
+#include "header.h"
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // identifiers of tags in column_header; never change existing values
+        template<typename Tag>
+        inline constexpr int column_rounding_id = -1;
+        template<>
+        inline constexpr int column_rounding_id<native_rounding_tag> = 0;
+        template<>
+        inline constexpr int column_rounding_id<nearest_rounding_tag> = 1;
+        template<>
+        inline constexpr int column_rounding_id<tie_to_pos_inf_rounding_tag> = 2;
+        template<>
+        inline constexpr int column_rounding_id<neg_inf_rounding_tag> = 3;
+        template<>
+        inline constexpr int column_rounding_id<tie_to_even_rounding_tag> = 4;
+        template<>
+        inline constexpr int column_rounding_id<stochastic_rounding_tag> = 5;
+
+        template<typename Tag>
+        inline constexpr int column_overflow_id = -1;
+        template<>
+        inline constexpr int column_overflow_id<native_overflow_tag> = 0;
+        template<>
+        inline constexpr int column_overflow_id<undefined_overflow_tag> = 1;
+        template<>
+        inline constexpr int column_overflow_id<saturated_overflow_tag> = 2;
+        template<>
+        inline constexpr int column_overflow_id<trapping_overflow_tag> = 3;
+        template<>
+        inline constexpr int column_overflow_id<throwing_overflow_tag> = 4;
+
+        template<typename Tag>
+        inline constexpr bool is_elastic_tag = false;
+
+        template<int Digits, typename Narrowest>
+        inline constexpr bool is_elastic_tag<elastic_tag<Digits, Narrowest>> = true;
+
+        // fills in the tag fields of header from the layers of T;
+        // returns false if a layer cannot be described
+        template<typename T>
+        constexpr auto describe_column_layers(column_header& header) -> bool
+        {
+            if constexpr (!is_wrapper<T>) {
+                return integral<T>;
+            } else {
+                using tag = tag_of_t<T>;
+                if constexpr (scaled_tag<tag>) {
+                    // only one scaled_integer layer is supported
+                    if (header.exponent != 0 || header.radix != 2) {
+                        return false;
+                    }
+                    header.exponent = tag::exponent;
+                    header.radix = tag::radix;
+                } else if constexpr (rounding_tag<tag>) {
+                    if constexpr (column_rounding_id<tag> < 0) {
+                        return false;
+                    } else {
+                        header.rounding = column_rounding_id<tag>;
+                    }
+                } else if constexpr (overflow_tag<tag>) {
+                    if constexpr (column_overflow_id<tag> < 0) {
+                        return false;
+                    } else {
+                        header.overflow = column_overflow_id<tag>;
+                    }
+                } else if constexpr (!is_elastic_tag<tag>) {
+                    return false;
+                }
+                return describe_column_layers<rep_of_t<T>>(header);
+            }
+        }
+
+        template<typename T>
+        [[nodiscard]] constexpr auto describe_column() -> column_header
+        {
+            auto header = column_header{};
+            header.rep_bytes = sizeof(wire_integer_t<T>);
+            header.is_signed = numbers::signedness_v<T>;
+            header.digits = digits<T>;
+            header.rounding = column_rounding_id<native_rounding_tag>;
+            header.overflow = column_overflow_id<native_overflow_tag>;
+            if (!describe_column_layers<T>(header)) {
+                header.version = 0;
+            }
+            return header;
+        }
+    }
+
+    /// \brief numbers which can be stored in a column file: integers and compositions of
+    /// \ref cnl::scaled_integer, \ref cnl::elastic_integer, \ref cnl::rounding_integer and
+    /// \ref cnl::overflow_integer around them
+    template<typename T>
+    concept column_value = _impl::serializable_number<T> && _impl::integral<_impl::wire_integer_t<T>>
+                        && _impl::rep_layout_of<T, _impl::wire_integer_t<T>>
+                        && _impl::describe_column<T>().version == column_header::current_version;
+
+    /// \brief the header fields which describe `T`, determined at compile time
+    ///
+    /// \ref cnl::column_reader compares these fields with the header of the file it opens.
+    /// Rounding tags are identified as: native 0, nearest 1, tie_to_pos_inf 2, neg_inf 3,
+    /// tie_to_even 4 and stochastic 5. Overflow tags are identified as: native 0, undefined 1,
+    /// saturated 2, trapping 3 and throwing 4.
+    template<column_value T>
+    inline constexpr column_header column_header_of = _impl::describe_column<T>();
+}
+
+#endif  // CNL_IMPL_COLUMN_FILE_TYPE_H
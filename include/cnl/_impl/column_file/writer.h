@@ -0,0 +1,224 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_COLUMN_FILE_WRITER_H)
+#define CNL_IMPL_COLUMN_FILE_WRITER_H
+
+#include "../cnl_assert.h"
+#include "../cstdint/types.h"
+#include "../num_traits/unwrap.h"
+#include "../serialize/bulk.h"
+#include "block.h"
+#include "header.h"
+#include "type.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <span>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief writes a column file one element at a time
+    ///
+    /// \tparam T type of the elements
+    ///
+    /// Elements are buffered and written a block at a time. The header and the block summaries are
+    /// written by \ref close. Errors are sticky: once an operation fails, subsequent operations do
+    /// nothing and \ref close returns the first error.
+    ///
+    /// Example:
+    /// \code
+    /// auto writer = cnl::column_writer<cnl::scaled_integer<cnl::int32, cnl::power<-16>>>{};
+    /// if (auto const ec = writer.open("samples.col")) { /* handle error */ }
+    /// for (auto sample : samples) { writer.push_back(sample); }
+    /// if (auto const ec = writer.close()) { /* handle error */ }
+    /// \endcode
+    ///
+    /// \sa cnl::column_reader
+    template<column_value T>
+    class column_writer {
+        static_assert(sizeof(column_block<T>) == 2 * sizeof(T));
+
+    public:
+        /// number of elements summarized by each block unless specified otherwise
+        static constexpr uint32 default_block_size = 4096;
+
+        column_writer() = default;
+
+        column_writer(column_writer const&) = delete;
+
+        column_writer(column_writer&& other) noexcept
+            : _file(std::exchange(other._file, nullptr))
+            , _error(other._error)
+            , _header(other._header)
+            , _pending(std::move(other._pending))
+            , _blocks(std::move(other._blocks))
+        {
+        }
+
+        ~column_writer()
+        {
+            [[maybe_unused]] auto const ec = close();
+        }
+
+        auto operator=(column_writer const&) -> column_writer& = delete;
+
+        auto operator=(column_writer&& other) noexcept -> column_writer&
+        {
+            [[maybe_unused]] auto const ec = close();
+            _file = std::exchange(other._file, nullptr);
+            _error = other._error;
+            _header = other._header;
+            _pending = std::move(other._pending);
+            _blocks = std::move(other._blocks);
+            return *this;
+        }
+
+        /// \brief creates or truncates the file at `path` for writing
+        ///
+        /// \param path location of the file
+        /// \param block_size number of elements summarized by each \ref cnl::column_block
+        auto open(char const* path, uint32 block_size = default_block_size) -> std::error_code
+        {
+            CNL_ASSERT(block_size > 0);
+            [[maybe_unused]] auto const ec = close();
+            _error = std::error_code{};
+            _header = column_header_of<T>;
+            _header.block_size = block_size;
+            _pending.clear();
+            _pending.reserve(block_size);
+            _blocks.clear();
+
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+            _file = std::fopen(path, "wb");
+            if (!_file) {
+                return _error = std::error_code{errno, std::generic_category()};
+            }
+            write_header();
+            return _error;
+        }
+
+        [[nodiscard]] auto is_open() const
+        {
+            return _file != nullptr;
+        }
+
+        /// number of elements written so far
+        [[nodiscard]] auto size() const -> uint64
+        {
+            return _header.count;
+        }
+
+        void push_back(T const& value)
+        {
+            CNL_ASSERT(is_open());
+            _pending.push_back(value);
+            ++_header.count;
+            if (_pending.size() == _header.block_size) {
+                flush();
+            }
+        }
+
+        void append(std::span<T const> values)
+        {
+            for (auto const& value : values) {
+                push_back(value);
+            }
+        }
+
+        /// \brief writes any buffered elements, the block summaries and the header, then closes
+        /// the file
+        ///
+        /// \return the first error encountered since \ref open or an empty error code
+        auto close() -> std::error_code
+        {
+            if (!_file) {
+                return _error;
+            }
+            flush();
+
+            auto const data_end = column_header::size + _header.count * _header.rep_bytes;
+            _header.blocks_offset = (data_end + column_header::size - 1) / column_header::size
+                                  * column_header::size;
+            write_padding(_header.blocks_offset - data_end);
+            auto bounds = std::vector<T>{};
+            bounds.reserve(_blocks.size() * 2);
+            for (auto const& block : _blocks) {
+                bounds.push_back(block.min);
+                bounds.push_back(block.max);
+            }
+            write(bounds);
+
+            if (!_error && std::fseek(_file, 0, SEEK_SET) != 0) {
+                _error = std::error_code{errno, std::generic_category()};
+            }
+            write_header();
+
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+            if (std::fclose(std::exchange(_file, nullptr)) != 0 && !_error) {
+                _error = std::error_code{errno, std::generic_category()};
+            }
+            return _error;
+        }
+
+    private:
+        void flush()
+        {
+            if (_pending.empty()) {
+                return;
+            }
+            auto const [min, max] = std::minmax_element(begin(_pending), end(_pending));
+            _blocks.push_back(column_block<T>{*min, *max});
+            write(_pending);
+            _pending.clear();
+        }
+
+        // writes the fundamental reps of values, which is the layout that column_reader maps
+        void write(std::span<T const> values)
+        {
+            using rep = _impl::wire_integer_t<T>;
+            auto reps = std::vector<rep>(values.size());
+            std::transform(begin(values), end(values), begin(reps), [](T const& value) {
+                return cnl::unwrap(value);
+            });
+
+            auto bytes = std::vector<std::byte>(reps.size() * sizeof(rep));
+            [[maybe_unused]] auto const result = cnl::serialize(bytes, reps);
+            CNL_ASSERT(result.ec == std::errc{});
+            write_bytes(bytes);
+        }
+
+        void write_header()
+        {
+            auto const bytes = _impl::write_column_header(_header);
+            write_bytes(bytes);
+        }
+
+        void write_padding(std::size_t size)
+        {
+            write_bytes(std::vector<std::byte>(size));
+        }
+
+        void write_bytes(std::span<std::byte const> bytes)
+        {
+            if (!_error && std::fwrite(bytes.data(), 1, bytes.size(), _file) != bytes.size()) {
+                _error = std::error_code{errno, std::generic_category()};
+            }
+        }
+
+        std::FILE* _file = nullptr;
+        std::error_code _error;
+        column_header _header;
+        std::vector<T> _pending;
+        std::vector<column_block<T>> _blocks;
+    };
+}
+
+#endif  // CNL_IMPL_COLUMN_FILE_WRITER_H
@@ -0,0 +1,40 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_COMPLEX_DEFINITION_H)
+#define CNL_IMPL_COMPLEX_DEFINITION_H
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief complex number represented as the sum, \ref real `+` \ref imag `i`
+    ///
+    /// \tparam T the type of the real and imaginary parts, e.g. \ref cnl::scaled_integer or
+    /// \ref cnl::elastic_scaled_integer
+    ///
+    /// Unlike `std::complex`, any numeric type can be used. Arithmetic is performed with the
+    /// operators of `T`. Thus, the product of two `complex<elastic_scaled_integer<15, -15>>` is a
+    /// `complex<elastic_scaled_integer<31, -30>>`.
+    ///
+    /// Example:
+    /// \snippet complex.cpp complex example
+    ///
+    /// \sa cnl::complex_span
+    template<typename T>
+    struct complex {
+        /// alias to `T`
+        using value_type = T;
+
+        /// the real part
+        T real;  // NOLINT(misc-non-private-member-variables-in-classes)
+
+        /// the imaginary part
+        T imag;  // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    template<typename T>
+    complex(T, T) -> complex<T>;
+}
+
+#endif  // CNL_IMPL_COMPLEX_DEFINITION_H
@@ -0,0 +1,142 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_COMPLEX_KERNELS_H)
+#define CNL_IMPL_COMPLEX_KERNELS_H
+
+#include "../cnl_assert.h"
+#include "../linalg/dot.h"
+#include "../num_traits/unwrap.h"
+#include "../num_traits/wrap.h"
+#include "span.h"
+
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief type of the parts of the exact product of a `complex<A>` and a `complex<B>`
+    ///
+    /// Each part is the sum of two products, e.g. `a.real * b.real - a.imag * b.imag`, and so
+    /// this is \ref cnl::dot_result_t of two terms. It is one digit wider than the result of
+    /// elastic multiplication because the sum of the products of two most negative values is
+    /// also held.
+    template<_impl::linalg_operand A, _impl::linalg_operand B>
+    using complex_product_t = dot_result_t<A, B, 2>;
+
+    /// \brief type of the exact squared magnitude of a `complex<T>`
+    template<_impl::linalg_operand T>
+    using complex_norm_t = dot_result_t<T, T, 2>;
+
+    namespace _impl {
+        template<typename T>
+        concept complex_operand = linalg_operand<std::remove_cv_t<T>>;
+
+        // writes a[i] * b[i], or a[i] * conj(b[i]) if Conjugate, to out[i]
+        template<bool Conjugate, typename A, typename B, typename Out>
+        constexpr void complex_multiply(complex_span<A> a, complex_span<B> b, complex_span<Out> out)
+        {
+            using element_a = std::remove_cv_t<A>;
+            using element_b = std::remove_cv_t<B>;
+            using result = complex_product_t<element_a, element_b>;
+            using product_rep = linalg_product_rep_t<element_a, element_b>;
+            using sum_rep = linalg_rep_t<result>;
+
+            auto const size = a.size();
+            CNL_ASSERT(b.size() == size);
+            CNL_ASSERT(out.size() == size);
+
+            // each product is formed in the narrowest integer which holds it and only then
+            // widened, as by cnl::dot
+            auto const multiply = [](auto const& lhs, auto const& rhs) {
+                return static_cast<sum_rep>(static_cast<product_rep>(
+                        static_cast<product_rep>(cnl::unwrap(lhs)) * static_cast<product_rep>(cnl::unwrap(rhs))));
+            };
+            for (auto index = std::size_t{0}; index != size; ++index) {
+                auto const rr = multiply(a.real[index], b.real[index]);
+                auto const ii = multiply(a.imag[index], b.imag[index]);
+                auto const ri = multiply(a.real[index], b.imag[index]);
+                auto const ir = multiply(a.imag[index], b.real[index]);
+                auto const real = static_cast<sum_rep>(Conjugate ? rr + ii : rr - ii);
+                auto const imag = static_cast<sum_rep>(Conjugate ? ir - ri : ri + ir);
+                out.real[index] = static_cast<Out>(cnl::wrap<result>(real));
+                out.imag[index] = static_cast<Out>(cnl::wrap<result>(imag));
+            }
+        }
+    }
+
+    /// \brief multiplies two sequences of complex numbers, element by element
+    ///
+    /// \param a,b the sequences of complex numbers to multiply
+    /// \param out sequence to which the products are written; may be the same as `a` or `b`
+    ///
+    /// Each product is calculated exactly as a `complex<complex_product_t<A, B>>` and then each
+    /// part is converted to `Out` with `static_cast`. Thus, the product is requantized by the
+    /// rounding and overflow tags of `Out`, e.g. `scaled_integer<rounding_integer<int16>,
+    /// power<-15>>` rounds to nearest. The parts are multiplied in the narrowest integers which
+    /// hold their products, e.g. 16-bit parts are multiplied in 32-bit lanes.
+    ///
+    /// Example:
+    /// \snippet complex.cpp complex_span example
+    ///
+    /// \sa cnl::complex_multiply_conj, cnl::complex_norm
+    template<_impl::complex_operand A, _impl::complex_operand B, typename Out>
+    constexpr void complex_multiply(complex_span<A> a, complex_span<B> b, complex_span<Out> out)
+    {
+        _impl::complex_multiply<false>(a, b, out);
+    }
+
+    /// \brief multiplies a sequence of complex numbers by the complex conjugates of another,
+    /// element by element
+    ///
+    /// \param a the sequence of complex numbers to multiply
+    /// \param b the sequence of complex numbers whose conjugates multiply `a`
+    /// \param out sequence to which the products are written; may be the same as `a` or `b`
+    ///
+    /// The products are calculated and converted as by \ref cnl::complex_multiply. This is the
+    /// operation of correlation, e.g. of a received signal with a known sequence.
+    ///
+    /// \sa cnl::complex_multiply, cnl::conj
+    template<_impl::complex_operand A, _impl::complex_operand B, typename Out>
+    constexpr void complex_multiply_conj(complex_span<A> a, complex_span<B> b, complex_span<Out> out)
+    {
+        _impl::complex_multiply<true>(a, b, out);
+    }
+
+    /// \brief calculates the squared magnitudes of a sequence of complex numbers
+    ///
+    /// \param a the sequence of complex numbers
+    /// \param out contiguous range of numbers to which the squared magnitudes are written
+    ///
+    /// Each squared magnitude is calculated exactly as a \ref cnl::complex_norm_t and then
+    /// converted to the element type of `out` with `static_cast`.
+    ///
+    /// \sa cnl::complex_multiply, cnl::norm
+    template<_impl::complex_operand A, std::ranges::contiguous_range Output>
+    constexpr void complex_norm(complex_span<A> a, Output&& out)
+    {
+        using element = std::remove_cv_t<A>;
+        using element_out = std::ranges::range_value_t<Output>;
+        using result = complex_norm_t<element>;
+        using product_rep = _impl::linalg_product_rep_t<element, element>;
+        using sum_rep = _impl::linalg_rep_t<result>;
+
+        auto const size = a.size();
+        auto* const data_out = std::ranges::data(out);
+        CNL_ASSERT(std::ranges::size(out) == size);
+
+        auto const square = [](auto const& part) {
+            auto const rep = static_cast<product_rep>(cnl::unwrap(part));
+            return static_cast<sum_rep>(static_cast<product_rep>(rep * rep));
+        };
+        for (auto index = std::size_t{0}; index != size; ++index) {
+            auto const sum = static_cast<sum_rep>(square(a.real[index]) + square(a.imag[index]));
+            data_out[index] = static_cast<element_out>(cnl::wrap<result>(sum));
+        }
+    }
+}
+
+#endif  // CNL_IMPL_COMPLEX_KERNELS_H
@@ -0,0 +1,81 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_COMPLEX_OPERATORS_H)
+#define CNL_IMPL_COMPLEX_OPERATORS_H
+
+#include "definition.h"
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // a complex number whose parts are the given expressions, converted to the type of the
+        // first; the expressions differ in type only where the second is unsigned and the first,
+        // a difference, is signed
+        template<typename Real, typename Imag>
+        [[nodiscard]] constexpr auto make_complex(Real const& real, Imag const& imag)
+        {
+            return complex<Real>{real, static_cast<Real>(imag)};
+        }
+    }
+
+    // cnl::complex arithmetic
+    template<typename Rhs>
+    [[nodiscard]] constexpr auto operator+(complex<Rhs> const& rhs)
+    {
+        return _impl::make_complex(+rhs.real, +rhs.imag);
+    }
+
+    template<typename Rhs>
+    [[nodiscard]] constexpr auto operator-(complex<Rhs> const& rhs)
+    {
+        return _impl::make_complex(-rhs.real, -rhs.imag);
+    }
+
+    template<typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr auto operator+(complex<Lhs> const& lhs, complex<Rhs> const& rhs)
+    {
+        return _impl::make_complex(lhs.real + rhs.real, lhs.imag + rhs.imag);
+    }
+
+    template<typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr auto operator-(complex<Lhs> const& lhs, complex<Rhs> const& rhs)
+    {
+        return _impl::make_complex(lhs.real - rhs.real, lhs.imag - rhs.imag);
+    }
+
+    template<typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr auto operator*(complex<Lhs> const& lhs, complex<Rhs> const& rhs)
+    {
+        return _impl::make_complex(
+                lhs.real * rhs.real - lhs.imag * rhs.imag, lhs.real * rhs.imag + lhs.imag * rhs.real);
+    }
+
+    // cnl::complex comparison
+    template<typename Lhs, typename Rhs>
+    [[nodiscard]] constexpr auto operator==(complex<Lhs> const& lhs, complex<Rhs> const& rhs)
+    {
+        return lhs.real == rhs.real && lhs.imag == rhs.imag;
+    }
+
+    /// \brief complex conjugate of a \ref cnl::complex
+    template<typename T>
+    [[nodiscard]] constexpr auto conj(complex<T> const& c)
+    {
+        using result = decltype(-c.imag);
+        return complex<result>{static_cast<result>(c.real), -c.imag};
+    }
+
+    /// \brief squared magnitude of a \ref cnl::complex, `c.real * c.real + c.imag * c.imag`
+    ///
+    /// \note As with `std::norm`, this is not the Euclidean norm.
+    template<typename T>
+    [[nodiscard]] constexpr auto norm(complex<T> const& c)
+    {
+        return c.real * c.real + c.imag * c.imag;
+    }
+}
+
+#endif  // CNL_IMPL_COMPLEX_OPERATORS_H
@@ -0,0 +1,62 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_COMPLEX_SPAN_H)
+#define CNL_IMPL_COMPLEX_SPAN_H
+
+#include "../cnl_assert.h"
+#include "definition.h"
+
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief view of a sequence of complex numbers stored as separate arrays of their real and
+    /// imaginary parts
+    ///
+    /// \tparam T the type of the real and imaginary parts, optionally `const`
+    ///
+    /// Storing the parts of a sequence separately, as a structure of arrays, lets the kernels which
+    /// operate on it, such as \ref cnl::complex_multiply, load and store whole SIMD registers of
+    /// real or imaginary parts.
+    ///
+    /// Example:
+    /// \snippet complex.cpp complex_span example
+    ///
+    /// \sa cnl::complex
+    template<typename T>
+    struct complex_span {
+        /// alias to `T` without `const`
+        using value_type = std::remove_cv_t<T>;
+
+        /// the number of elements in the sequence
+        [[nodiscard]] constexpr auto size() const
+        {
+            CNL_ASSERT(real.size() == imag.size());
+            return real.size();
+        }
+
+        /// a copy of the element at the given position
+        [[nodiscard]] constexpr auto operator[](std::size_t index) const
+        {
+            return complex<value_type>{real[index], imag[index]};
+        }
+
+        /// the real parts
+        std::span<T> real;  // NOLINT(misc-non-private-member-variables-in-classes)
+
+        /// the imaginary parts
+        std::span<T> imag;  // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    template<std::ranges::contiguous_range Real, std::ranges::contiguous_range Imag>
+    complex_span(Real&&, Imag&&)
+            -> complex_span<std::remove_reference_t<std::ranges::range_reference_t<Real>>>;
+}
+
+#endif  // CNL_IMPL_COMPLEX_SPAN_H
@@ -0,0 +1,156 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_COMPRESSED_KERNELS_H)
+#define CNL_IMPL_COMPRESSED_KERNELS_H
+
+#include "../cstdint/types.h"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // layout of a compressed block
+
+        // A block of offsets is stored in compressed_lanes interleaved streams of words.
+        // Offset i belongs to lane i % compressed_lanes and is row i / compressed_lanes of that lane.
+        // Word w of a lane is stored at index w * compressed_lanes + lane. Thus, the same shifts
+        // extract the offsets of every lane in a row and four words - one SIMD register - are
+        // decoded by each instruction.
+
+        using compressed_word = uint32;
+
+        inline constexpr auto compressed_word_width = 32;
+
+        inline constexpr auto compressed_lanes = std::size_t{4};
+
+        // rows in each lane; a lane of offsets of width W then occupies W words exactly
+        inline constexpr auto compressed_rows = std::size_t{compressed_word_width};
+
+        inline constexpr auto compressed_block_size = compressed_lanes * compressed_rows;
+
+        // words which store a block of offsets of the given width, which is at most 32
+        [[nodiscard]] constexpr auto compressed_num_words(int width)
+        {
+            return compressed_lanes * static_cast<std::size_t>(width);
+        }
+
+        template<int Width>
+        inline constexpr auto compressed_mask =
+                (Width == compressed_word_width) ? ~compressed_word{0}
+                                                 : (compressed_word{1} << (Width % compressed_word_width)) - 1;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // runtime-width access to individual offsets
+
+        [[nodiscard]] constexpr auto compressed_read_offset(
+                compressed_word const* words, int width, std::size_t index) -> compressed_word
+        {
+            if (width == 0) {
+                return 0;
+            }
+            auto const lane = index % compressed_lanes;
+            auto const offset = index / compressed_lanes * width;
+            auto const word = offset / compressed_word_width;
+            auto const shift = static_cast<int>(offset % compressed_word_width);
+
+            auto bits = words[word * compressed_lanes + lane] >> shift;
+            if (shift + width > compressed_word_width) {
+                bits |= words[(word + 1) * compressed_lanes + lane] << (compressed_word_width - shift);
+            }
+            return (width == compressed_word_width) ? bits : bits & ((compressed_word{1} << width) - 1);
+        }
+
+        // sets the bits of an offset whose bits are all zero
+        constexpr void compressed_or_offset(
+                compressed_word* words, int width, std::size_t index, compressed_word bits)
+        {
+            if (width == 0) {
+                return;
+            }
+            auto const lane = index % compressed_lanes;
+            auto const offset = index / compressed_lanes * width;
+            auto const word = offset / compressed_word_width;
+            auto const shift = static_cast<int>(offset % compressed_word_width);
+
+            words[word * compressed_lanes + lane] |= bits << shift;
+            if (shift + width > compressed_word_width) {
+                words[(word + 1) * compressed_lanes + lane] |= bits >> (compressed_word_width - shift);
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // compile-time-width decoding of whole blocks
+
+        // Every shift below is a constant and every lane of a row is treated identically,
+        // so compilers emit straight-line vector shifts, masks and adds.
+
+        template<int Width, std::size_t Row, typename Rep>
+        constexpr void compressed_unpack_row(
+                compressed_word const* words, std::make_unsigned_t<Rep> reference, Rep* out)
+        {
+            constexpr auto offset = Row * Width;
+            constexpr auto word = offset / compressed_word_width;
+            constexpr auto shift = static_cast<int>(offset % compressed_word_width);
+
+            // all lanes are read before any are written so that no aliasing check is needed
+            auto bits = std::array<compressed_word, compressed_lanes>{};
+            if constexpr (Width != 0) {
+                for (auto lane = std::size_t{0}; lane != compressed_lanes; ++lane) {
+                    bits[lane] = words[word * compressed_lanes + lane] >> shift;
+                    if constexpr (shift + Width > compressed_word_width) {
+                        bits[lane] |= words[(word + 1) * compressed_lanes + lane]
+                                   << (compressed_word_width - shift);
+                    }
+                    bits[lane] &= compressed_mask<Width>;
+                }
+            }
+            for (auto lane = std::size_t{0}; lane != compressed_lanes; ++lane) {
+                out[lane] = static_cast<Rep>(
+                        static_cast<std::make_unsigned_t<Rep>>(reference + bits[lane]));
+            }
+        }
+
+        template<int Width, typename Rep, std::size_t... Rows>
+        constexpr void compressed_unpack_rows(
+                compressed_word const* words, std::make_unsigned_t<Rep> reference, Rep* out,
+                std::index_sequence<Rows...>)
+        {
+            (compressed_unpack_row<Width, Rows>(words, reference, out + Rows * compressed_lanes), ...);
+        }
+
+        // decodes a block of offsets of width Width and adds them to reference
+        template<int Width, typename Rep>
+        void compressed_unpack_block(
+                compressed_word const* words, std::make_unsigned_t<Rep> reference, Rep* out)
+        {
+            compressed_unpack_rows<Width>(
+                    words, reference, out, std::make_index_sequence<compressed_rows>{});
+        }
+
+        template<typename Rep>
+        using compressed_unpack_function = void (*)(
+                compressed_word const*, std::make_unsigned_t<Rep>, Rep*);
+
+        template<typename Rep, int... Widths>
+        constexpr auto make_compressed_unpack_table(std::integer_sequence<int, Widths...>)
+        {
+            return std::array<compressed_unpack_function<Rep>, sizeof...(Widths)>{
+                    &compressed_unpack_block<Widths, Rep>...};
+        }
+
+        // decoder of blocks of each width from 0 to 32
+        template<typename Rep>
+        inline constexpr auto compressed_unpack_table = make_compressed_unpack_table<Rep>(
+                std::make_integer_sequence<int, compressed_word_width + 1>{});
+    }
+}
+
+#endif  // CNL_IMPL_COMPRESSED_KERNELS_H
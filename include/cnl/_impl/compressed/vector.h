@@ -0,0 +1,276 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_COMPRESSED_VECTOR_H)
+#define CNL_IMPL_COMPRESSED_VECTOR_H
+
+#include "../../numeric.h"
+#include "../cnl_assert.h"
+#include "../cstdint/types.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/wrap.h"
+#include "../packed/bits.h"
+#include "../wrapper/rep_span.h"
+#include "kernels.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // types whose values can be stored as offsets from a frame of reference
+        template<typename T>
+        concept compressible = std::is_integral_v<packed_rep_t<T>>
+                            && !std::is_same_v<packed_rep_t<T>, bool>
+                            && sizeof(packed_rep_t<T>) <= sizeof(uint64);
+
+        // the frame of reference of a block and the location and width of its offsets;
+        // offsets wider than 32 bits are stored as a stream of the lower 32 bits
+        // followed by a stream of the remaining upper bits
+        template<typename Rep>
+        struct compressed_frame {
+            std::make_unsigned_t<Rep> reference;
+            std::size_t first_word;
+            int width;
+        };
+    }
+
+    /// \brief immutable array of numbers compressed as blocks of bit-packed offsets from a frame of
+    /// reference
+    ///
+    /// \tparam T the element type, e.g. \ref cnl::scaled_integer or \ref cnl::elastic_integer
+    ///
+    /// Elements are divided into blocks of \ref block_size. Each block stores its least element
+    /// and, for every element, the difference from it in as many bits as \ref cnl::used_digits
+    /// finds in the greatest difference. Signals which change slowly compared to their range
+    /// therefore occupy a fraction of the space of their reps. Blocks are decoded whole with
+    /// \ref decompress_block or \ref cnl::decompress and individual elements with `operator[]`.
+    ///
+    /// Example:
+    /// \code
+    /// auto const compressed = cnl::compressed_vector<cnl::scaled_integer<cnl::int32, cnl::power<-16>>>{samples};
+    /// auto block = std::array<cnl::scaled_integer<cnl::int32, cnl::power<-16>>, compressed.block_size>{};
+    /// compressed.decompress_block(0, block);
+    /// \endcode
+    ///
+    /// \sa cnl::packed_vector
+    template<_impl::compressible T>
+    class compressed_vector {
+        using rep = _impl::packed_rep_t<T>;
+        using unsigned_rep = std::make_unsigned_t<rep>;
+        using frame = _impl::compressed_frame<rep>;
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+
+        /// number of elements in every block but the last
+        static constexpr size_type block_size = _impl::compressed_block_size;
+
+        compressed_vector() = default;
+
+        /// \brief compresses a contiguous range of `T`, or of the integer which \ref cnl::unwrap
+        /// returns from `T`
+        template<std::ranges::contiguous_range In>
+        requires _impl::packed_value<std::ranges::range_value_t<In>, T>
+        explicit compressed_vector(In const& values)
+            : _size(std::ranges::size(values))
+        {
+            _frames.reserve(num_blocks());
+            auto block = std::array<rep, block_size>{};
+            auto const* first = std::ranges::data(values);
+            for (auto index = size_type{0}; index < _size; index += block_size) {
+                auto const length = std::min(block_size, _size - index);
+                std::transform(
+                        first + index, first + index + length, begin(block),
+                        [](std::ranges::range_value_t<In> const& value) -> rep {
+                            if constexpr (std::is_same_v<std::ranges::range_value_t<In>, T>) {
+                                return cnl::unwrap(value);
+                            } else {
+                                return value;
+                            }
+                        });
+                append_block(std::span(block).first(length));
+            }
+        }
+
+        [[nodiscard]] auto size() const -> size_type
+        {
+            return _size;
+        }
+
+        [[nodiscard]] auto empty() const
+        {
+            return _size == 0;
+        }
+
+        [[nodiscard]] auto num_blocks() const -> size_type
+        {
+            return (_size + block_size - 1) / block_size;
+        }
+
+        /// number of elements in the given block
+        [[nodiscard]] auto block_length(size_type block) const -> size_type
+        {
+            CNL_ASSERT(block < num_blocks());
+            return std::min(block_size, _size - block * block_size);
+        }
+
+        /// number of bits in which each element of the given block is stored
+        [[nodiscard]] auto block_width(size_type block) const -> int
+        {
+            CNL_ASSERT(block < num_blocks());
+            return _frames[block].width;
+        }
+
+        /// the least element of the given block
+        [[nodiscard]] auto block_min(size_type block) const -> T
+        {
+            CNL_ASSERT(block < num_blocks());
+            return cnl::wrap<T>(static_cast<rep>(_frames[block].reference));
+        }
+
+        /// bytes occupied by the compressed elements and their frames of reference
+        [[nodiscard]] auto size_bytes() const -> size_type
+        {
+            return _words.size() * sizeof(_impl::compressed_word) + _frames.size() * sizeof(frame);
+        }
+
+        [[nodiscard]] auto operator[](size_type index) const -> T
+        {
+            CNL_ASSERT(index < _size);
+            auto const& f = _frames[index / block_size];
+            auto const* words = _words.data() + f.first_word;
+            auto const element = index % block_size;
+
+            auto offset = unsigned_rep(_impl::compressed_read_offset(
+                    words, std::min(f.width, _impl::compressed_word_width), element));
+            if constexpr (sizeof(unsigned_rep) > sizeof(_impl::compressed_word)) {
+                if (f.width > _impl::compressed_word_width) {
+                    offset |= unsigned_rep(_impl::compressed_read_offset(
+                                      words + _impl::compressed_num_words(_impl::compressed_word_width),
+                                      f.width - _impl::compressed_word_width, element))
+                           << _impl::compressed_word_width;
+                }
+            }
+            return cnl::wrap<T>(static_cast<rep>(static_cast<unsigned_rep>(f.reference + offset)));
+        }
+
+        /// \brief decodes the elements of one block
+        ///
+        /// \param block index of the block; elements `block * block_size` onward are decoded
+        /// \param out a contiguous range of `T`, or of its rep, with \ref block_length elements
+        template<std::ranges::contiguous_range Out>
+        requires _impl::packed_value<std::ranges::range_value_t<Out>, T>
+        void decompress_block(size_type block, Out&& out) const
+        {
+            CNL_ASSERT(std::ranges::size(out) == block_length(block));
+            using value = std::ranges::range_value_t<Out>;
+            auto* const first = std::ranges::data(out);
+
+            if constexpr (std::is_same_v<value, rep> || _impl::rep_layout_of<value, rep>) {
+                if (std::ranges::size(out) == block_size) {
+                    // decode in place
+                    unpack_block(_frames[block], reinterpret_cast<rep*>(first));
+                    return;
+                }
+            }
+
+            auto reps = std::array<rep, block_size>{};
+            unpack_block(_frames[block], reps.data());
+            std::transform(begin(reps), begin(reps) + std::ranges::size(out), first, [](rep r) {
+                if constexpr (std::is_same_v<value, rep>) {
+                    return r;
+                } else {
+                    return cnl::wrap<T>(r);
+                }
+            });
+        }
+
+        /// the encoded offsets of every block
+        [[nodiscard]] auto words() const -> std::span<_impl::compressed_word const>
+        {
+            return _words;
+        }
+
+    private:
+        void append_block(std::span<rep const> values)
+        {
+            auto const [min, max] = std::minmax_element(begin(values), end(values));
+            auto const reference = static_cast<unsigned_rep>(*min);
+            auto const width = cnl::used_digits(static_cast<unsigned_rep>(unsigned_rep(*max) - reference));
+            _frames.push_back(frame{reference, _words.size(), width});
+
+            auto const lower_width = std::min(width, _impl::compressed_word_width);
+            auto const upper_width = width - lower_width;
+            auto const lower = _words.size();
+            auto const upper = lower + _impl::compressed_num_words(lower_width);
+            _words.resize(upper + _impl::compressed_num_words(upper_width));
+
+            for (auto index = std::size_t{0}; index != values.size(); ++index) {
+                auto const offset = static_cast<unsigned_rep>(unsigned_rep(values[index]) - reference);
+                _impl::compressed_or_offset(
+                        _words.data() + lower, lower_width, index,
+                        static_cast<_impl::compressed_word>(offset));
+                if constexpr (sizeof(unsigned_rep) > sizeof(_impl::compressed_word)) {
+                    _impl::compressed_or_offset(
+                            _words.data() + upper, upper_width, index,
+                            static_cast<_impl::compressed_word>(offset >> _impl::compressed_word_width));
+                }
+            }
+        }
+
+        void unpack_block(frame const& f, rep* out) const
+        {
+            auto const* words = _words.data() + f.first_word;
+            if (f.width <= _impl::compressed_word_width) {
+                _impl::compressed_unpack_table<rep>[f.width](words, f.reference, out);
+                return;
+            }
+
+            auto lower = std::array<uint64, block_size>{};
+            auto upper = std::array<uint64, block_size>{};
+            _impl::compressed_unpack_table<uint64>[_impl::compressed_word_width](words, 0, lower.data());
+            _impl::compressed_unpack_table<uint64>[f.width - _impl::compressed_word_width](
+                    words + _impl::compressed_num_words(_impl::compressed_word_width), 0, upper.data());
+            for (auto index = std::size_t{0}; index != block_size; ++index) {
+                out[index] = static_cast<rep>(static_cast<unsigned_rep>(
+                        f.reference + ((upper[index] << _impl::compressed_word_width) | lower[index])));
+            }
+        }
+
+        std::vector<_impl::compressed_word> _words;
+        std::vector<frame> _frames;
+        size_type _size = 0;
+    };
+
+    /// \brief decodes every element of a \ref cnl::compressed_vector
+    ///
+    /// \param in the compressed elements
+    /// \param out a contiguous range of `T`, or of the integer which \ref cnl::unwrap returns
+    ///        from `T`, with as many elements as `in`
+    ///
+    /// Each block is decoded by a routine specialized for the width of its offsets which has
+    /// no branches and which decodes every lane of a row with the same vector instructions.
+    template<typename T, std::ranges::contiguous_range Out>
+    requires _impl::packed_value<std::ranges::range_value_t<Out>, T>
+    void decompress(compressed_vector<T> const& in, Out&& out)
+    {
+        CNL_ASSERT(std::ranges::size(out) == in.size());
+        auto const all = std::span(std::ranges::data(out), std::ranges::size(out));
+        for (auto block = std::size_t{0}; block != in.num_blocks(); ++block) {
+            in.decompress_block(
+                    block, all.subspan(block * in.block_size, in.block_length(block)));
+        }
+    }
+}
+
+#endif  // CNL_IMPL_COMPRESSED_VECTOR_H
@@ -172,6 +172,40 @@
 #define CNL_BUILTIN_OVERFLOW_ENABLED
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+// CNL_FORCE_INLINE_ENABLED macro definition
+
+// When enabled, CNL_FORCE_INLINE requires that the functions which forward
+// operations between the layers of composite types are inlined, even in
+// unoptimized builds. This makes -O0 builds faster but harder to step through.
+
+#if defined(CNL_FORCE_INLINE_ENABLED)
+#error CNL_FORCE_INLINE_ENABLED already defined
+#endif
+
+#if defined(CNL_USE_FORCE_INLINE)
+#if CNL_USE_FORCE_INLINE
+#define CNL_FORCE_INLINE_ENABLED
+#endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// CNL_INSTRUMENTATION_ENABLED macro definition
+
+// When enabled, operations on CNL types, overflow handling, rounding and slow
+// paths such as wide division invoke cnl::instrumentation_hook, which by
+// default counts them; see cnl/instrumentation.h.
+
+#if defined(CNL_INSTRUMENTATION_ENABLED)
+#error CNL_INSTRUMENTATION_ENABLED already defined
+#endif
+
+#if defined(CNL_USE_INSTRUMENTATION)
+#if CNL_USE_INSTRUMENTATION
+#define CNL_INSTRUMENTATION_ENABLED
+#endif
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 
 #endif  // CNL_CONFIG_H
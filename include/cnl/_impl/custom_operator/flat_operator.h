@@ -0,0 +1,51 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief resolution of binary operators on the reps of composite types without overload resolution
+
+#if !defined(CNL_IMPL_CUSTOM_OPERATOR_FLAT_OPERATOR_H)
+#define CNL_IMPL_CUSTOM_OPERATOR_FLAT_OPERATOR_H
+
+#include "../wrapper/is_wrapper.h"
+#include "definition.h"
+#include "op.h"
+
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::flat_operator
+
+        // the function object which `Operator{}(lhs, rhs)` ends up invoking;
+        // for wrappers, this names the custom_operator specialization which the operator
+        // function template would invoke, so that applying an operation to a composite type
+        // does not require overload resolution of the operator functions at every level
+        template<binary_op Operator, typename Lhs, typename Rhs>
+        struct flat_operator {
+            using type = Operator;
+        };
+
+        template<binary_op Operator, any_wrapper Lhs, any_wrapper Rhs>
+        struct flat_operator<Operator, Lhs, Rhs> {
+            using type = custom_operator<Operator, op_value<Lhs>, op_value<Rhs>>;
+        };
+
+        template<binary_op Operator, typename Lhs, typename Rhs>
+        using flat_operator_t = typename flat_operator<Operator, Lhs, Rhs>::type;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::is_transparent_operator
+
+        // true iff the custom_operator specialization of a tag applies Operator to the reps
+        // unchanged, in which case the tag's level of the composite can be skipped
+        template<class TagOperator, binary_op Operator>
+        inline constexpr auto is_transparent_operator = std::is_base_of_v<Operator, TagOperator>;
+    }
+}
+
+#endif  // CNL_IMPL_CUSTOM_OPERATOR_FLAT_OPERATOR_H
@@ -8,6 +8,7 @@
 #define CNL_IMPL_OPERATORS_IS_HOMOGENEOUS_OPERATOR_TAG_H
 
 #include "../config.h"
+#include "../force_inline.h"
 #include "definition.h"
 #include "overloads.h"
 
@@ -36,7 +37,7 @@ namespace cnl {
 
     template<_impl::binary_arithmetic_op Operator, _impl::homogeneous_operator_tag Tag>
     struct custom_operator<Operator, op_value<Tag>, op_value<Tag>> {
-        [[nodiscard]] constexpr auto operator()(Tag, Tag) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Tag, Tag) const
         {
             return Tag{};
         }
@@ -44,7 +45,7 @@ namespace cnl {
 
     template<_impl::comparison_op Operator, _impl::homogeneous_operator_tag Tag>
     struct custom_operator<Operator, op_value<Tag>, op_value<Tag>> {
-        [[nodiscard]] constexpr auto operator()(Tag, Tag) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Tag, Tag) const
         {
             return true;
         }
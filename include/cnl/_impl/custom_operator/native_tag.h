@@ -8,6 +8,7 @@
 #define CNL_IMPL_OPERATORS_NATIVE_TAG_H
 
 #include "../../constant.h"
+#include "../force_inline.h"
 #include "../numbers/set_signedness.h"
 #include "../type_traits/is_integral.h"
 #include "definition.h"
@@ -40,7 +41,7 @@ namespace cnl {
 
     template<typename Source, typename Destination>
     struct custom_operator<_impl::convert_op, op_value<Source>, op_value<Destination>> {
-        [[nodiscard]] constexpr auto operator()(Source const& from) const -> Destination
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Source const& from) const -> Destination
         {
             return _impl::convert_op{}.template operator()<Destination>(from);
         }
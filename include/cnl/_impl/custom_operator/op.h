@@ -11,6 +11,7 @@
 #define CNL_IMPL_OPERATORS_OPERATORS_H
 
 #include "../config.h"
+#include "../force_inline.h"
 
 #include <type_traits>
 
@@ -22,7 +23,7 @@ namespace cnl {
 
         struct convert_op {
             template<class Destination, class Source>
-            [[nodiscard]] constexpr auto operator()(Source const& source) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Source const& source) const
             {
                 return static_cast<Destination>(source);
             }
@@ -30,7 +31,7 @@ namespace cnl {
 
         struct minus_op {
             template<class Rhs>
-            [[nodiscard]] constexpr auto operator()(Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Rhs const& rhs) const
             {
                 return -rhs;
             }
@@ -38,7 +39,7 @@ namespace cnl {
 
         struct plus_op {
             template<class Rhs>
-            [[nodiscard]] constexpr auto operator()(Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Rhs const& rhs) const
             {
                 return +rhs;
             }
@@ -46,7 +47,7 @@ namespace cnl {
 
         struct bitwise_not_op {
             template<class Rhs>
-            [[nodiscard]] constexpr auto operator()(Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Rhs const& rhs) const
             {
                 return ~rhs;
             }
@@ -54,7 +55,7 @@ namespace cnl {
 
         struct add_op {
             template<class Lhs, class Rhs>
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
             {
                 return lhs + rhs;
             }
@@ -62,7 +63,7 @@ namespace cnl {
 
         struct subtract_op {
             template<class Lhs, class Rhs>
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
             {
                 return lhs - rhs;
             }
@@ -70,7 +71,7 @@ namespace cnl {
 
         struct multiply_op {
             template<class Lhs, class Rhs>
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
             {
                 return lhs * rhs;
             }
@@ -78,7 +79,7 @@ namespace cnl {
 
         struct divide_op {
             template<class Lhs, class Rhs>
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
             {
                 return lhs / rhs;
             }
@@ -86,7 +87,7 @@ namespace cnl {
 
         struct modulo_op {
             template<class Lhs, class Rhs>
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
             {
                 return lhs % rhs;
             }
@@ -94,7 +95,7 @@ namespace cnl {
 
         struct bitwise_or_op {
             template<class Lhs, class Rhs>
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
             {
                 return lhs | rhs;
             }
@@ -102,7 +103,7 @@ namespace cnl {
 
         struct bitwise_and_op {
             template<class Lhs, class Rhs>
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
             {
                 return lhs & rhs;
             }
@@ -110,7 +111,7 @@ namespace cnl {
 
         struct bitwise_xor_op {
             template<class Lhs, class Rhs>
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
             {
                 return lhs ^ rhs;
             }
@@ -118,7 +119,7 @@ namespace cnl {
 
         struct shift_left_op {
             template<class Lhs, class Rhs>
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
             {
                 return lhs << rhs;
             }
@@ -126,7 +127,7 @@ namespace cnl {
 
         struct shift_right_op {
             template<class Lhs, class Rhs>
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
             {
                 return lhs >> rhs;
             }
@@ -134,7 +135,7 @@ namespace cnl {
 
         struct equal_op {
             template<class Lhs, class Rhs>
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
             {
                 return lhs == rhs;
             }
@@ -142,7 +143,7 @@ namespace cnl {
 
         struct not_equal_op {
             template<class Lhs, class Rhs>
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
             {
                 return lhs != rhs;
             }
@@ -150,7 +151,7 @@ namespace cnl {
 
         struct less_than_op {
             template<class Lhs, class Rhs>
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
             {
                 return lhs < rhs;  // NOLINT(hicpp-use-nullptr,modernize-use-nullptr)
             }
@@ -158,7 +159,7 @@ namespace cnl {
 
         struct greater_than_op {
             template<class Lhs, class Rhs>
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
             {
                 return lhs > rhs;  // NOLINT(hicpp-use-nullptr,modernize-use-nullptr)
             }
@@ -166,7 +167,7 @@ namespace cnl {
 
         struct less_than_or_equal_op {
             template<class Lhs, class Rhs>
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
             {
                 return lhs <= rhs;  // NOLINT(hicpp-use-nullptr,modernize-use-nullptr)
             }
@@ -174,7 +175,7 @@ namespace cnl {
 
         struct greater_than_or_equal_op {
             template<class Lhs, class Rhs>
-            [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
             {
                 return lhs >= rhs;  // NOLINT(hicpp-use-nullptr,modernize-use-nullptr)
             }
@@ -182,7 +183,7 @@ namespace cnl {
 
         struct pre_increment_op {
             template<class Rhs>
-            constexpr auto operator()(Rhs& rhs) const
+            CNL_FORCE_INLINE constexpr auto operator()(Rhs& rhs) const
             {
                 return ++rhs;
             }
@@ -190,7 +191,7 @@ namespace cnl {
 
         struct pre_decrement_op {
             template<class Rhs>
-            constexpr auto operator()(Rhs& rhs) const
+            CNL_FORCE_INLINE constexpr auto operator()(Rhs& rhs) const
             {
                 return --rhs;
             }
@@ -198,7 +199,7 @@ namespace cnl {
 
         struct post_increment_op {
             template<class Lhs>
-            constexpr auto operator()(Lhs& lhs) const
+            CNL_FORCE_INLINE constexpr auto operator()(Lhs& lhs) const
             {
                 return lhs++;
             }
@@ -206,7 +207,7 @@ namespace cnl {
 
         struct post_decrement_op {
             template<class Lhs>
-            constexpr auto operator()(Lhs& lhs) const
+            CNL_FORCE_INLINE constexpr auto operator()(Lhs& lhs) const
             {
                 return lhs--;
             }
@@ -224,7 +225,7 @@ namespace cnl {
             using binary = add_op;
 
             template<class Lhs, class Rhs>
-            constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
+            CNL_FORCE_INLINE constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
             {
                 return lhs += rhs;
             }
@@ -234,7 +235,7 @@ namespace cnl {
             using binary = subtract_op;
 
             template<class Lhs, class Rhs>
-            constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
+            CNL_FORCE_INLINE constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
             {
                 return lhs -= rhs;
             }
@@ -249,7 +250,7 @@ namespace cnl {
             using binary = multiply_op;
 
             template<class Lhs, class Rhs>
-            constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
+            CNL_FORCE_INLINE constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
             {
                 return lhs *= rhs;
             }
@@ -259,7 +260,7 @@ namespace cnl {
             using binary = divide_op;
 
             template<class Lhs, class Rhs>
-            constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
+            CNL_FORCE_INLINE constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
             {
                 return lhs /= rhs;
             }
@@ -269,7 +270,7 @@ namespace cnl {
             using binary = modulo_op;
 
             template<class Lhs, class Rhs>
-            constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
+            CNL_FORCE_INLINE constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
             {
                 return lhs %= rhs;
             }
@@ -279,7 +280,7 @@ namespace cnl {
             using binary = bitwise_or_op;
 
             template<class Lhs, class Rhs>
-            constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
+            CNL_FORCE_INLINE constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
             {
                 return lhs |= rhs;
             }
@@ -289,7 +290,7 @@ namespace cnl {
             using binary = bitwise_and_op;
 
             template<class Lhs, class Rhs>
-            constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
+            CNL_FORCE_INLINE constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
             {
                 return lhs &= rhs;
             }
@@ -299,7 +300,7 @@ namespace cnl {
             using binary = bitwise_xor_op;
 
             template<class Lhs, class Rhs>
-            constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
+            CNL_FORCE_INLINE constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
             {
                 return lhs ^= rhs;
             }
@@ -309,7 +310,7 @@ namespace cnl {
             using binary = shift_left_op;
 
             template<class Lhs, class Rhs>
-            constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
+            CNL_FORCE_INLINE constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
             {
                 return lhs <<= rhs;
             }
@@ -319,7 +320,7 @@ namespace cnl {
             using binary = shift_right_op;
 
             template<class Lhs, class Rhs>
-            constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
+            CNL_FORCE_INLINE constexpr auto operator()(Lhs& lhs, Rhs const& rhs) const
             {
                 return lhs >>= rhs;
             }
@@ -11,6 +11,8 @@
 #define CNL_IMPL_OPERATORS_OVERLOADS_H
 
 #include "../../arithmetic.h"
+#include "../force_inline.h"
+#include "../instrumentation.h"
 #include "definition.h"
 #include "op.h"
 
@@ -34,8 +36,9 @@ namespace cnl {
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define CNL_DEFINE_UNARY_OPERATOR(OP, NAME) \
     template<class Operand> \
-    requires _impl::wants_generic_ops<Operand> [[nodiscard]] constexpr auto operator OP(Operand const& rhs) \
+    requires _impl::wants_generic_ops<Operand> [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator OP(Operand const& rhs) \
     { \
+        CNL_INSTRUMENT(cnl::instrumentation::operation_event, NAME, Operand); \
         return cnl::custom_operator<NAME, cnl::op_value<Operand>>()(rhs); \
     }
 
@@ -50,9 +53,10 @@ namespace cnl {
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define CNL_DEFINE_BINARY_OPERATOR(OP, NAME) \
     template<cnl::arithmetic LhsOperand, cnl::arithmetic RhsOperand> \
-    requires wants_generic_ops_binary<LhsOperand, RhsOperand> [[nodiscard]] constexpr auto \
+    requires wants_generic_ops_binary<LhsOperand, RhsOperand> [[nodiscard]] CNL_FORCE_INLINE constexpr auto \
     operator OP(LhsOperand const& lhs, RhsOperand const& rhs) \
     { \
+        CNL_INSTRUMENT(cnl::instrumentation::operation_event, NAME, LhsOperand, RhsOperand); \
         return cnl::custom_operator<NAME, cnl::op_value<LhsOperand>, cnl::op_value<RhsOperand>>{}( \
                 lhs, rhs); \
     }
@@ -78,9 +82,10 @@ namespace cnl {
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define CNL_DEFINE_SHIFT_OPERATOR(OP, NAME) \
     template<cnl::arithmetic LhsOperand, cnl::arithmetic RhsOperand> \
-    requires wants_generic_ops_binary<LhsOperand, RhsOperand> [[nodiscard]] constexpr auto \
+    requires wants_generic_ops_binary<LhsOperand, RhsOperand> [[nodiscard]] CNL_FORCE_INLINE constexpr auto \
     operator OP(LhsOperand const& lhs, RhsOperand const& rhs) \
     { \
+        CNL_INSTRUMENT(cnl::instrumentation::operation_event, NAME, LhsOperand, RhsOperand); \
         return cnl::custom_operator<NAME, op_value<LhsOperand>, op_value<RhsOperand>>()(lhs, rhs); \
     }
 
@@ -93,9 +98,10 @@ namespace cnl {
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define CNL_DEFINE_COMPARISON_OPERATOR(OP, NAME) \
     template<cnl::arithmetic LhsOperand, cnl::arithmetic RhsOperand> \
-    requires wants_generic_ops_binary<LhsOperand, RhsOperand> [[nodiscard]] constexpr auto \
+    requires wants_generic_ops_binary<LhsOperand, RhsOperand> [[nodiscard]] CNL_FORCE_INLINE constexpr auto \
     operator OP(LhsOperand const& lhs, RhsOperand const& rhs) \
     { \
+        CNL_INSTRUMENT(cnl::instrumentation::operation_event, NAME, LhsOperand, RhsOperand); \
         return cnl::custom_operator<NAME, op_value<LhsOperand>, op_value<RhsOperand>>()(lhs, rhs); \
     }
 
@@ -116,8 +122,9 @@ namespace cnl {
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define CNL_DEFINE_PRE_OPERATOR(OP, NAME) \
     template<cnl::arithmetic RhsOperand> \
-    constexpr decltype(auto) operator OP(RhsOperand& rhs) \
+    CNL_FORCE_INLINE constexpr decltype(auto) operator OP(RhsOperand& rhs) \
     { \
+        CNL_INSTRUMENT(cnl::instrumentation::operation_event, NAME, RhsOperand); \
         return cnl::custom_operator<NAME, cnl::op_value<RhsOperand>>()(rhs); \
     }
 
@@ -130,9 +137,10 @@ namespace cnl {
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define CNL_DEFINE_POST_OPERATOR(OP, NAME) \
     template<cnl::arithmetic LhsOperand> \
-    constexpr auto operator OP(LhsOperand& lhs, int) \
+    CNL_FORCE_INLINE constexpr auto operator OP(LhsOperand& lhs, int) \
             ->decltype(cnl::custom_operator<NAME, cnl::op_value<LhsOperand>>()(lhs)) \
     { \
+        CNL_INSTRUMENT(cnl::instrumentation::operation_event, NAME, LhsOperand); \
         return cnl::custom_operator<NAME, cnl::op_value<LhsOperand>>()(lhs); \
     }
 
@@ -145,8 +153,9 @@ namespace cnl {
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define CNL_DEFINE_COMPOUND_ASSIGNMENT_OPERATOR(OP, NAME) \
     template<cnl::arithmetic LhsOperand, cnl::arithmetic RhsOperand> \
-    requires _impl::wants_generic_ops_binary<LhsOperand, RhsOperand> constexpr auto operator OP(LhsOperand& lhs, RhsOperand const& rhs) \
+    requires _impl::wants_generic_ops_binary<LhsOperand, RhsOperand> CNL_FORCE_INLINE constexpr auto operator OP(LhsOperand& lhs, RhsOperand const& rhs) \
     { \
+        CNL_INSTRUMENT(cnl::instrumentation::operation_event, NAME, LhsOperand, RhsOperand); \
         return cnl::custom_operator< \
                 NAME, op_value<LhsOperand>, op_value<RhsOperand>>()(lhs, rhs); \
     }
@@ -172,8 +181,9 @@ namespace cnl {
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define CNL_DEFINE_COMPOUND_ASSIGNMENT_SHIFT_OPERATOR(OP, NAME) \
     template<cnl::arithmetic LhsOperand, cnl::arithmetic RhsOperand> \
-    requires _impl::wants_generic_ops_binary<LhsOperand, RhsOperand> constexpr auto operator OP(LhsOperand& lhs, RhsOperand const& rhs) \
+    requires _impl::wants_generic_ops_binary<LhsOperand, RhsOperand> CNL_FORCE_INLINE constexpr auto operator OP(LhsOperand& lhs, RhsOperand const& rhs) \
     { \
+        CNL_INSTRUMENT(cnl::instrumentation::operation_event, NAME, LhsOperand, RhsOperand); \
         return cnl::custom_operator< \
                 NAME, op_value<LhsOperand>, op_value<RhsOperand>>()(lhs, rhs); \
     }
@@ -10,6 +10,7 @@
 #include "../../constant.h"
 #include "../config.h"
 #include "../custom_operator/tag.h"
+#include "../force_inline.h"
 #include "definition.h"
 #include "op.h"
 
@@ -27,20 +28,20 @@ namespace cnl {
     /// cnl::native_overflow_tag, cnl::saturated_overflow_tag, cnl::throwing_overflow_tag,
     /// cnl::trapping_overflow_tag, cnl::undefined_overflow_tag, cnl::nearest_rounding_tag
     template<tag DestTag, tag SrcTag, typename Dest, typename Src>
-    [[nodiscard]] constexpr auto convert(Src const& src)
+    [[nodiscard]] CNL_FORCE_INLINE constexpr auto convert(Src const& src)
     {
         return custom_operator<_impl::convert_op, op_value<Src, SrcTag>, op_value<Dest, DestTag>>{}(src);
     }
 
     template<tag DestTag, tag SrcTag, typename Dest, CNL_IMPL_CONSTANT_VALUE_TYPE Value>
-    [[nodiscard]] constexpr auto convert(constant<Value> const& src)
+    [[nodiscard]] CNL_FORCE_INLINE constexpr auto convert(constant<Value> const& src)
     {
         return custom_operator<_impl::convert_op, op_value<decltype(Value), SrcTag>, op_value<Dest, DestTag>>{}(src);
     }
 
     namespace _impl {
         template<_impl::binary_arithmetic_op Operator, tag Tag, typename Lhs, typename Rhs>
-        [[nodiscard]] constexpr auto binary_arithmetic_operate(Lhs const& lhs, Rhs const& rhs)
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto binary_arithmetic_operate(Lhs const& lhs, Rhs const& rhs)
         {
             return custom_operator<Operator, op_value<Lhs, Tag>, op_value<Rhs, Tag>>{}(lhs, rhs);
         }
@@ -56,7 +57,7 @@ namespace cnl {
     /// cnl::native_overflow_tag, cnl::saturated_overflow_tag, cnl::throwing_overflow_tag,
     /// cnl::trapping_overflow_tag, cnl::undefined_overflow_tag, cnl::nearest_rounding_tag
     template<tag Tag, typename Lhs, typename Rhs>
-    [[nodiscard]] constexpr auto add(Lhs const& lhs, Rhs const& rhs)
+    [[nodiscard]] CNL_FORCE_INLINE constexpr auto add(Lhs const& lhs, Rhs const& rhs)
     {
         return custom_operator<_impl::add_op, op_value<Lhs, Tag>, op_value<Rhs, Tag>>{}(lhs, rhs);
     }
@@ -71,7 +72,7 @@ namespace cnl {
     /// cnl::native_overflow_tag, cnl::saturated_overflow_tag, cnl::throwing_overflow_tag,
     /// cnl::trapping_overflow_tag, cnl::undefined_overflow_tag, cnl::nearest_rounding_tag
     template<tag Tag, typename Lhs, typename Rhs>
-    [[nodiscard]] constexpr auto subtract(Lhs const& lhs, Rhs const& rhs)
+    [[nodiscard]] CNL_FORCE_INLINE constexpr auto subtract(Lhs const& lhs, Rhs const& rhs)
     {
         return custom_operator<_impl::subtract_op, op_value<Lhs, Tag>, op_value<Rhs, Tag>>{}(lhs, rhs);
     }
@@ -86,7 +87,7 @@ namespace cnl {
     /// cnl::native_overflow_tag, cnl::saturated_overflow_tag, cnl::throwing_overflow_tag,
     /// cnl::trapping_overflow_tag, cnl::undefined_overflow_tag, cnl::nearest_rounding_tag
     template<tag Tag, typename Lhs, typename Rhs>
-    [[nodiscard]] constexpr auto multiply(Lhs const& lhs, Rhs const& rhs)
+    [[nodiscard]] CNL_FORCE_INLINE constexpr auto multiply(Lhs const& lhs, Rhs const& rhs)
     {
         return custom_operator<_impl::multiply_op, op_value<Lhs, Tag>, op_value<Rhs, Tag>>{}(lhs, rhs);
     }
@@ -101,13 +102,13 @@ namespace cnl {
     /// cnl::native_overflow_tag, cnl::saturated_overflow_tag, cnl::throwing_overflow_tag,
     /// cnl::trapping_overflow_tag, cnl::undefined_overflow_tag, cnl::nearest_rounding_tag
     template<tag Tag, typename Lhs, typename Rhs>
-    [[nodiscard]] constexpr auto divide(Lhs const& lhs, Rhs const& rhs)
+    [[nodiscard]] CNL_FORCE_INLINE constexpr auto divide(Lhs const& lhs, Rhs const& rhs)
     {
         return custom_operator<_impl::divide_op, op_value<Lhs, Tag>, op_value<Rhs, Tag>>{}(lhs, rhs);
     }
 
     template<tag Tag, typename Lhs, typename Rhs>
-    [[nodiscard]] constexpr auto shift_left(Lhs const& lhs, Rhs const& rhs)
+    [[nodiscard]] CNL_FORCE_INLINE constexpr auto shift_left(Lhs const& lhs, Rhs const& rhs)
     {
         return custom_operator<_impl::shift_left_op, op_value<Lhs, Tag>, op_value<Rhs, Tag>>{}(lhs, rhs);
     }
@@ -122,7 +123,7 @@ namespace cnl {
     /// cnl::native_overflow_tag, cnl::saturated_overflow_tag, cnl::throwing_overflow_tag,
     /// cnl::trapping_overflow_tag, cnl::undefined_overflow_tag, cnl::nearest_rounding_tag
     template<tag Tag, typename Lhs, typename Rhs>
-    [[nodiscard]] constexpr auto shift_right(Lhs const& lhs, Rhs const& rhs)
+    [[nodiscard]] CNL_FORCE_INLINE constexpr auto shift_right(Lhs const& lhs, Rhs const& rhs)
     {
         return custom_operator<_impl::shift_right_op, op_value<Lhs, Tag>, op_value<Rhs, Tag>>{}(lhs, rhs);
     }
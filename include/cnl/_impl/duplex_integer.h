@@ -18,6 +18,7 @@
 #include "duplex_integer/is_duplex_integer.h"
 #include "duplex_integer/modulo.h"
 #include "duplex_integer/multiply.h"
+#include "duplex_integer/multiply_add.h"
 #include "duplex_integer/narrowest_integer.h"
 #include "duplex_integer/numbers.h"
 #include "duplex_integer/numeric_limits.h"
@@ -7,6 +7,8 @@
 #if !defined(CNL_IMPL_DUPLEX_INTEGER_DECLARATION_H)
 #define CNL_IMPL_DUPLEX_INTEGER_DECLARATION_H
 
+#include <type_traits>
+
 /// compositional numeric library
 namespace cnl {
     namespace _impl {
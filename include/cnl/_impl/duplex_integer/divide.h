@@ -10,6 +10,7 @@
 #include "../custom_operator/definition.h"
 #include "../custom_operator/native_tag.h"
 #include "../custom_operator/op.h"
+#include "../instrumentation.h"
 #include "../numbers/set_signedness.h"
 #include "../wide_integer/definition.h"
 #include "ctors.h"
@@ -49,6 +50,7 @@ namespace cnl {
         [[nodiscard]] constexpr auto operator()(
                 _duplex_integer const& lhs, _duplex_integer const& rhs) const -> _duplex_integer
         {
+            CNL_INSTRUMENT(cnl::instrumentation::slow_path_event, _impl::divide_op, _duplex_integer);
             return (lhs < _duplex_integer{0}) ? (rhs < _duplex_integer{0})
                                                       ? non_negative_division(-lhs, -rhs)
                                                       : -non_negative_division(-lhs, rhs)
@@ -0,0 +1,33 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_DUPLEX_INTEGER_MULTIPLY_ADD_H)
+#define CNL_IMPL_DUPLEX_INTEGER_MULTIPLY_ADD_H
+
+#include "../multiply_add.h"
+#include "multiply.h"
+#include "definition.h"
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // the full-width product of long_multiply plus the addend
+        template<typename Upper, typename Lower>
+        struct exact_multiply_add<
+                duplex_integer<Upper, Lower>, duplex_integer<Upper, Lower>, duplex_integer<Upper, Lower>> {
+            using _duplex_integer = duplex_integer<Upper, Lower>;
+            using result_type = typename long_multiply<_duplex_integer>::result_type;
+
+            [[nodiscard]] constexpr auto operator()(
+                    _duplex_integer const& a, _duplex_integer const& b, _duplex_integer const& c) const
+                    -> result_type
+            {
+                return long_multiply<_duplex_integer>{}(a, b) + result_type{c};
+            }
+        };
+    }
+}
+
+#endif  // CNL_IMPL_DUPLEX_INTEGER_MULTIPLY_ADD_H
@@ -8,6 +8,7 @@
 #define CNL_IMPL_ELASTIC_INTEGER_GENERIC_H
 
 #include "../custom_operator/definition.h"
+#include "../force_inline.h"
 #include "definition.h"
 
 #include <algorithm>
@@ -60,7 +61,7 @@ namespace cnl {
 
         template<int FromDigits, class FromNarrowest, int OtherDigits, class OtherNarrowest>
         requires(FromDigits != OtherDigits || !std::is_same<FromNarrowest, OtherNarrowest>::value)
-                [[nodiscard]] constexpr auto cast_to_common_type(
+                [[nodiscard]] CNL_FORCE_INLINE constexpr auto cast_to_common_type(
                         elastic_integer<FromDigits, FromNarrowest> const& from,
                         elastic_integer<OtherDigits, OtherNarrowest> const&)
         {
@@ -75,7 +76,7 @@ namespace cnl {
             Operator,
             op_value<elastic_integer<LhsDigits, LhsNarrowest>>,
             op_value<elastic_integer<RhsDigits, RhsNarrowest>>> {
-        [[nodiscard]] constexpr auto operator()(
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(
                 elastic_integer<LhsDigits, LhsNarrowest> const& lhs,
                 elastic_integer<RhsDigits, RhsNarrowest> const& rhs) const
         {
@@ -92,7 +93,7 @@ namespace cnl {
             op_value<Rhs>> {
         using lhs_type = _impl::wrapper<LhsRep, elastic_tag<LhsDigits, LhsNarrowest>>;
 
-        [[nodiscard]] constexpr auto operator()(lhs_type const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(lhs_type const& lhs, Rhs const& rhs) const
         {
             return _impl::from_rep<lhs_type>(Operator{}(_impl::to_rep(lhs), rhs));
         }
@@ -103,7 +104,7 @@ namespace cnl {
             _impl::shift_left_op,
             op_value<elastic_integer<LhsDigits, LhsNarrowest>>,
             op_value<constant<RhsValue>>> {
-        [[nodiscard]] constexpr auto operator()(
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(
                 elastic_integer<LhsDigits, LhsNarrowest> const& lhs, constant<RhsValue>) const
         {
             return _impl::from_rep<elastic_integer<LhsDigits + int{RhsValue}, LhsNarrowest>>(
@@ -119,7 +120,7 @@ namespace cnl {
             _impl::shift_right_op,
             op_value<_impl::wrapper<LhsRep, elastic_tag<LhsDigits, LhsNarrowest>>>,
             op_value<constant<RhsValue>>> {
-        [[nodiscard]] constexpr auto operator()(
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(
                 elastic_integer<LhsDigits, LhsNarrowest> const& lhs, constant<RhsValue>) const
         {
             return _impl::from_rep<elastic_integer<LhsDigits - int{RhsValue}, LhsNarrowest>>(
@@ -144,7 +145,7 @@ namespace cnl {
     template<_impl::unary_arithmetic_op Operator, integer RhsRep, int RhsDigits, integer RhsNarrowest>
     requires(!std::is_same_v<_impl::bitwise_not_op, Operator>) struct custom_operator<Operator, op_value<_impl::wrapper<RhsRep, elastic_tag<RhsDigits, RhsNarrowest>>>> {
         using rhs_type = _impl::wrapper<RhsRep, elastic_tag<RhsDigits, RhsNarrowest>>;
-        [[nodiscard]] constexpr auto operator()(rhs_type const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(rhs_type const& rhs) const
         {
             constexpr auto result_digits = digits<rhs_type>;
             using rhs_narrowest = _impl::tag_narrowest_t<_impl::tag_of_t<rhs_type>>;
@@ -158,7 +159,7 @@ namespace cnl {
     template<integer RhsRep, int RhsDigits, integer RhsNarrowest>
     struct custom_operator<
             _impl::bitwise_not_op, op_value<_impl::wrapper<RhsRep, elastic_tag<RhsDigits, RhsNarrowest>>>> {
-        [[nodiscard]] constexpr auto operator()(
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(
                 _impl::wrapper<RhsRep, elastic_tag<RhsDigits, RhsNarrowest>> const& rhs)
         {
             using elastic_integer = _impl::wrapper<RhsRep, elastic_tag<RhsDigits, RhsNarrowest>>;
@@ -10,6 +10,7 @@
 #if !defined(CNL_IMPL_ELASTIC_INTEGER_FROM_REP_H)
 #define CNL_IMPL_ELASTIC_INTEGER_FROM_REP_H
 
+#include "../force_inline.h"
 #include "../num_traits/from_rep.h"
 #include "definition.h"
 #include "set_rep.h"
@@ -18,7 +19,7 @@
 namespace cnl {
     template<int Digits, class Narrowest, class Rep>
     struct from_rep<elastic_integer<Digits, Narrowest>, Rep> {
-        [[nodiscard]] constexpr auto operator()(Rep const& r) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Rep const& r) const
                 -> _impl::set_rep_t<elastic_integer<Digits, Narrowest>, Rep>
         {
             return r;
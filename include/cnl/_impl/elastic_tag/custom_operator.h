@@ -9,6 +9,7 @@
 
 #include "../../constant.h"
 #include "../custom_operator/overloads.h"
+#include "../force_inline.h"
 #include "../num_traits/set_digits.h"
 #include "../num_traits/width.h"
 #include "../numbers/set_signedness.h"
@@ -63,7 +64,7 @@ namespace cnl {
                 std::declval<elastic_tag<RhsDigits, RhsNarrowest>>()));
         using result_rep = typename result_tag::_rep;
 
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
         {
             return Operator()(static_cast<result_rep>(lhs), static_cast<result_rep>(rhs));
         }
@@ -75,7 +76,7 @@ namespace cnl {
             Operator,
             op_value<Lhs, elastic_tag<LhsDigits, LhsNarrowest>>,
             op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
         {
             return Operator{}(lhs, rhs);
         }
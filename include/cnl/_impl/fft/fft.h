@@ -0,0 +1,360 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_FFT_FFT_H)
+#define CNL_IMPL_FFT_FFT_H
+
+#include "../../numeric.h"
+#include "../cstdint/types.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/unwrap.h"
+#include "../numbers/signedness.h"
+#include "../type_traits/is_integral.h"
+#include "../type_traits/remove_cvref.h"
+#include "../wrapper/rep_span.h"
+#include "twiddles.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // operands
+
+        // fundamental integer which represents a number
+        template<typename T>
+        using fft_rep_t = remove_cvref_t<decltype(cnl::unwrap(std::declval<T>()))>;
+
+        // signed numbers of up to 32 bits which can be viewed as their fundamental integers
+        template<typename T>
+        concept fft_operand = integral<fft_rep_t<T>> && numbers::signedness_v<fft_rep_t<T>>
+                           && (digits<fft_rep_t<T>> <= digits<int32>) && rep_layout_of<T, fft_rep_t<T>>;
+
+        template<typename Range>
+        inline constexpr auto fft_extent = decltype(std::span(std::declval<Range&>()))::extent;
+
+        template<typename T>
+        [[nodiscard]] auto fft_reps(std::span<T> values)
+        {
+            if constexpr (std::is_same_v<T, fft_rep_t<T>>) {
+                return values;
+            } else {
+                return to_rep_span<fft_rep_t<T>>(values);
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // block floating point
+
+        // A stage of radix 4 multiplies the magnitude of the elements by at most 4 sqrt(2) and a
+        // stage of radix 2 by at most 2 sqrt(2). Before each stage, the elements are shifted so
+        // that their leading bits number exactly the bits which the stage needs to avoid overflow.
+
+        [[nodiscard]] constexpr auto fft_headroom(std::size_t radix)
+        {
+            return (radix == 4) ? 3 : 2;
+        }
+
+        // a value with the same leading bits as value, which can be combined with others using |
+        template<typename Rep>
+        [[nodiscard]] constexpr auto fft_magnitude_bits(Rep value) -> Rep
+        {
+            return static_cast<Rep>(value ^ (value >> digits<Rep>));
+        }
+
+        // multiplies by 2 to the power of -shift, rounding to nearest;
+        // rather than add a half before shifting, which might overflow Rep,
+        // the bit below the result is added after
+        template<typename Rep>
+        class fft_scaler {
+        public:
+            explicit constexpr fft_scaler(int shift)
+                : _left(std::max(0, -shift))
+                , _right(std::max(0, shift))
+                , _round_shift(std::max(0, shift - 1))
+                , _round_mask((shift > 0) ? 1 : 0)
+            {
+            }
+
+            [[nodiscard]] constexpr auto operator()(Rep value) const -> Rep
+            {
+                return static_cast<Rep>(
+                        static_cast<Rep>(static_cast<Rep>(value << _left) >> _right)
+                        + ((value >> _round_shift) & _round_mask));
+            }
+
+        private:
+            int _left;
+            int _right;
+            int _round_shift;
+            Rep _round_mask;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // butterflies
+
+        // Stages decimate in frequency, so the input is in natural order and the output is in
+        // bit-reversed order. A radix-4 butterfly does the work of two radix-2 butterflies,
+        // leaving its results in the same order as they would.
+
+        // number of consecutive butterflies which are calculated together in local arrays;
+        // free of aliasing, each operation on the arrays compiles to SIMD instructions
+        inline constexpr auto fft_lanes = std::size_t{16};
+
+        template<std::size_t Radix, std::size_t Lanes, typename Rep>
+        using fft_tile = std::array<std::array<Rep, Lanes>, Radix>;
+
+        // the power of the twiddle factor by which output n of a butterfly is multiplied;
+        // the outputs of a radix-4 butterfly are in bit-reversed order
+        [[nodiscard]] constexpr auto fft_output_power(std::size_t radix, std::size_t n)
+        {
+            return (radix == 4 && (n == 1 || n == 2)) ? 3 - n : n;
+        }
+
+        // performs Lanes butterflies, beginning with the j-th, and returns their magnitude bits;
+        // the elements are scaled so that the results of every addition fit in Rep, so that
+        // they are added in lanes of Rep
+        template<std::size_t Radix, bool Rotate, std::size_t Lanes, typename Rep>
+        constexpr auto fft_butterflies(
+                Rep* real, Rep* imag, std::size_t j, std::size_t stride,
+                Rep const* twiddle_negated_real, Rep const* twiddle_imag, fft_scaler<Rep> scale) -> Rep
+        {
+            fft_tile<Radix, Lanes, Rep> in_real;
+            fft_tile<Radix, Lanes, Rep> in_imag;
+            for (auto n = std::size_t{0}; n != Radix; ++n) {
+                for (auto lane = std::size_t{0}; lane != Lanes; ++lane) {
+                    in_real[n][lane] = scale(real[n * stride + j + lane]);
+                    in_imag[n][lane] = scale(imag[n * stride + j + lane]);
+                }
+            }
+
+            fft_tile<Radix, Lanes, Rep> out_real;
+            fft_tile<Radix, Lanes, Rep> out_imag;
+            for (auto lane = std::size_t{0}; lane != Lanes; ++lane) {
+                if constexpr (Radix == 2) {
+                    out_real[0][lane] = static_cast<Rep>(in_real[0][lane] + in_real[1][lane]);
+                    out_imag[0][lane] = static_cast<Rep>(in_imag[0][lane] + in_imag[1][lane]);
+                    out_real[1][lane] = static_cast<Rep>(in_real[0][lane] - in_real[1][lane]);
+                    out_imag[1][lane] = static_cast<Rep>(in_imag[0][lane] - in_imag[1][lane]);
+                } else {
+                    auto const even_sum_real = static_cast<Rep>(in_real[0][lane] + in_real[2][lane]);
+                    auto const even_sum_imag = static_cast<Rep>(in_imag[0][lane] + in_imag[2][lane]);
+                    auto const even_difference_real = static_cast<Rep>(in_real[0][lane] - in_real[2][lane]);
+                    auto const even_difference_imag = static_cast<Rep>(in_imag[0][lane] - in_imag[2][lane]);
+                    auto const odd_sum_real = static_cast<Rep>(in_real[1][lane] + in_real[3][lane]);
+                    auto const odd_sum_imag = static_cast<Rep>(in_imag[1][lane] + in_imag[3][lane]);
+                    auto const odd_difference_real = static_cast<Rep>(in_real[1][lane] - in_real[3][lane]);
+                    auto const odd_difference_imag = static_cast<Rep>(in_imag[1][lane] - in_imag[3][lane]);
+
+                    // the product of the odd difference and -i is exact
+                    out_real[0][lane] = static_cast<Rep>(even_sum_real + odd_sum_real);
+                    out_imag[0][lane] = static_cast<Rep>(even_sum_imag + odd_sum_imag);
+                    out_real[1][lane] = static_cast<Rep>(even_sum_real - odd_sum_real);
+                    out_imag[1][lane] = static_cast<Rep>(even_sum_imag - odd_sum_imag);
+                    out_real[2][lane] = static_cast<Rep>(even_difference_real + odd_difference_imag);
+                    out_imag[2][lane] = static_cast<Rep>(even_difference_imag - odd_difference_real);
+                    out_real[3][lane] = static_cast<Rep>(even_difference_real - odd_difference_imag);
+                    out_imag[3][lane] = static_cast<Rep>(even_difference_imag + odd_difference_real);
+                }
+            }
+
+            // multiplication by the twiddle factors, rounded to nearest;
+            // Rep is widened for the multiplication only, e.g. with pmullw and pmulhw
+            if constexpr (Rotate) {
+                using wide = fft_wide_t<Rep>;
+                constexpr auto half = wide{1} << (digits<Rep> - 1);
+                for (auto n = std::size_t{1}; n != Radix; ++n) {
+                    auto const offset = (fft_output_power(Radix, n) - 1) * stride + j;
+                    auto const* const w_negated_real = twiddle_negated_real + offset;
+                    auto const* const w_imag = twiddle_imag + offset;
+                    for (auto lane = std::size_t{0}; lane != Lanes; ++lane) {
+                        auto const r = out_real[n][lane];
+                        auto const i = out_imag[n][lane];
+                        out_real[n][lane] = static_cast<Rep>(
+                                (half - (wide{r} * w_negated_real[lane] + wide{i} * w_imag[lane])) >> digits<Rep>);
+                        out_imag[n][lane] = static_cast<Rep>(
+                                (half + wide{r} * w_imag[lane] - wide{i} * w_negated_real[lane]) >> digits<Rep>);
+                    }
+                }
+            }
+
+            // the magnitude bits are combined per lane so that this loop is vectorized
+            auto lane_bits = std::array<Rep, Lanes>{};
+            for (auto n = std::size_t{0}; n != Radix; ++n) {
+                for (auto lane = std::size_t{0}; lane != Lanes; ++lane) {
+                    real[n * stride + j + lane] = out_real[n][lane];
+                    imag[n * stride + j + lane] = out_imag[n][lane];
+                    lane_bits[lane] = static_cast<Rep>(
+                            lane_bits[lane] | fft_magnitude_bits(out_real[n][lane])
+                            | fft_magnitude_bits(out_imag[n][lane]));
+                }
+            }
+            auto bits = Rep{0};
+            for (auto lane_bit : lane_bits) {
+                bits = static_cast<Rep>(bits | lane_bit);
+            }
+            return bits;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // stages
+
+        // transforms every span of a stage and returns the magnitude bits of its output
+        template<std::size_t Radix, std::size_t Size, typename Rep>
+        [[nodiscard]] constexpr auto fft_spans(
+                Rep* real, Rep* imag, std::size_t span, Rep const* twiddle_negated_real,
+                Rep const* twiddle_imag, fft_scaler<Rep> scale) -> Rep
+        {
+            auto const stride = span / Radix;
+            auto bits = Rep{0};
+            for (auto first = std::size_t{0}; first != Size; first += span) {
+                auto* const span_real = real + first;
+                auto* const span_imag = imag + first;
+                if (stride == 1) {
+                    // the twiddle factors of the only butterfly are 1
+                    bits |= fft_butterflies<Radix, false, 1>(
+                            span_real, span_imag, 0, stride, twiddle_negated_real, twiddle_imag, scale);
+                    continue;
+                }
+
+                auto j = std::size_t{0};
+                for (; j + fft_lanes <= stride; j += fft_lanes) {
+                    bits |= fft_butterflies<Radix, true, fft_lanes>(
+                            span_real, span_imag, j, stride, twiddle_negated_real, twiddle_imag, scale);
+                }
+                for (; j != stride; ++j) {
+                    bits |= fft_butterflies<Radix, true, 1>(
+                            span_real, span_imag, j, stride, twiddle_negated_real, twiddle_imag, scale);
+                }
+            }
+            return bits;
+        }
+
+        // transforms every span of a stage and returns the leading bits of its output
+        template<std::size_t Size, typename Rep>
+        [[nodiscard]] constexpr auto fft_stage(Rep* real, Rep* imag, std::size_t stage, int shift) -> int
+        {
+            constexpr auto const& twiddles = fft_twiddles<Rep, Size>;
+
+            auto const span = fft_span<Size>(stage);
+            auto const* const twiddle_negated_real = twiddles.negated_real.data() + fft_twiddle_offset<Size>(stage);
+            auto const* const twiddle_imag = twiddles.imag.data() + fft_twiddle_offset<Size>(stage);
+            auto const scale = fft_scaler<Rep>{shift};
+            auto const bits = (fft_radix<Size>(stage) == 2)
+                                    ? fft_spans<2, Size>(real, imag, span, twiddle_negated_real, twiddle_imag, scale)
+                                    : fft_spans<4, Size>(real, imag, span, twiddle_negated_real, twiddle_imag, scale);
+            return cnl::leading_bits(bits);
+        }
+
+        template<std::size_t Size, typename Rep>
+        constexpr void fft_bit_reverse(Rep* real, Rep* imag)
+        {
+            auto reversed = std::size_t{0};
+            for (auto index = std::size_t{0}; index != Size; ++index) {
+                if (index < reversed) {
+                    std::swap(real[index], real[reversed]);
+                    std::swap(imag[index], imag[reversed]);
+                }
+                // increment reversed from its most significant bit
+                auto bit = Size >> 1;
+                while (bit != 0 && (reversed & bit) != 0) {
+                    reversed ^= bit;
+                    bit >>= 1;
+                }
+                reversed |= bit;
+            }
+        }
+
+        template<typename Rep>
+        [[nodiscard]] constexpr auto fft_leading_bits(Rep const* real, Rep const* imag, std::size_t size)
+        {
+            auto bits = Rep{0};
+            for (auto index = std::size_t{0}; index != size; ++index) {
+                bits |= fft_magnitude_bits(real[index]) | fft_magnitude_bits(imag[index]);
+            }
+            return cnl::leading_bits(bits);
+        }
+    }
+
+    /// \brief powers of two by which \ref cnl::fft scales its data
+    ///
+    /// \tparam Size number of elements transformed
+    template<std::size_t Size>
+    struct fft_scaling {
+        /// number of stages of the transform; each is of radix 4, except that if log2(Size) is
+        /// odd, the first is of radix 2
+        static constexpr auto stages = _impl::fft_stages<Size>;
+
+        /// the exponent of each stage: the power of two by which its input was divided;
+        /// it is negative where the input was multiplied to use the available digits
+        std::array<int, stages> stage_exponents{};
+
+        /// the sum of \ref stage_exponents: the power of two by which the output must be
+        /// multiplied to give the discrete Fourier transform of the input
+        int exponent{0};
+    };
+
+    /// \brief computes the discrete Fourier transform of a sequence of complex numbers in place
+    ///
+    /// \param real,imag contiguous ranges of the real and imaginary parts of the elements,
+    /// e.g. `std::array<scaled_integer<int16, power<-15>>, 1024>`; their size is a power of two
+    /// which is known at compile time
+    /// \return the exponent of each stage and of the result, such that element k of the
+    /// output multiplied by 2<sup>exponent</sup> is the sum over n of element n of the input
+    /// multiplied by exp(-2 pi i k n / size)
+    ///
+    /// The transform uses block floating point. Before each stage, \ref cnl::leading_bits
+    /// of the elements determines a shift which leaves exactly enough headroom for the stage
+    /// not to overflow. Thus, large inputs are divided and small inputs are multiplied so as
+    /// to use the available digits. Products with twiddle factors and shifts are rounded to
+    /// nearest. The leading bits of the output of a stage are found as it is written.
+    ///
+    /// The twiddle factors are calculated at compile time and stored in the order in which each
+    /// stage uses them. No memory is allocated. The elements are operated on as their
+    /// fundamental integers. They are added in that integer, e.g. in 16-bit SIMD lanes, and only
+    /// their products with twiddle factors are wider, e.g. 32 bits.
+    ///
+    /// Example:
+    /// \snippet fft.cpp fft example
+    template<std::ranges::contiguous_range Real, std::ranges::contiguous_range Imag>
+    requires _impl::fft_operand<std::ranges::range_value_t<Real>>
+            && std::is_same_v<std::ranges::range_value_t<Real>, std::ranges::range_value_t<Imag>>
+            && (_impl::fft_extent<Real> != std::dynamic_extent)
+            && (_impl::fft_extent<Real> == _impl::fft_extent<Imag>)
+            && (std::has_single_bit(_impl::fft_extent<Real>))
+    auto fft(Real&& real, Imag&& imag) -> fft_scaling<_impl::fft_extent<Real>>
+    {
+        constexpr auto size = _impl::fft_extent<Real>;
+        using element = std::ranges::range_value_t<Real>;
+        using rep = _impl::fft_rep_t<element>;
+
+        auto* const real_reps = _impl::fft_reps(std::span<element>(real)).data();
+        auto* const imag_reps = _impl::fft_reps(std::span<element>(imag)).data();
+
+        auto scaling = fft_scaling<size>{};
+        auto leading_bits = _impl::fft_leading_bits(real_reps, imag_reps, size);
+        for (auto stage = std::size_t{0}; stage != scaling.stages; ++stage) {
+            // a block of zeros is left as it is
+            auto const shift = (leading_bits == digits<rep>)
+                                     ? 0
+                                     : _impl::fft_headroom(_impl::fft_radix<size>(stage)) - leading_bits;
+            leading_bits = _impl::fft_stage<size>(real_reps, imag_reps, stage, shift);
+            scaling.stage_exponents[stage] = shift;
+            scaling.exponent += shift;
+        }
+        _impl::fft_bit_reverse<size>(real_reps, imag_reps);
+        return scaling;
+    }
+}
+
+#endif  // CNL_IMPL_FFT_FFT_H
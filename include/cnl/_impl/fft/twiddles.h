@@ -0,0 +1,197 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_FFT_TWIDDLES_H)
+#define CNL_IMPL_FFT_TWIDDLES_H
+
+#include "../num_traits/digits.h"
+#include "../num_traits/set_digits.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // stages of a transform
+
+        // An FFT of Size elements is performed in stages of radix 4, each of which does the work
+        // of two radix-2 stages. If log2(Size) is odd, a stage of radix 2 comes first.
+        // The stage of radix r which begins with spans of length L combines elements L/r apart.
+
+        template<std::size_t Size>
+        inline constexpr auto fft_log2_size = std::countr_zero(Size);
+
+        template<std::size_t Size>
+        inline constexpr auto fft_stages = std::size_t{(fft_log2_size<Size> + 1) / 2};
+
+        template<std::size_t Size>
+        inline constexpr auto fft_has_radix2_stage = (fft_log2_size<Size> % 2) == 1;
+
+        template<std::size_t Size>
+        [[nodiscard]] constexpr auto fft_radix(std::size_t stage) -> std::size_t
+        {
+            return (stage == 0 && fft_has_radix2_stage<Size>) ? 2 : 4;
+        }
+
+        // length of the spans of elements transformed by the given stage
+        template<std::size_t Size>
+        [[nodiscard]] constexpr auto fft_span(std::size_t stage) -> std::size_t
+        {
+            auto span = Size;
+            for (auto previous = std::size_t{0}; previous != stage; ++previous) {
+                span /= fft_radix<Size>(previous);
+            }
+            return span;
+        }
+
+        // number of twiddle factors of the given stage: the powers 1 to radix-1 of
+        // each of the span/radix roots of unity
+        template<std::size_t Size>
+        [[nodiscard]] constexpr auto fft_stage_twiddles(std::size_t stage) -> std::size_t
+        {
+            auto const radix = fft_radix<Size>(stage);
+            return fft_span<Size>(stage) / radix * (radix - 1);
+        }
+
+        template<std::size_t Size>
+        [[nodiscard]] constexpr auto fft_twiddle_offset(std::size_t stage) -> std::size_t
+        {
+            auto offset = std::size_t{0};
+            for (auto previous = std::size_t{0}; previous != stage; ++previous) {
+                offset += fft_stage_twiddles<Size>(previous);
+            }
+            return offset;
+        }
+
+        // integer in which elements of type Rep are added and multiplied by twiddle factors
+        template<typename Rep>
+        using fft_wide_t = set_digits_t<int, std::max(digits<int>, 2 * digits<Rep> + 1)>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // compile-time trigonometry
+
+        inline constexpr auto fft_pi = 3.141592653589793238462643383279502884L;
+
+        // Taylor series which are accurate to long double precision within [-pi/4, pi/4]
+        [[nodiscard]] constexpr auto fft_sin(long double x) -> long double
+        {
+            auto term = x;
+            auto sum = x;
+            for (auto n = 2; n != 26; n += 2) {
+                term *= -x * x / static_cast<long double>(n * (n + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        [[nodiscard]] constexpr auto fft_cos(long double x) -> long double
+        {
+            auto term = 1.L;
+            auto sum = 1.L;
+            for (auto n = 1; n != 25; n += 2) {
+                term *= -x * x / static_cast<long double>(n * (n + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        // x with digits<Rep> fractional digits, rounded to nearest;
+        // the result is wider than Rep so that 1 is represented
+        template<typename Rep>
+        [[nodiscard]] constexpr auto fft_quantize(long double x) -> fft_wide_t<Rep>
+        {
+            constexpr auto scale = static_cast<long double>(fft_wide_t<Rep>{1} << digits<Rep>);
+            auto const scaled = x * scale;
+            return static_cast<fft_wide_t<Rep>>(scaled + ((scaled < 0) ? -.5L : .5L));
+        }
+
+        template<typename Rep>
+        struct fft_complex_rep {
+            fft_wide_t<Rep> real;
+            fft_wide_t<Rep> imag;
+        };
+
+        // the twiddle factor, exp(-2 pi i k / n), with digits<Rep> fractional digits;
+        // the angle is reduced to within pi/4 of a multiple of pi/2 using integer arithmetic
+        // so that those multiples are exact
+        template<typename Rep>
+        [[nodiscard]] constexpr auto fft_twiddle(std::size_t k, std::size_t n) -> fft_complex_rep<Rep>
+        {
+            auto const quadrant = (8 * k + n) / (2 * n);
+            auto const remainder = static_cast<long double>(
+                    static_cast<long long>(4 * k) - static_cast<long long>(quadrant * n));
+            auto const angle = fft_pi * remainder / static_cast<long double>(2 * n);
+            auto const c = fft_cos(angle);
+            auto const s = fft_sin(angle);
+            switch (quadrant % 4) {
+            case 0:
+                return {fft_quantize<Rep>(c), fft_quantize<Rep>(-s)};
+            case 1:
+                return {fft_quantize<Rep>(-s), fft_quantize<Rep>(-c)};
+            case 2:
+                return {fft_quantize<Rep>(-c), fft_quantize<Rep>(s)};
+            default:
+                return {fft_quantize<Rep>(s), fft_quantize<Rep>(c)};
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // twiddle tables
+
+        // The twiddle factors of each stage follow those of the previous stage. For a stage of
+        // radix r and span L, the factors, w^(p * j), of the root of unity, w = exp(-2 pi i / L),
+        // are stored in order of power, p, from 1 to r-1, then of index, j, from 0 to L/r-1,
+        // so that the factors which multiply consecutive elements are consecutive.
+        //
+        // The angles of the factors are in [0, 3 pi / 2) and never pi. Thus, the negated real
+        // parts and the imaginary parts lie in [-1, 1). Those which round to 1 are rounded down
+        // instead, so that all are represented by Rep and, in particular, -1 is exact.
+        template<typename Rep>
+        [[nodiscard]] constexpr auto fft_narrow(fft_wide_t<Rep> value) -> Rep
+        {
+            constexpr auto max = fft_wide_t<Rep>{1} << digits<Rep>;
+            return static_cast<Rep>((value == max) ? max - 1 : value);
+        }
+
+        template<typename Rep, std::size_t Size>
+        struct fft_twiddle_table {
+            static constexpr auto size = fft_twiddle_offset<Size>(fft_stages<Size>);
+
+            std::array<Rep, size> negated_real;
+            std::array<Rep, size> imag;
+        };
+
+        template<typename Rep, std::size_t Size>
+        [[nodiscard]] constexpr auto make_fft_twiddle_table()
+        {
+            auto table = fft_twiddle_table<Rep, Size>{};
+            for (auto stage = std::size_t{0}; stage != fft_stages<Size>; ++stage) {
+                auto const radix = fft_radix<Size>(stage);
+                auto const span = fft_span<Size>(stage);
+                auto const stride = span / radix;
+                auto const offset = fft_twiddle_offset<Size>(stage);
+                for (auto power = std::size_t{1}; power != radix; ++power) {
+                    for (auto j = std::size_t{0}; j != stride; ++j) {
+                        auto const twiddle = fft_twiddle<Rep>(power * j, span);
+                        auto const index = offset + (power - 1) * stride + j;
+                        table.negated_real[index] = fft_narrow<Rep>(-twiddle.real);
+                        table.imag[index] = fft_narrow<Rep>(twiddle.imag);
+                    }
+                }
+            }
+            return table;
+        }
+
+        // twiddle factors of an FFT of Size elements, each with digits<Rep> fractional digits
+        template<typename Rep, std::size_t Size>
+        inline constexpr auto fft_twiddles = make_fft_twiddle_table<Rep, Size>();
+    }
+}
+
+#endif  // CNL_IMPL_FFT_TWIDDLES_H
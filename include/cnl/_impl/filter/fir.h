@@ -0,0 +1,122 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_FILTER_FIR_H)
+#define CNL_IMPL_FILTER_FIR_H
+
+#include "../cnl_assert.h"
+#include "../linalg/dot.h"
+#include "../num_traits/unwrap.h"
+#include "../num_traits/wrap.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief finite impulse response filter
+    ///
+    /// \tparam Coeff type of the coefficients, e.g. `scaled_integer<int16, power<-15>>`
+    /// \tparam Sample type of the input samples
+    /// \tparam Taps number of coefficients
+    /// \tparam Output type of the output samples; its rounding and overflow tags determine how
+    /// the exact result is requantized
+    ///
+    /// Each output is the exact sum of the products of the coefficients and the most recent
+    /// samples, held in an \ref accumulator_type, converted to `Output` with `static_cast`.
+    /// Samples are processed in blocks. Within a block, each coefficient is multiplied with
+    /// every sample in turn, so that the inner loop is a vectorizable multiply-add of a constant.
+    ///
+    /// Example:
+    /// \snippet filter.cpp fir example
+    ///
+    /// \sa cnl::iir_filter
+    template<
+            _impl::linalg_operand Coeff, _impl::linalg_operand Sample, std::size_t Taps,
+            typename Output = Sample>
+    requires(Taps > 0) class fir_filter {
+    public:
+        /// exact sum of `Taps` products of a `Coeff` and a `Sample`
+        using accumulator_type = dot_result_t<Coeff, Sample, Taps>;
+
+        static constexpr auto taps = Taps;
+
+        /// \param coefficients the impulse response; `coefficients[0]` multiplies the latest sample
+        explicit constexpr fir_filter(std::array<Coeff, Taps> const& coefficients)
+        {
+            std::transform(
+                    coefficients.rbegin(), coefficients.rend(), begin(_coefficients),
+                    [](Coeff const& c) { return cnl::unwrap(c); });
+        }
+
+        /// filters one sample
+        [[nodiscard]] constexpr auto operator()(Sample const& in) -> Output
+        {
+            auto out = std::array<Output, 1>{};
+            process(std::span(&in, 1), out);
+            return out[0];
+        }
+
+        /// filters a sequence of samples; `in` and `out` have the same size
+        constexpr void process(std::span<Sample const> in, std::span<Output> out)
+        {
+            CNL_ASSERT(in.size() == out.size());
+            for (auto offset = std::size_t{0}; offset < in.size(); offset += block_size) {
+                auto const count = std::min(block_size, in.size() - offset);
+                process_block(in.subspan(offset, count), out.subspan(offset, count));
+            }
+        }
+
+        /// clears the history of samples, as if every previous sample was zero
+        constexpr void reset()
+        {
+            std::fill(begin(_samples), end(_samples), sample_rep{0});
+        }
+
+    private:
+        using coeff_rep = _impl::linalg_rep_t<Coeff>;
+        using sample_rep = _impl::linalg_rep_t<Sample>;
+        using product_rep = _impl::linalg_product_rep_t<Coeff, Sample>;
+        using accumulator_rep = _impl::linalg_rep_t<accumulator_type>;
+
+        static constexpr auto history = Taps - 1;
+        static constexpr auto block_size = std::size_t{256};
+
+        constexpr void process_block(std::span<Sample const> in, std::span<Output> out)
+        {
+            auto const count = in.size();
+            std::transform(begin(in), end(in), begin(_samples) + history, [](Sample const& s) {
+                return cnl::unwrap(s);
+            });
+
+            // each product is formed in the narrowest integer which holds it and only then
+            // widened, e.g. 16-bit reps are multiplied in 32-bit lanes and summed in 64-bit lanes
+            auto sums = std::array<accumulator_rep, block_size>{};
+            for (auto tap = std::size_t{0}; tap != Taps; ++tap) {
+                auto const c = static_cast<product_rep>(_coefficients[tap]);
+                auto const* const samples = _samples.data() + tap;
+                for (auto index = std::size_t{0}; index != count; ++index) {
+                    sums[index] = static_cast<accumulator_rep>(
+                            sums[index] + static_cast<product_rep>(c * static_cast<product_rep>(samples[index])));
+                }
+            }
+
+            std::transform(begin(sums), begin(sums) + count, begin(out), [](accumulator_rep sum) {
+                return static_cast<Output>(cnl::wrap<accumulator_type>(sum));
+            });
+            std::copy(begin(_samples) + count, begin(_samples) + count + history, begin(_samples));
+        }
+
+        // reversed, so that the coefficient of the oldest sample comes first
+        std::array<coeff_rep, Taps> _coefficients{};
+
+        // the last history samples of the previous block followed by the current block
+        std::array<sample_rep, history + block_size> _samples{};
+    };
+}
+
+#endif  // CNL_IMPL_FILTER_FIR_H
@@ -0,0 +1,109 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_FILTER_IIR_H)
+#define CNL_IMPL_FILTER_IIR_H
+
+#include "../cnl_assert.h"
+#include "../linalg/dot.h"
+#include "../num_traits/unwrap.h"
+#include "../num_traits/wrap.h"
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief coefficients of a biquad filter, normalized so that a<sub>0</sub> is 1
+    ///
+    /// The transfer function is (b0 + b1 z<sup>-1</sup> + b2 z<sup>-2</sup>)
+    /// / (1 + a1 z<sup>-1</sup> + a2 z<sup>-2</sup>).
+    template<typename Coeff>
+    struct biquad_coefficients {
+        Coeff b0, b1, b2;
+        Coeff a1, a2;
+    };
+
+    /// \brief infinite impulse response filter of second order, i.e. a biquad
+    ///
+    /// \tparam Coeff type of the coefficients; the feedback coefficients lie in (-2, 2), so it
+    /// needs an integer digit, e.g. `scaled_integer<int16, power<-14>>`
+    /// \tparam Sample type of the input samples
+    /// \tparam Output type of the output samples; its rounding and overflow tags determine how
+    /// the exact result is requantized
+    ///
+    /// The filter is implemented in direct form I. The feedforward and feedback sums are
+    /// calculated exactly, in types chosen as by \ref cnl::dot_result_t, and their difference
+    /// is converted to `Output` with `static_cast`. Thus, the only quantization is of the output,
+    /// which is also the value fed back.
+    ///
+    /// Example:
+    /// \snippet filter.cpp iir example
+    ///
+    /// \sa cnl::fir_filter
+    template<_impl::linalg_operand Coeff, _impl::linalg_operand Sample, _impl::linalg_operand Output = Sample>
+    class iir_filter {
+        using feedforward_type = dot_result_t<Coeff, Sample, 3>;
+        using feedback_type = dot_result_t<Coeff, Output, 2>;
+
+    public:
+        /// exact result of a biquad before it is converted to `Output`
+        using accumulator_type = decltype(std::declval<feedforward_type>() - std::declval<feedback_type>());
+
+        explicit constexpr iir_filter(biquad_coefficients<Coeff> const& coefficients)
+            : _b{cnl::unwrap(coefficients.b0), cnl::unwrap(coefficients.b1), cnl::unwrap(coefficients.b2)}
+            , _a{cnl::unwrap(coefficients.a1), cnl::unwrap(coefficients.a2)}
+        {
+        }
+
+        /// filters one sample
+        [[nodiscard]] constexpr auto operator()(Sample const& in) -> Output
+        {
+            using feedforward_rep = _impl::linalg_rep_t<feedforward_type>;
+            using feedback_rep = _impl::linalg_rep_t<feedback_type>;
+
+            auto const x0 = cnl::unwrap(in);
+            auto const feedforward = static_cast<feedforward_rep>(
+                    static_cast<feedforward_rep>(_b[0]) * x0 + static_cast<feedforward_rep>(_b[1]) * _x[0]
+                    + static_cast<feedforward_rep>(_b[2]) * _x[1]);
+            auto const feedback = static_cast<feedback_rep>(
+                    static_cast<feedback_rep>(_a[0]) * _y[0] + static_cast<feedback_rep>(_a[1]) * _y[1]);
+            auto const out = static_cast<Output>(
+                    cnl::wrap<feedforward_type>(feedforward) - cnl::wrap<feedback_type>(feedback));
+
+            _x = {x0, _x[0]};
+            _y = {cnl::unwrap(out), _y[0]};
+            return out;
+        }
+
+        /// filters a sequence of samples; `in` and `out` have the same size
+        constexpr void process(std::span<Sample const> in, std::span<Output> out)
+        {
+            CNL_ASSERT(in.size() == out.size());
+            for (auto index = std::size_t{0}; index != in.size(); ++index) {
+                out[index] = (*this)(in[index]);
+            }
+        }
+
+        /// clears the history of samples, as if every previous input and output was zero
+        constexpr void reset()
+        {
+            _x = {};
+            _y = {};
+        }
+
+    private:
+        std::array<_impl::linalg_rep_t<Coeff>, 3> _b;
+        std::array<_impl::linalg_rep_t<Coeff>, 2> _a;
+
+        // previous inputs and outputs, latest first
+        std::array<_impl::linalg_rep_t<Sample>, 2> _x{};
+        std::array<_impl::linalg_rep_t<Output>, 2> _y{};
+    };
+}
+
+#endif  // CNL_IMPL_FILTER_IIR_H
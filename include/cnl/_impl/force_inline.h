@@ -0,0 +1,23 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_FORCE_INLINE_H)
+#define CNL_IMPL_FORCE_INLINE_H
+
+#include "config.h"
+
+// CNL_FORCE_INLINE - requires that a function is inlined when CNL_FORCE_INLINE_ENABLED
+#if defined(CNL_FORCE_INLINE_ENABLED) && (defined(__clang__) || defined(__GNUC__))
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define CNL_FORCE_INLINE [[gnu::always_inline]]
+#elif defined(CNL_FORCE_INLINE_ENABLED) && defined(_MSC_VER)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define CNL_FORCE_INLINE [[msvc::forceinline]]
+#else
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define CNL_FORCE_INLINE
+#endif
+
+#endif  // CNL_IMPL_FORCE_INLINE_H
@@ -0,0 +1,59 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief points at which CNL reports events to \ref cnl::instrumentation_hook
+
+#if !defined(CNL_IMPL_INSTRUMENTATION_H)
+#define CNL_IMPL_INSTRUMENTATION_H
+
+#include "config.h"
+#include "instrumentation/events.h"
+
+#if defined(CNL_INSTRUMENTATION_ENABLED)
+#include "force_inline.h"
+#include "instrumentation/counters.h"
+
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief customization point invoked when CNL_USE_INSTRUMENTATION is enabled
+    ///
+    /// \tparam Event the kind of event, e.g. \ref cnl::instrumentation::overflow_event
+    /// \tparam Operator the operation, e.g. `cnl::_impl::add_op`
+    /// \tparam Operands the types to which the operation is applied
+    ///
+    /// By default, counts events per thread. Specialize to do otherwise.
+    ///
+    /// \sa cnl::instrumentation::snapshot
+    template<class Event, class Operator, class... Operands>
+    struct instrumentation_hook {
+        void operator()() const
+        {
+            _impl::count_instrumentation_event<Event, Operator, Operands...>();
+        }
+    };
+
+    namespace _impl {
+        template<class Event, class Operator, class... Operands>
+        CNL_FORCE_INLINE constexpr void instrument()
+        {
+            if (!std::is_constant_evaluated()) {
+                instrumentation_hook<Event, Operator, Operands...>{}();
+            }
+        }
+    }
+}
+
+// CNL_INSTRUMENT - reports an event to cnl::instrumentation_hook, given its template arguments
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define CNL_INSTRUMENT(...) ::cnl::_impl::instrument<__VA_ARGS__>()
+#else
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define CNL_INSTRUMENT(...) static_cast<void>(0)
+#endif
+
+#endif  // CNL_IMPL_INSTRUMENTATION_H
@@ -0,0 +1,140 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief per-thread counters of instrumented events
+
+#if !defined(CNL_IMPL_INSTRUMENTATION_COUNTERS_H)
+#define CNL_IMPL_INSTRUMENTATION_COUNTERS_H
+
+#include "../cstdint/types.h"
+#include "type_name.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if !defined(CNL_INSTRUMENTATION_MAX_COUNTERS)
+/// \def CNL_INSTRUMENTATION_MAX_COUNTERS
+/// \brief number of distinct (event, operation, type) keys which can be counted;
+///        further keys are counted together under an empty operation and type.
+#define CNL_INSTRUMENTATION_MAX_COUNTERS 1024  // NOLINT(cppcoreguidelines-macro-usage)
+#endif
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::instrumentation_key
+
+        // what is being counted
+        struct instrumentation_key {
+            std::string_view event;
+            std::string operation;
+            std::string type;
+        };
+
+        template<class Event, class Operator, class... Operands>
+        [[nodiscard]] auto make_instrumentation_key()
+        {
+            auto type = std::string{};
+            ((type += type.empty() ? "" : ", ", type += type_name<Operands>()), ...);
+            return instrumentation_key{Event::name, std::string{type_name<Operator>()}, type};
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::thread_instrumentation_counters
+
+        inline constexpr auto max_instrumentation_counters = int{CNL_INSTRUMENTATION_MAX_COUNTERS};
+
+        // counts of one thread; only the owning thread writes to them,
+        // so they can be incremented without read-modify-write operations
+        using instrumentation_counts = std::array<std::atomic<uint64>, max_instrumentation_counters>;
+
+        // the keys, the counters of running threads and the totals of finished threads;
+        // the mutex is only taken when a key or thread is first seen, and by snapshots
+        struct instrumentation_registry {
+            std::mutex mutex;
+            std::vector<instrumentation_key> keys{instrumentation_key{}};
+            std::vector<instrumentation_counts*> threads;
+            std::array<uint64, max_instrumentation_counters> finished{};
+        };
+
+        [[nodiscard]] inline auto get_instrumentation_registry() -> instrumentation_registry&
+        {
+            static auto registry = instrumentation_registry{};
+            return registry;
+        }
+
+        // index of a new key, or 0 if there is no room for it
+        [[nodiscard]] inline auto register_instrumentation_key(instrumentation_key key) -> int
+        {
+            auto& registry = get_instrumentation_registry();
+            auto const lock = std::lock_guard{registry.mutex};
+            if (registry.keys.size() == max_instrumentation_counters) {
+                return 0;
+            }
+            registry.keys.push_back(std::move(key));
+            return static_cast<int>(registry.keys.size() - 1);
+        }
+
+        class thread_instrumentation_counters {
+        public:
+            thread_instrumentation_counters()
+            {
+                auto& registry = get_instrumentation_registry();
+                auto const lock = std::lock_guard{registry.mutex};
+                registry.threads.push_back(&_counts);
+            }
+
+            thread_instrumentation_counters(thread_instrumentation_counters const&) = delete;
+            thread_instrumentation_counters(thread_instrumentation_counters&&) = delete;
+            auto operator=(thread_instrumentation_counters const&) -> thread_instrumentation_counters& = delete;
+            auto operator=(thread_instrumentation_counters&&) -> thread_instrumentation_counters& = delete;
+
+            ~thread_instrumentation_counters()
+            {
+                auto& registry = get_instrumentation_registry();
+                auto const lock = std::lock_guard{registry.mutex};
+                for (auto index = 0; index != max_instrumentation_counters; ++index) {
+                    registry.finished[index] += _counts[index].load(std::memory_order_relaxed);
+                }
+                registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), &_counts));
+            }
+
+            void increment(int index)
+            {
+                auto& count = _counts[index];
+                count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+
+        private:
+            instrumentation_counts _counts{};
+        };
+
+        [[nodiscard]] inline auto this_thread_instrumentation_counters() -> thread_instrumentation_counters&
+        {
+            thread_local auto counters = thread_instrumentation_counters{};
+            return counters;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::count_instrumentation_event
+
+        template<class Event, class Operator, class... Operands>
+        void count_instrumentation_event()
+        {
+            static auto const index = register_instrumentation_key(
+                    make_instrumentation_key<Event, Operator, Operands...>());
+            this_thread_instrumentation_counters().increment(index);
+        }
+    }
+}
+
+#endif  // CNL_IMPL_INSTRUMENTATION_COUNTERS_H
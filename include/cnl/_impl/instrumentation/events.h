@@ -0,0 +1,41 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief events reported to \ref cnl::instrumentation_hook
+
+#if !defined(CNL_IMPL_INSTRUMENTATION_EVENTS_H)
+#define CNL_IMPL_INSTRUMENTATION_EVENTS_H
+
+#include <string_view>
+
+/// compositional numeric library, instrumentation namespace
+namespace cnl::instrumentation {
+    /// \brief event reported when an operator is applied to a CNL type
+    /// \headerfile cnl/instrumentation.h
+    struct operation_event {
+        static constexpr std::string_view name{"operation"};
+    };
+
+    /// \brief event reported when an overflow tag handles an out-of-range result
+    /// \headerfile cnl/instrumentation.h
+    struct overflow_event {
+        static constexpr std::string_view name{"overflow"};
+    };
+
+    /// \brief event reported when a rounding tag rounds a value which loses precision
+    /// \headerfile cnl/instrumentation.h
+    struct rounding_event {
+        static constexpr std::string_view name{"rounding"};
+    };
+
+    /// \brief event reported when an operation takes a slow path, e.g. long division of wide integers
+    /// \headerfile cnl/instrumentation.h
+    struct slow_path_event {
+        static constexpr std::string_view name{"slow_path"};
+    };
+}
+
+#endif  // CNL_IMPL_INSTRUMENTATION_EVENTS_H
@@ -0,0 +1,55 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_INSTRUMENTATION_TYPE_NAME_H)
+#define CNL_IMPL_INSTRUMENTATION_TYPE_NAME_H
+
+#include <string_view>
+
+// signature of a function which names T; the function is declared outside of namespace cnl
+// because GCC omits the namespaces which a type shares with the function from its name
+template<typename T>
+[[nodiscard]] constexpr auto cnl_impl_type_name_signature() -> std::string_view
+{
+#if defined(__clang__) || defined(__GNUC__)
+    return std::string_view{__PRETTY_FUNCTION__};
+#elif defined(_MSC_VER)
+    return std::string_view{__FUNCSIG__};
+#else
+    return std::string_view{};
+#endif
+}
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::type_name
+
+        // human-readable name of T, extracted from the signature of a function
+        // so that RTTI is not required
+        template<typename T>
+        [[nodiscard]] constexpr auto type_name() -> std::string_view
+        {
+            constexpr auto signature = cnl_impl_type_name_signature<T>();
+#if defined(__clang__) || defined(__GNUC__)
+            // e.g. "... cnl_impl_type_name_signature() [with T = int; std::string_view = ...]"
+            // or "... cnl_impl_type_name_signature() [T = int]"
+            constexpr auto first = signature.find("T = ") + 4;
+            constexpr auto last = signature.find_first_of(";]", first);
+            return signature.substr(first, last - first);
+#elif defined(_MSC_VER)
+            // e.g. "class std::basic_string_view<...> __cdecl cnl_impl_type_name_signature<int>(void)"
+            constexpr auto first = signature.find("type_name_signature<") + 20;
+            constexpr auto last = signature.rfind(">(void)");
+            return signature.substr(first, last - first);
+#else
+            return "unknown";
+#endif
+        }
+    }
+}
+
+#endif  // CNL_IMPL_INSTRUMENTATION_TYPE_NAME_H
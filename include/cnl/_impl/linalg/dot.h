@@ -0,0 +1,163 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_LINALG_DOT_H)
+#define CNL_IMPL_LINALG_DOT_H
+
+#include "../cnl_assert.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/max_digits.h"
+#include "../num_traits/set_digits.h"
+#include "../num_traits/unwrap.h"
+#include "../num_traits/wrap.h"
+#include "../numbers/signedness.h"
+#include "../type_traits/is_integral.h"
+#include "../type_traits/remove_cvref.h"
+#include "../used_digits.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // accumulator selection
+
+        // fundamental integer which represents a number
+        template<typename T>
+        using linalg_rep_t = remove_cvref_t<decltype(cnl::unwrap(std::declval<T>()))>;
+
+        // numbers whose products are the products of their fundamental integers,
+        // e.g. integers, scaled_integer and elastic_integer
+        template<typename T>
+        concept linalg_operand = integral<linalg_rep_t<T>> && requires(T const& a)
+        {
+            a* a;
+        };
+
+        template<typename A, typename B>
+        using linalg_product_t = decltype(std::declval<A>() * std::declval<B>());
+
+        // digits needed to hold any product of an A and a B;
+        // unlike elastic_integer, this counts the product of two most negative values
+        template<typename A, typename B>
+        inline constexpr auto linalg_product_digits =
+                digits<A> + digits<B> + ((numbers::signedness_v<A> && numbers::signedness_v<B>) ? 1 : 0);
+
+        // narrowest fundamental integer which holds any product of an A and a B
+        template<typename A, typename B>
+        using linalg_product_rep_t = set_digits_t<int, linalg_product_digits<A, B>>;
+
+        // digits needed to hold any sum of Terms products of an A and a B
+        template<typename A, typename B, std::size_t Terms>
+        inline constexpr auto linalg_sum_digits =
+                linalg_product_digits<A, B> + ((Terms > 1) ? used_digits(Terms - 1) : 0);
+
+        // number of terms assumed when the length of a dot product is not known at compile time
+        inline constexpr auto linalg_dynamic_terms = std::size_t{1} << 31;
+
+        // fundamental integer which accumulates a chunk of products: the narrowest which is at
+        // least as wide as int and which holds at least 256 products
+        template<typename A, typename B>
+        using linalg_chunk_t = set_digits_t<
+                int, std::max(digits<int>, linalg_product_digits<A, B> + digits<uint8>)>;
+
+        template<typename A, typename B>
+        inline constexpr auto linalg_chunk_terms =
+                std::size_t{1} << (digits<linalg_chunk_t<A, B>> - linalg_product_digits<A, B>);
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // kernels
+
+        // sum of the products of the fundamental integers of a and b;
+        // the conversions before the multiplication let compilers emit widening multiply-add
+        // instructions such as pmaddwd, vpdpbusd or sdot
+        template<integral Accumulator, typename A, typename B>
+        [[nodiscard]] constexpr auto dot_kernel(A const* a, B const* b, std::size_t size) -> Accumulator
+        {
+            auto sum = Accumulator{0};
+            for (auto index = std::size_t{0}; index != size; ++index) {
+                sum = static_cast<Accumulator>(
+                        sum + static_cast<Accumulator>(cnl::unwrap(a[index]))
+                                      * static_cast<Accumulator>(cnl::unwrap(b[index])));
+            }
+            return sum;
+        }
+
+        // as dot_kernel but accumulates at most linalg_chunk_terms products in a chunk accumulator
+        // before adding them to a wider total
+        template<integral Total, typename A, typename B>
+        [[nodiscard]] constexpr auto dot_chunked(A const* a, B const* b, std::size_t size) -> Total
+        {
+            using chunk = linalg_chunk_t<A, B>;
+            if constexpr (digits<chunk> >= digits<Total>) {
+                return dot_kernel<Total>(a, b, size);
+            } else {
+                auto total = Total{0};
+                for (auto offset = std::size_t{0}; offset < size; offset += linalg_chunk_terms<A, B>) {
+                    total = static_cast<Total>(
+                            total + dot_kernel<chunk>(
+                                    a + offset, b + offset,
+                                    std::min(linalg_chunk_terms<A, B>, size - offset)));
+                }
+                return total;
+            }
+        }
+
+        template<typename Range>
+        inline constexpr auto linalg_extent = decltype(std::span(std::declval<Range&>()))::extent;
+
+        template<typename RangeA, typename RangeB>
+        inline constexpr auto linalg_terms =
+                (linalg_extent<RangeA> != std::dynamic_extent) ? linalg_extent<RangeA>
+                : (linalg_extent<RangeB> != std::dynamic_extent) ? linalg_extent<RangeB>
+                                                                 : linalg_dynamic_terms;
+    }
+
+    /// \brief type of the result of \ref cnl::dot of Terms elements of type A and B
+    ///
+    /// The type of the product of an A and a B, with enough digits to hold the sum of Terms
+    /// products without overflow.
+    template<_impl::linalg_operand A, _impl::linalg_operand B, std::size_t Terms>
+    requires(_impl::linalg_sum_digits<A, B, Terms> <= _impl::max_digits<_impl::linalg_rep_t<_impl::linalg_product_t<A, B>>>)
+    using dot_result_t = set_digits_t<_impl::linalg_product_t<A, B>, _impl::linalg_sum_digits<A, B, Terms>>;
+
+    /// \brief dot product of two ranges of numbers
+    ///
+    /// \param a,b contiguous ranges of the same size, e.g. of \ref cnl::scaled_integer
+    /// \return the exact sum of the products of the elements of `a` and `b` as a
+    /// \ref cnl::dot_result_t
+    ///
+    /// If the size of either range is known at compile time, the result is just wide enough to
+    /// hold the sum of that many products. Otherwise, it is wide enough for 2<sup>31</sup>.
+    /// Products are summed in the narrowest integer no narrower than `int` which holds at least
+    /// 256 of them and these partial sums are then added to a result of the wider type. Thus, the
+    /// products of 8-bit reps are summed in 32-bit lanes.
+    ///
+    /// Example:
+    /// \snippet linalg.cpp dot example
+    ///
+    /// \sa cnl::gemm
+    template<std::ranges::contiguous_range RangeA, std::ranges::contiguous_range RangeB>
+    requires _impl::linalg_operand<std::ranges::range_value_t<RangeA>> && _impl::linalg_operand<std::ranges::range_value_t<RangeB>>
+    [[nodiscard]] constexpr auto dot(RangeA const& a, RangeB const& b)
+    {
+        using element_a = std::ranges::range_value_t<RangeA>;
+        using element_b = std::ranges::range_value_t<RangeB>;
+        using result = dot_result_t<element_a, element_b, _impl::linalg_terms<RangeA, RangeB>>;
+
+        CNL_ASSERT(std::ranges::size(a) == std::ranges::size(b));
+        CNL_ASSERT((std::ranges::size(a) <= _impl::linalg_terms<RangeA, RangeB>));
+        return cnl::wrap<result>(_impl::dot_chunked<_impl::linalg_rep_t<result>>(
+                std::ranges::data(a), std::ranges::data(b), std::ranges::size(a)));
+    }
+}
+
+#endif  // CNL_IMPL_LINALG_DOT_H
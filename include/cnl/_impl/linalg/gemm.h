@@ -0,0 +1,129 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_LINALG_GEMM_H)
+#define CNL_IMPL_LINALG_GEMM_H
+
+#include "../cnl_assert.h"
+#include "../cstdint/types.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/unwrap.h"
+#include "../num_traits/wrap.h"
+#include "dot.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // columns of b which are multiplied with each row of a while they are in cache
+        inline constexpr auto gemm_block_columns = std::size_t{64};
+
+        // elements of each row of a and column of b which are multiplied together while in cache
+        template<typename A, typename B>
+        inline constexpr auto gemm_block_depth = std::min(std::size_t{256}, linalg_chunk_terms<A, B>);
+
+        // integer in which the elements of a and b are multiplied; 16-bit if possible, because
+        // compilers recognize sums of products of 16-bit integers as pmaddwd, vpdpwssd or smlal
+        template<typename A, typename B>
+        using gemm_multiplicand_t = std::conditional_t<
+                (std::max(digits<A>, digits<B>) <= digits<int16>), int16, linalg_chunk_t<A, B>>;
+    }
+
+    /// \brief multiplies two row-major matrices of numbers
+    ///
+    /// \param a an `m` by `k` matrix stored as a contiguous range in row-major order
+    /// \param b a `k` by `n` matrix stored as a contiguous range in row-major order
+    /// \param c an `m` by `n` matrix to which the product of `a` and `b` is written
+    /// \param m,n,k dimensions of the matrices
+    ///
+    /// Each element of the product is calculated exactly as by \ref cnl::dot and then converted
+    /// to the element type of `c` with `static_cast`. Thus, the product is requantized by the
+    /// rounding and overflow tags of `c`, e.g. `scaled_integer<rounding_integer<int8>, power<-7>>`
+    /// rounds to nearest.
+    ///
+    /// Blocks of the rows of `a` and of the columns of `b` are copied into buffers of integers,
+    /// the columns in column-major order. Every row in the buffer is then multiplied with every
+    /// column in the buffer while both remain in cache. Elements of 16 bits or fewer are widened
+    /// to 16 bits in the buffers, so that the multiplications compile to pmaddwd, vpdpwssd or
+    /// smlal instructions.
+    ///
+    /// Example:
+    /// \snippet linalg.cpp gemm example
+    ///
+    /// \sa cnl::dot
+    template<
+            std::ranges::contiguous_range RangeA, std::ranges::contiguous_range RangeB,
+            std::ranges::contiguous_range RangeC>
+    requires _impl::linalg_operand<std::ranges::range_value_t<RangeA>> && _impl::linalg_operand<std::ranges::range_value_t<RangeB>>
+    void gemm(RangeA const& a, RangeB const& b, RangeC&& c, std::size_t m, std::size_t n, std::size_t k)
+    {
+        using element_a = std::ranges::range_value_t<RangeA>;
+        using element_b = std::ranges::range_value_t<RangeB>;
+        using element_c = std::ranges::range_value_t<RangeC>;
+        using result = dot_result_t<element_a, element_b, _impl::linalg_dynamic_terms>;
+        using total = _impl::linalg_rep_t<result>;
+        using chunk = _impl::linalg_chunk_t<element_a, element_b>;
+        using multiplicand = _impl::gemm_multiplicand_t<element_a, element_b>;
+
+        CNL_ASSERT(std::ranges::size(a) == m * k);
+        CNL_ASSERT(std::ranges::size(b) == k * n);
+        CNL_ASSERT(std::ranges::size(c) == m * n);
+        CNL_ASSERT(k <= _impl::linalg_dynamic_terms);
+
+        constexpr auto block_columns = _impl::gemm_block_columns;
+        constexpr auto block_depth = _impl::gemm_block_depth<element_a, element_b>;
+        auto const* const data_a = std::ranges::data(a);
+        auto const* const data_b = std::ranges::data(b);
+        auto* const data_c = std::ranges::data(c);
+
+        auto panel_a = std::vector<multiplicand>(m * block_depth);
+        auto panel_b = std::vector<multiplicand>(block_columns * block_depth);
+        auto totals = std::vector<total>(m * block_columns);
+        for (auto first_column = std::size_t{0}; first_column < n; first_column += block_columns) {
+            auto const columns = std::min(block_columns, n - first_column);
+            std::fill(begin(totals), end(totals), total{0});
+
+            for (auto first_row_b = std::size_t{0}; first_row_b < k; first_row_b += block_depth) {
+                auto const depth = std::min(block_depth, k - first_row_b);
+                for (auto row = std::size_t{0}; row != m; ++row) {
+                    auto const* const source = data_a + row * k + first_row_b;
+                    for (auto column = std::size_t{0}; column != depth; ++column) {
+                        panel_a[row * depth + column] = static_cast<multiplicand>(cnl::unwrap(source[column]));
+                    }
+                }
+                for (auto row = std::size_t{0}; row != depth; ++row) {
+                    auto const* const source = data_b + (first_row_b + row) * n + first_column;
+                    for (auto column = std::size_t{0}; column != columns; ++column) {
+                        panel_b[column * depth + row] = static_cast<multiplicand>(cnl::unwrap(source[column]));
+                    }
+                }
+
+                for (auto row = std::size_t{0}; row != m; ++row) {
+                    auto const* const row_a = panel_a.data() + row * depth;
+                    auto* const row_totals = totals.data() + row * block_columns;
+                    for (auto column = std::size_t{0}; column != columns; ++column) {
+                        row_totals[column] = static_cast<total>(
+                                row_totals[column]
+                                + _impl::dot_kernel<chunk>(row_a, panel_b.data() + column * depth, depth));
+                    }
+                }
+            }
+
+            for (auto row = std::size_t{0}; row != m; ++row) {
+                for (auto column = std::size_t{0}; column != columns; ++column) {
+                    data_c[row * n + first_column + column] = static_cast<element_c>(
+                            cnl::wrap<result>(totals[row * block_columns + column]));
+                }
+            }
+        }
+    }
+}
+
+#endif  // CNL_IMPL_LINALG_GEMM_H
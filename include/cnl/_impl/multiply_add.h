@@ -0,0 +1,133 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_MULTIPLY_ADD_H)
+#define CNL_IMPL_MULTIPLY_ADD_H
+
+#include "config.h"
+#include "num_traits/digits.h"
+#include "num_traits/max_digits.h"
+#include "num_traits/set_digits.h"
+#include "numbers/signedness.h"
+#include "type_traits/is_integral.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::exact_multiply_add
+
+        // digits needed to hold any value of a * b + c
+        template<typename A, typename B, typename C>
+        inline constexpr auto multiply_add_digits =
+                (numbers::signedness_v<C> || std::max(digits<A>, digits<B>) < digits<C>)
+                        ? std::max(digits<A> + digits<B>, digits<C>) + 1
+                        : digits<A> + digits<B>;
+
+        // calculates a * b + c without loss in a type wide enough to hold the result;
+        // specialized for types where such a type exists
+        template<typename A, typename B, typename C>
+        struct exact_multiply_add;
+
+        template<typename A, typename B, typename C>
+        concept exactly_multiply_addable = requires(A const& a, B const& b, C const& c)
+        {
+            exact_multiply_add<A, B, C>{}(a, b, c);
+        };
+
+        template<integral A, integral B, integral C>
+        requires(numbers::signedness_v<A> == numbers::signedness_v<B>
+                 && numbers::signedness_v<B> == numbers::signedness_v<C>
+                 && multiply_add_digits<A, B, C> <= max_digits<C>) struct exact_multiply_add<A, B, C> {
+            using result_type = set_digits_t<
+                    decltype(std::declval<A>() * std::declval<B>() + std::declval<C>()),
+                    multiply_add_digits<A, B, C>>;
+
+            [[nodiscard]] constexpr auto operator()(A const& a, B const& b, C const& c) const
+                    -> result_type
+            {
+                return static_cast<result_type>(static_cast<result_type>(a) * static_cast<result_type>(b) + c);
+            }
+        };
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // cnl::multiply_add
+
+    /// \brief customization point for \ref cnl::fma
+    ///
+    /// Specializations calculate `a * b + c` and return a value of the same type.
+    /// Where possible, the product is kept at full width so that only the final result
+    /// is narrowed, checked for overflow or rounded.
+    template<typename A, typename B, typename C>
+    struct multiply_add {
+        [[nodiscard]] constexpr auto operator()(A const& a, B const& b, C const& c) const
+        {
+            return a * b + c;
+        }
+    };
+
+    template<_impl::integral A, _impl::integral B, _impl::integral C>
+    requires _impl::exactly_multiply_addable<A, B, C> struct multiply_add<A, B, C> {
+        using _result_type = decltype(std::declval<A>() * std::declval<B>() + std::declval<C>());
+
+        [[nodiscard]] constexpr auto operator()(A const& a, B const& b, C const& c) const
+                -> _result_type
+        {
+            return static_cast<_result_type>(_impl::exact_multiply_add<A, B, C>{}(a, b, c));
+        }
+    };
+
+#if defined(CNL_GCC_INTRINSICS_ENABLED)
+    template<>
+    struct multiply_add<float, float, float> {
+        [[nodiscard]] constexpr auto operator()(float a, float b, float c) const
+        {
+            return __builtin_fmaf(a, b, c);
+        }
+    };
+
+    template<>
+    struct multiply_add<double, double, double> {
+        [[nodiscard]] constexpr auto operator()(double a, double b, double c) const
+        {
+            return __builtin_fma(a, b, c);
+        }
+    };
+
+    template<>
+    struct multiply_add<long double, long double, long double> {
+        [[nodiscard]] constexpr auto operator()(long double a, long double b, long double c) const
+        {
+            return __builtin_fmal(a, b, c);
+        }
+    };
+#endif
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // cnl::fma
+
+    /// \brief fused multiply-add
+    ///
+    /// \return `a * b + c`, calculated without overflow or rounding of the intermediate product
+    /// where the operand types allow it
+    ///
+    /// \note For \ref cnl::overflow_integer and for \ref cnl::scaled_integer of it,
+    /// overflow is detected once, in the final result, rather than in each operation.
+    ///
+    /// \headerfile cnl/cmath.h
+    /// \sa cnl::multiply_add
+    template<typename A, typename B, typename C>
+    [[nodiscard]] constexpr auto fma(A const& a, B const& b, C const& c)
+    {
+        return multiply_add<A, B, C>{}(a, b, c);
+    }
+}
+
+#endif  // CNL_IMPL_MULTIPLY_ADD_H
@@ -7,6 +7,7 @@
 #if !defined(CNL_IMPL_NUM_TRAITS_FROM_REP_H)
 #define CNL_IMPL_NUM_TRAITS_FROM_REP_H
 
+#include "../force_inline.h"
 #include "../type_traits/is_integral.h"
 
 namespace cnl {
@@ -28,7 +29,7 @@ namespace cnl {
     /// \sa to_rep, from_value
     template<_impl::integral Number, typename Rep>
     struct from_rep<Number, Rep> {
-        [[nodiscard]] constexpr auto operator()(Rep const& rep) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Rep const& rep) const
         {
             // by default, a number type's rep type is the number type itself
             return static_cast<Number>(rep);
@@ -37,7 +38,7 @@ namespace cnl {
 
     namespace _impl {
         template<class Number, class Rep>
-        [[nodiscard]] constexpr auto from_rep(Rep const& rep)
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto from_rep(Rep const& rep)
         {
             return cnl::from_rep<Number, Rep>{}(rep);
         }
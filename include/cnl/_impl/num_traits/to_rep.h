@@ -8,6 +8,7 @@
 #define CNL_IMPL_NUM_TRAITS_TO_REP_H
 
 #include "../../constant.h"
+#include "../force_inline.h"
 #include "../type_traits/is_integral.h"
 #include "../type_traits/remove_cvref.h"
 
@@ -18,15 +19,15 @@ namespace cnl {
     namespace _impl {
         template<typename Number>
         struct default_to_rep {
-            [[nodiscard]] constexpr auto& operator()(Number& n) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto& operator()(Number& n) const
             {
                 return n;
             };
-            [[nodiscard]] constexpr auto const& operator()(Number const& n) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto const& operator()(Number const& n) const
             {
                 return n;
             };
-            [[nodiscard]] constexpr auto&& operator()(Number&& n) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto&& operator()(Number&& n) const
             {
                 return std::forward<Number>(n);
             };
@@ -49,7 +50,7 @@ namespace cnl {
 
     namespace _impl {
         template<class Number>
-        [[nodiscard]] constexpr auto to_rep(Number&& n)  // NOLINT(misc-unused-parameters)
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto to_rep(Number&& n)  // NOLINT(misc-unused-parameters)
                 -> decltype(cnl::to_rep<remove_cvref_t<Number>>()(std::forward<Number>(n)))
         {
             return cnl::to_rep<remove_cvref_t<Number>>()(std::forward<Number>(n));
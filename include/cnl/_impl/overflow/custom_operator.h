@@ -8,6 +8,9 @@
 #define CNL_IMPL_OVERFLOW_GENERIC_H
 
 #include "../custom_operator/definition.h"
+#include "../custom_operator/flat_operator.h"
+#include "../force_inline.h"
+#include "../instrumentation.h"
 #include "../polarity.h"
 #include "builtin_overflow.h"
 #include "is_overflow.h"
@@ -47,18 +50,20 @@ namespace cnl {
     requires(_impl::is_overflow_tag<DestTag>::value || _impl::is_overflow_tag<SrcTag>::value) struct custom_operator<_impl::convert_op, op_value<Source, SrcTag>, op_value<Destination, DestTag>> {
         using overflow_tag = _impl::common_overflow_tag_t<DestTag, SrcTag>;
 
-        [[nodiscard]] constexpr auto operator()(Source const& from) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Source const& from) const
         {
             return _impl::is_overflow<_impl::convert_op, _impl::polarity::positive>{}
                                    .template operator()<Destination>(from)
-                         ? _impl::overflow_operator<
-                                   _impl::convert_op, overflow_tag, _impl::polarity::positive>{}
-                                   .template operator()<Destination>(from)
+                         ? (CNL_INSTRUMENT(cnl::instrumentation::overflow_event, _impl::convert_op, Source, Destination),
+                            _impl::overflow_operator<
+                                    _impl::convert_op, overflow_tag, _impl::polarity::positive>{}
+                                    .template operator()<Destination>(from))
                  : _impl::is_overflow<_impl::convert_op, _impl::polarity::negative>{}
                                    .template operator()<Destination>(from)
-                         ? _impl::overflow_operator<
-                                   _impl::convert_op, overflow_tag, _impl::polarity::negative>{}
-                                   .template operator()<Destination>(from)
+                         ? (CNL_INSTRUMENT(cnl::instrumentation::overflow_event, _impl::convert_op, Source, Destination),
+                            _impl::overflow_operator<
+                                    _impl::convert_op, overflow_tag, _impl::polarity::negative>{}
+                                    .template operator()<Destination>(from))
                          : static_cast<Destination>(from);
         }
     };
@@ -66,15 +71,17 @@ namespace cnl {
 
     template<_impl::unary_arithmetic_op Operator, typename Operand, overflow_tag Tag>
     struct custom_operator<Operator, op_value<Operand, Tag>> {
-        [[nodiscard]] constexpr auto operator()(Operand const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Operand const& rhs) const
                 -> _impl::op_result<Operator, Operand>
         {
             return _impl::is_overflow<Operator, _impl::polarity::positive>{}(rhs)
-                         ? _impl::overflow_operator<
-                                 Operator, Tag, _impl::polarity::positive>{}(rhs)
+                         ? (CNL_INSTRUMENT(cnl::instrumentation::overflow_event, Operator, Operand),
+                            _impl::overflow_operator<
+                                    Operator, Tag, _impl::polarity::positive>{}(rhs))
                  : _impl::is_overflow<Operator, _impl::polarity::negative>{}(rhs)
-                         ? _impl::overflow_operator<
-                                 Operator, Tag, _impl::polarity::negative>{}(rhs)
+                         ? (CNL_INSTRUMENT(cnl::instrumentation::overflow_event, Operator, Operand),
+                            _impl::overflow_operator<
+                                    Operator, Tag, _impl::polarity::negative>{}(rhs))
                          : Operator{}(rhs);
         }
     };
@@ -84,13 +91,15 @@ namespace cnl {
     requires _impl::builtin_overflow_operator<Operator, Lhs, Rhs>::value struct custom_operator<Operator, op_value<Lhs, LhsTag>, op_value<Rhs, RhsTag>> {
         using result_type = _impl::op_result<Operator, Lhs, Rhs>;
 
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const -> result_type
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const -> result_type
         {
             result_type result{};
             if (!_impl::builtin_overflow_operator<Operator, Lhs, Rhs>{}(lhs, rhs, result)) {
                 return result;
             }
 
+            CNL_INSTRUMENT(cnl::instrumentation::overflow_event, Operator, Lhs, Rhs);
+
             switch (_impl::overflow_polarity<Operator>{}(lhs, rhs)) {
             case _impl::polarity::positive:
                 return _impl::overflow_operator<
@@ -109,40 +118,44 @@ namespace cnl {
 
     template<_impl::binary_arithmetic_op Operator, typename Lhs, overflow_tag LhsTag, typename Rhs, overflow_tag RhsTag>
     requires(!_impl::builtin_overflow_operator<Operator, Lhs, Rhs>::value) struct custom_operator<Operator, op_value<Lhs, LhsTag>, op_value<Rhs, RhsTag>> {
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
         {
             return _impl::is_overflow<Operator, _impl::polarity::positive>{}(lhs, rhs)
-                         ? _impl::overflow_operator<
-                                 Operator, _impl::common_overflow_tag_t<LhsTag, RhsTag>,
-                                 _impl::polarity::positive>{}(lhs, rhs)
+                         ? (CNL_INSTRUMENT(cnl::instrumentation::overflow_event, Operator, Lhs, Rhs),
+                            _impl::overflow_operator<
+                                    Operator, _impl::common_overflow_tag_t<LhsTag, RhsTag>,
+                                    _impl::polarity::positive>{}(lhs, rhs))
                  : _impl::is_overflow<Operator, _impl::polarity::negative>{}(lhs, rhs)
-                         ? _impl::overflow_operator<
-                                 Operator, _impl::common_overflow_tag_t<LhsTag, RhsTag>,
-                                 _impl::polarity::negative>{}(lhs, rhs)
-                         : Operator{}(lhs, rhs);
+                         ? (CNL_INSTRUMENT(cnl::instrumentation::overflow_event, Operator, Lhs, Rhs),
+                            _impl::overflow_operator<
+                                    Operator, _impl::common_overflow_tag_t<LhsTag, RhsTag>,
+                                    _impl::polarity::negative>{}(lhs, rhs))
+                         : _impl::flat_operator_t<Operator, Lhs, Rhs>{}(lhs, rhs);
         }
     };
 
     template<_impl::shift_op Operator, typename Lhs, overflow_tag LhsTag, typename Rhs, tag RhsTag>
     struct custom_operator<Operator, op_value<Lhs, LhsTag>, op_value<Rhs, RhsTag>> {
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
                 -> _impl::op_result<Operator, Lhs, Rhs>
         {
             return _impl::is_overflow<Operator, _impl::polarity::positive>{}(lhs, rhs)
-                         ? _impl::overflow_operator<
-                                 Operator, _impl::common_overflow_tag_t<LhsTag, RhsTag>,
-                                 _impl::polarity::positive>{}(lhs, rhs)
+                         ? (CNL_INSTRUMENT(cnl::instrumentation::overflow_event, Operator, Lhs, Rhs),
+                            _impl::overflow_operator<
+                                    Operator, _impl::common_overflow_tag_t<LhsTag, RhsTag>,
+                                    _impl::polarity::positive>{}(lhs, rhs))
                  : _impl::is_overflow<Operator, _impl::polarity::negative>{}(lhs, rhs)
-                         ? _impl::overflow_operator<
-                                 Operator, _impl::common_overflow_tag_t<LhsTag, RhsTag>,
-                                 _impl::polarity::negative>{}(lhs, rhs)
-                         : Operator{}(lhs, rhs);
+                         ? (CNL_INSTRUMENT(cnl::instrumentation::overflow_event, Operator, Lhs, Rhs),
+                            _impl::overflow_operator<
+                                    Operator, _impl::common_overflow_tag_t<LhsTag, RhsTag>,
+                                    _impl::polarity::negative>{}(lhs, rhs))
+                         : _impl::flat_operator_t<Operator, Lhs, Rhs>{}(lhs, rhs);
         }
     };
 
     template<_impl::prefix_op Operator, typename Rhs, overflow_tag OverflowTag>
     struct custom_operator<Operator, op_value<Rhs, OverflowTag>> {
-        constexpr auto operator()(Rhs& rhs) const -> Rhs
+        CNL_FORCE_INLINE constexpr auto operator()(Rhs& rhs) const -> Rhs
         {
             return custom_operator<
                     typename _impl::pre_to_assign<Operator>::type,
@@ -153,7 +166,7 @@ namespace cnl {
 
     template<_impl::postfix_op Operator, typename Rhs, overflow_tag OverflowTag>
     struct custom_operator<Operator, op_value<Rhs, OverflowTag>> {
-        constexpr auto operator()(Rhs& rhs) const -> Rhs
+        CNL_FORCE_INLINE constexpr auto operator()(Rhs& rhs) const -> Rhs
         {
             auto copy = rhs;
             custom_operator<
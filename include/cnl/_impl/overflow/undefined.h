@@ -8,6 +8,7 @@
 #define CNL_IMPL_OVERFLOW_UNDEFINED_H
 
 #include "../custom_operator/homogeneous_operator_tag_base.h"
+#include "../force_inline.h"
 #include "../polarity.h"
 #include "../unreachable.h"
 #include "is_overflow_tag.h"
@@ -43,13 +44,13 @@ namespace cnl {
         template<typename Operator>
         struct overflow_operator<Operator, undefined_overflow_tag, polarity::positive> {
             template<typename Destination, typename Source>
-            [[nodiscard]] constexpr auto operator()(Source const&) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Source const&) const
             {
                 return unreachable<Destination>("positive overflow");
             }
 
             template<class... Operands>
-            [[nodiscard]] constexpr auto operator()(
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(
                     Operands const&...) const
             {
                 return unreachable<op_result<Operator, Operands...>>("positive overflow");
@@ -59,13 +60,13 @@ namespace cnl {
         template<typename Operator>
         struct overflow_operator<Operator, undefined_overflow_tag, polarity::negative> {
             template<typename Destination, typename Source>
-            [[nodiscard]] constexpr auto operator()(Source const&) const
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Source const&) const
             {
                 return unreachable<Destination>("negative overflow");
             }
 
             template<class... Operands>
-            [[nodiscard]] constexpr auto operator()(
+            [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(
                     Operands const&...) const
             {
                 return unreachable<op_result<Operator, Operands...>>("negative overflow");
@@ -0,0 +1,155 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_PACKED_ARRAY_H)
+#define CNL_IMPL_PACKED_ARRAY_H
+
+#include "../cnl_assert.h"
+#include "bits.h"
+#include "iterator.h"
+#include "reference.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <span>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief fixed-size array which stores each element in exactly as many bits as its type needs
+    ///
+    /// \tparam T the element type, e.g. \ref cnl::elastic_integer or \ref cnl::static_integer
+    /// \tparam N the number of elements
+    ///
+    /// Each element occupies \ref cnl::digits plus one sign bit if it is signed. Elements are
+    /// stored contiguously, least significant bit first, in 64-bit words followed by one word of
+    /// padding. Elements are accessed through proxy references.
+    ///
+    /// \sa cnl::packed_vector, cnl::pack, cnl::unpack
+    template<_impl::packable T, std::size_t N>
+    class packed_array {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = _impl::packed_reference<T>;
+        using const_reference = T;
+        using iterator = _impl::packed_iterator<T, false>;
+        using const_iterator = _impl::packed_iterator<T, true>;
+
+        /// number of bits occupied by each element
+        static constexpr int element_width = _impl::width<T>;
+
+        /// zero-initializes the elements
+        constexpr packed_array() = default;
+
+        /// initializes the leading elements with the given values and the rest with zero
+        constexpr packed_array(std::initializer_list<T> values)
+        {
+            CNL_ASSERT(values.size() <= N);
+            std::copy(values.begin(), values.end(), begin());
+        }
+
+        [[nodiscard]] static constexpr auto size() -> size_type
+        {
+            return N;
+        }
+
+        [[nodiscard]] static constexpr auto empty()
+        {
+            return N == 0;
+        }
+
+        [[nodiscard]] constexpr auto operator[](size_type index) -> reference
+        {
+            return reference{_words.data(), index};
+        }
+
+        [[nodiscard]] constexpr auto operator[](size_type index) const -> const_reference
+        {
+            return _impl::packed_value_from_bits<T, T>(_impl::packed_read_bits<T>(_words.data(), index));
+        }
+
+        [[nodiscard]] constexpr auto front() -> reference
+        {
+            return (*this)[0];
+        }
+
+        [[nodiscard]] constexpr auto front() const -> const_reference
+        {
+            return (*this)[0];
+        }
+
+        [[nodiscard]] constexpr auto back() -> reference
+        {
+            return (*this)[N - 1];
+        }
+
+        [[nodiscard]] constexpr auto back() const -> const_reference
+        {
+            return (*this)[N - 1];
+        }
+
+        [[nodiscard]] constexpr auto begin() -> iterator
+        {
+            return iterator{_words.data(), 0};
+        }
+
+        [[nodiscard]] constexpr auto begin() const -> const_iterator
+        {
+            return const_iterator{_words.data(), 0};
+        }
+
+        [[nodiscard]] constexpr auto cbegin() const -> const_iterator
+        {
+            return begin();
+        }
+
+        [[nodiscard]] constexpr auto end() -> iterator
+        {
+            return iterator{_words.data(), N};
+        }
+
+        [[nodiscard]] constexpr auto end() const -> const_iterator
+        {
+            return const_iterator{_words.data(), N};
+        }
+
+        [[nodiscard]] constexpr auto cend() const -> const_iterator
+        {
+            return end();
+        }
+
+        constexpr void fill(T const& value)
+        {
+            std::fill(begin(), end(), value);
+        }
+
+        /// the words in which the elements are stored, including the padding word
+        [[nodiscard]] constexpr auto words() -> std::span<_impl::packed_word>
+        {
+            return _words;
+        }
+
+        /// the words in which the elements are stored, including the padding word
+        [[nodiscard]] constexpr auto words() const -> std::span<_impl::packed_word const>
+        {
+            return _words;
+        }
+
+        /// unused bits are always zero, so equal elements are equal words
+        [[nodiscard]] friend constexpr auto operator==(packed_array const& lhs, packed_array const& rhs)
+                -> bool
+        {
+            return lhs._words == rhs._words;
+        }
+
+    private:
+        std::array<_impl::packed_word, _impl::packed_num_words(N, _impl::width<T>)> _words{};
+    };
+}
+
+#endif  // CNL_IMPL_PACKED_ARRAY_H
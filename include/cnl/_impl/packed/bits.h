@@ -0,0 +1,199 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_PACKED_BITS_H)
+#define CNL_IMPL_PACKED_BITS_H
+
+#include "../cstdint/types.h"
+#include "../num_traits/from_rep.h"
+#include "../num_traits/unwrap.h"
+#include "../num_traits/width.h"
+#include "../num_traits/wrap.h"
+#include "../numbers/signedness.h"
+#include "../type_traits/remove_cvref.h"
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // packed element traits
+
+        using packed_word = uint64;
+
+        inline constexpr auto packed_word_width = 64;
+
+        // integer which holds the bits of a packed element
+        template<typename T>
+        using packed_rep_t = remove_cvref_t<decltype(cnl::unwrap(std::declval<T>()))>;
+
+        // types whose values can be packed into words at exactly their width
+        template<typename T>
+        concept packable = std::is_integral_v<packed_rep_t<T>> && !std::is_same_v<packed_rep_t<T>, bool>
+                        && width<T> <= packed_word_width && width<T> <= width<packed_rep_t<T>>;
+
+        // elements which fill a whole number of words
+        inline constexpr auto packed_block_size = std::size_t{packed_word_width};
+
+        // words which store size elements of the given width, plus one word of padding
+        // so that every element can be read from two consecutive words
+        [[nodiscard]] constexpr auto packed_num_words(std::size_t size, int element_width)
+        {
+            return (size * element_width + packed_word_width - 1) / packed_word_width + 1;
+        }
+
+        template<typename T>
+        inline constexpr auto packed_mask = (width<T> == packed_word_width)
+                                                  ? ~packed_word{0}
+                                                  : (packed_word{1} << (width<T> % packed_word_width)) - 1;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // conversion between element values and their packed bits
+
+        template<packable T>
+        [[nodiscard]] constexpr auto packed_bits_from_rep(packed_rep_t<T> const& rep)
+        {
+            return static_cast<packed_word>(rep) & packed_mask<T>;
+        }
+
+        template<packable T>
+        [[nodiscard]] constexpr auto packed_rep_from_bits(packed_word bits) -> packed_rep_t<T>
+        {
+            if constexpr (numbers::signedness_v<packed_rep_t<T>>) {
+                // sign-extend
+                constexpr auto unused = packed_word_width - width<T>;
+                return static_cast<packed_rep_t<T>>(static_cast<int64>(bits << unused) >> unused);
+            } else {
+                return static_cast<packed_rep_t<T>>(bits);
+            }
+        }
+
+        // a value of type T or of its rep
+        template<typename Value, typename T>
+        concept packed_value = std::same_as<Value, T> || std::same_as<Value, packed_rep_t<T>>;
+
+        template<packable T, packed_value<T> Value>
+        [[nodiscard]] constexpr auto packed_bits_from_value(Value const& value)
+        {
+            if constexpr (std::is_same_v<Value, T>) {
+                return packed_bits_from_rep<T>(cnl::unwrap(value));
+            } else {
+                return packed_bits_from_rep<T>(value);
+            }
+        }
+
+        template<packable T, packed_value<T> Value>
+        [[nodiscard]] constexpr auto packed_value_from_bits(packed_word bits) -> Value
+        {
+            if constexpr (std::is_same_v<Value, T>) {
+                return cnl::wrap<T>(packed_rep_from_bits<T>(bits));
+            } else {
+                return packed_rep_from_bits<T>(bits);
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // access to individual elements
+
+        template<packable T>
+        [[nodiscard]] constexpr auto packed_read_bits(packed_word const* words, std::size_t index)
+        {
+            auto const offset = index * width<T>;
+            auto const word = offset / packed_word_width;
+            auto const shift = static_cast<int>(offset % packed_word_width);
+
+            // the padding word ensures that words[word + 1] exists
+            // and the double shift ensures that no shift is by 64 bits
+            return ((words[word] >> shift) | ((words[word + 1] << 1) << (packed_word_width - 1 - shift)))
+                 & packed_mask<T>;
+        }
+
+        template<packable T>
+        constexpr void packed_write_bits(packed_word* words, std::size_t index, packed_word bits)
+        {
+            auto const offset = index * width<T>;
+            auto const word = offset / packed_word_width;
+            auto const shift = static_cast<int>(offset % packed_word_width);
+
+            words[word] = (words[word] & ~(packed_mask<T> << shift)) | (bits << shift);
+            if (shift + width<T> > packed_word_width) {
+                auto const spill = packed_word_width - shift;
+                words[word + 1] = (words[word + 1] & ~(packed_mask<T> >> spill)) | (bits >> spill);
+            }
+        }
+
+        // sets the bits of an element whose bits are all zero
+        template<packable T>
+        constexpr void packed_or_bits(packed_word* words, std::size_t index, packed_word bits)
+        {
+            auto const offset = index * width<T>;
+            auto const word = offset / packed_word_width;
+            auto const shift = static_cast<int>(offset % packed_word_width);
+
+            words[word] |= bits << shift;
+            if (shift + width<T> > packed_word_width) {
+                words[word + 1] |= bits >> (packed_word_width - shift);
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // access to blocks of elements which fill whole words
+
+        // Because the offsets of the elements within a block are constants,
+        // these compile to straight-line shifts and masks with no loop-carried state.
+
+        // the rep of the element at Index within a block
+        template<packable T, std::size_t Index>
+        [[nodiscard]] constexpr auto packed_read_block_rep(packed_word const* words)
+        {
+            constexpr auto offset = Index * width<T>;
+            constexpr auto word = offset / packed_word_width;
+            constexpr auto shift = static_cast<int>(offset % packed_word_width);
+            constexpr auto end = shift + width<T>;
+
+            // the element's bits, shifted to the top of a word, so that any bits above them are gone
+            auto top = words[word] << (packed_word_width - end % packed_word_width) % packed_word_width;
+            if constexpr (end > packed_word_width) {
+                top = (words[word + 1] << (2 * packed_word_width - end))
+                    | (words[word] >> (end - packed_word_width));
+            }
+
+            constexpr auto unused = packed_word_width - width<T>;
+            if constexpr (numbers::signedness_v<packed_rep_t<T>>) {
+                return static_cast<packed_rep_t<T>>(static_cast<int64>(top) >> unused);
+            } else {
+                return static_cast<packed_rep_t<T>>(top >> unused);
+            }
+        }
+
+        template<packable T, packed_value<T> Value, std::size_t... Indices>
+        constexpr void packed_unpack_block(
+                packed_word const* words, Value* out, std::index_sequence<Indices...>)
+        {
+            if constexpr (std::is_same_v<Value, T>) {
+                ((out[Indices] = cnl::wrap<T>(packed_read_block_rep<T, Indices>(words))), ...);
+            } else {
+                ((out[Indices] = packed_read_block_rep<T, Indices>(words)), ...);
+            }
+        }
+
+        template<packable T, packed_value<T> Value, std::size_t... Indices>
+        constexpr void packed_pack_block(
+                Value const* in, packed_word* words, std::index_sequence<Indices...>)
+        {
+            constexpr auto num_words = std::size_t{width<T>};
+            for (auto word = std::size_t{0}; word != num_words; ++word) {
+                words[word] = 0;
+            }
+            (packed_or_bits<T>(words, Indices, packed_bits_from_value<T>(in[Indices])), ...);
+        }
+    }
+}
+
+#endif  // CNL_IMPL_PACKED_BITS_H
@@ -0,0 +1,100 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_PACKED_BULK_H)
+#define CNL_IMPL_PACKED_BULK_H
+
+#include "../cnl_assert.h"
+#include "bits.h"
+
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // cnl::packed_array or cnl::packed_vector
+        template<typename Packed>
+        concept packed_range = packable<typename Packed::value_type> && requires(Packed const& p)
+        {
+            {
+                p.words()
+                } -> std::same_as<std::span<packed_word const>>;
+            p.size();
+        };
+
+        template<packable T, packed_value<T> Value>
+        constexpr void packed_unpack(packed_word const* words, std::size_t size, Value* out)
+        {
+            auto index = std::size_t{0};
+            for (; index + packed_block_size <= size; index += packed_block_size) {
+                packed_unpack_block<T>(
+                        words + index / packed_block_size * width<T>, out + index,
+                        std::make_index_sequence<packed_block_size>{});
+            }
+            for (; index != size; ++index) {
+                out[index] = packed_value_from_bits<T, Value>(packed_read_bits<T>(words, index));
+            }
+        }
+
+        template<packable T, packed_value<T> Value>
+        constexpr void packed_pack(Value const* in, std::size_t size, packed_word* words)
+        {
+            auto index = std::size_t{0};
+            for (; index + packed_block_size <= size; index += packed_block_size) {
+                packed_pack_block<T>(
+                        in + index, words + index / packed_block_size * width<T>,
+                        std::make_index_sequence<packed_block_size>{});
+            }
+            for (; index != size; ++index) {
+                packed_write_bits<T>(words, index, packed_bits_from_value<T>(in[index]));
+            }
+        }
+    }
+
+    /// \brief copies every element of a packed container to a contiguous range
+    ///
+    /// \param in a \ref cnl::packed_array or \ref cnl::packed_vector of `T`
+    /// \param out a contiguous range of `T`, or of the integer which \ref cnl::unwrap returns
+    ///        from `T`, with as many elements as `in`
+    ///
+    /// Whole blocks of 64 elements are decoded without branches or loop-carried dependencies;
+    /// the position of every element within a block is a compile-time constant.
+    ///
+    /// \sa cnl::pack
+    template<_impl::packed_range Packed, std::ranges::contiguous_range Out>
+    requires _impl::packed_value<
+            std::ranges::range_value_t<Out>,
+            typename Packed::value_type> constexpr void unpack(Packed const& in, Out&& out)
+    {
+        CNL_ASSERT(std::ranges::size(out) == in.size());
+        _impl::packed_unpack<typename Packed::value_type>(
+                in.words().data(), in.size(), std::ranges::data(out));
+    }
+
+    /// \brief copies a contiguous range to every element of a packed container
+    ///
+    /// \param in a contiguous range of `T`, or of the integer which \ref cnl::unwrap returns
+    ///        from `T`, with as many elements as `out`
+    /// \param out a \ref cnl::packed_array or \ref cnl::packed_vector of `T`
+    ///
+    /// Bits of the elements of `in` which do not fit in an element of `out` are discarded.
+    ///
+    /// \sa cnl::unpack
+    template<std::ranges::contiguous_range In, _impl::packed_range Packed>
+    requires _impl::packed_value<
+            std::ranges::range_value_t<In>,
+            typename Packed::value_type> constexpr void pack(In const& in, Packed& out)
+    {
+        CNL_ASSERT(std::ranges::size(in) == out.size());
+        _impl::packed_pack<typename Packed::value_type>(
+                std::ranges::data(in), out.size(), out.words().data());
+    }
+}
+
+#endif  // CNL_IMPL_PACKED_BULK_H
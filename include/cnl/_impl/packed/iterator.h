@@ -0,0 +1,148 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_PACKED_ITERATOR_H)
+#define CNL_IMPL_PACKED_ITERATOR_H
+
+#include "bits.h"
+#include "reference.h"
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // random-access iterator over the elements of a packed container;
+        // dereferences to a proxy or, if Const, to a value
+        template<packable T, bool Const>
+        class packed_iterator {
+            using word_pointer = std::conditional_t<Const, packed_word const*, packed_word*>;
+
+        public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::conditional_t<Const, T, packed_reference<T>>;
+            using iterator_concept = std::random_access_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+
+            constexpr packed_iterator() = default;
+
+            constexpr packed_iterator(word_pointer words, std::size_t index)
+                : _words(words)
+                , _index(index)
+            {
+            }
+
+            template<bool OtherConst>
+            requires(Const && !OtherConst)
+                    // NOLINTNEXTLINE(hicpp-explicit-conversions)
+                    constexpr packed_iterator(packed_iterator<T, OtherConst> const& other)
+                : _words(other.words())
+                , _index(other.index())
+            {
+            }
+
+            [[nodiscard]] constexpr auto words() const
+            {
+                return _words;
+            }
+
+            [[nodiscard]] constexpr auto index() const
+            {
+                return _index;
+            }
+
+            [[nodiscard]] constexpr auto operator*() const -> reference
+            {
+                if constexpr (Const) {
+                    return packed_value_from_bits<T, T>(packed_read_bits<T>(_words, _index));
+                } else {
+                    return reference{_words, _index};
+                }
+            }
+
+            [[nodiscard]] constexpr auto operator[](difference_type n) const -> reference
+            {
+                return *(*this + n);
+            }
+
+            constexpr auto operator++() -> packed_iterator&
+            {
+                ++_index;
+                return *this;
+            }
+
+            constexpr auto operator++(int) -> packed_iterator
+            {
+                auto const copy = *this;
+                ++_index;
+                return copy;
+            }
+
+            constexpr auto operator--() -> packed_iterator&
+            {
+                --_index;
+                return *this;
+            }
+
+            constexpr auto operator--(int) -> packed_iterator
+            {
+                auto const copy = *this;
+                --_index;
+                return copy;
+            }
+
+            constexpr auto operator+=(difference_type n) -> packed_iterator&
+            {
+                _index = static_cast<std::size_t>(static_cast<difference_type>(_index) + n);
+                return *this;
+            }
+
+            constexpr auto operator-=(difference_type n) -> packed_iterator&
+            {
+                return *this += -n;
+            }
+
+            [[nodiscard]] friend constexpr auto operator+(packed_iterator it, difference_type n)
+            {
+                return it += n;
+            }
+
+            [[nodiscard]] friend constexpr auto operator+(difference_type n, packed_iterator it)
+            {
+                return it += n;
+            }
+
+            [[nodiscard]] friend constexpr auto operator-(packed_iterator it, difference_type n)
+            {
+                return it -= n;
+            }
+
+            [[nodiscard]] friend constexpr auto operator-(packed_iterator const& lhs, packed_iterator const& rhs)
+            {
+                return static_cast<difference_type>(lhs._index) - static_cast<difference_type>(rhs._index);
+            }
+
+            [[nodiscard]] friend constexpr auto operator==(packed_iterator const& lhs, packed_iterator const& rhs)
+            {
+                return lhs._index == rhs._index;
+            }
+
+            [[nodiscard]] friend constexpr auto operator<=>(packed_iterator const& lhs, packed_iterator const& rhs)
+            {
+                return lhs._index <=> rhs._index;
+            }
+
+        private:
+            word_pointer _words{};
+            std::size_t _index{};
+        };
+    }
+}
+
+#endif  // CNL_IMPL_PACKED_ITERATOR_H
@@ -0,0 +1,96 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_PACKED_REFERENCE_H)
+#define CNL_IMPL_PACKED_REFERENCE_H
+
+#include "bits.h"
+
+#include <cstddef>
+#include <type_traits>
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define CNL_IMPL_PACKED_REFERENCE_COMPARISON(OPERATOR) \
+    [[nodiscard]] friend constexpr auto operator OPERATOR( \
+            packed_reference const& lhs, packed_reference const& rhs) \
+    { \
+        return static_cast<T>(lhs) OPERATOR static_cast<T>(rhs); \
+    } \
+    [[nodiscard]] friend constexpr auto operator OPERATOR(packed_reference const& lhs, T const& rhs) \
+    { \
+        return static_cast<T>(lhs) OPERATOR rhs; \
+    } \
+    [[nodiscard]] friend constexpr auto operator OPERATOR(T const& lhs, packed_reference const& rhs) \
+    { \
+        return lhs OPERATOR static_cast<T>(rhs); \
+    }
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // proxy to an element of a packed container
+        template<packable T>
+        class packed_reference {
+        public:
+            constexpr packed_reference(packed_word* words, std::size_t index)
+                : _words(words)
+                , _index(index)
+            {
+            }
+
+            constexpr packed_reference(packed_reference const&) = default;
+
+            // assigns the value of the referenced element, rather than rebinding
+            // NOLINTNEXTLINE(bugprone-unhandled-self-assignment,cert-oop54-cpp)
+            constexpr auto operator=(packed_reference const& rhs) const -> packed_reference const&
+            {
+                return *this = static_cast<T>(rhs);
+            }
+
+            constexpr auto operator=(T const& rhs) const -> packed_reference const&
+            {
+                packed_write_bits<T>(_words, _index, packed_bits_from_value<T>(rhs));
+                return *this;
+            }
+
+            ~packed_reference() = default;
+
+            // NOLINTNEXTLINE(hicpp-explicit-conversions)
+            [[nodiscard]] constexpr operator T() const
+            {
+                return packed_value_from_bits<T, T>(packed_read_bits<T>(_words, _index));
+            }
+
+            template<typename Destination>
+            requires(!std::is_same_v<Destination, T>) [[nodiscard]] explicit constexpr operator Destination() const
+            {
+                return static_cast<Destination>(static_cast<T>(*this));
+            }
+
+            // T's operators are templates, which do not convert their operands
+            CNL_IMPL_PACKED_REFERENCE_COMPARISON(==)
+            CNL_IMPL_PACKED_REFERENCE_COMPARISON(!=)
+            CNL_IMPL_PACKED_REFERENCE_COMPARISON(<)
+            CNL_IMPL_PACKED_REFERENCE_COMPARISON(>)
+            CNL_IMPL_PACKED_REFERENCE_COMPARISON(<=)
+            CNL_IMPL_PACKED_REFERENCE_COMPARISON(>=)
+
+            friend constexpr void swap(packed_reference const& lhs, packed_reference const& rhs)
+            {
+                auto const value = static_cast<T>(lhs);
+                lhs = rhs;
+                rhs = value;
+            }
+
+        private:
+            packed_word* _words;
+            std::size_t _index;
+        };
+    }
+}
+
+#undef CNL_IMPL_PACKED_REFERENCE_COMPARISON
+
+#endif  // CNL_IMPL_PACKED_REFERENCE_H
@@ -0,0 +1,216 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_PACKED_VECTOR_H)
+#define CNL_IMPL_PACKED_VECTOR_H
+
+#include "../cnl_assert.h"
+#include "bits.h"
+#include "iterator.h"
+#include "reference.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <span>
+#include <vector>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief resizable array which stores each element in exactly as many bits as its type needs
+    ///
+    /// \tparam T the element type, e.g. \ref cnl::elastic_integer or \ref cnl::static_integer
+    ///
+    /// The layout of the elements is the same as that of \ref cnl::packed_array.
+    ///
+    /// \sa cnl::packed_array, cnl::pack, cnl::unpack
+    template<_impl::packable T>
+    class packed_vector {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = _impl::packed_reference<T>;
+        using const_reference = T;
+        using iterator = _impl::packed_iterator<T, false>;
+        using const_iterator = _impl::packed_iterator<T, true>;
+
+        /// number of bits occupied by each element
+        static constexpr int element_width = _impl::width<T>;
+
+        packed_vector() = default;
+
+        /// creates count zero-initialized elements
+        explicit packed_vector(size_type count)
+            : _words(_impl::packed_num_words(count, element_width))
+            , _size(count)
+        {
+        }
+
+        /// creates count copies of value
+        packed_vector(size_type count, T const& value)
+            : packed_vector(count)
+        {
+            std::fill(begin(), end(), value);
+        }
+
+        packed_vector(std::initializer_list<T> values)
+            : packed_vector(values.size())
+        {
+            std::copy(values.begin(), values.end(), begin());
+        }
+
+        [[nodiscard]] auto size() const -> size_type
+        {
+            return _size;
+        }
+
+        [[nodiscard]] auto empty() const
+        {
+            return _size == 0;
+        }
+
+        [[nodiscard]] auto capacity() const -> size_type
+        {
+            return (_words.capacity() - 1) * _impl::packed_word_width / element_width;
+        }
+
+        void reserve(size_type count)
+        {
+            _words.reserve(_impl::packed_num_words(count, element_width));
+        }
+
+        /// adds or removes elements at the end; added elements are zero
+        void resize(size_type count)
+        {
+            if (count < _size) {
+                clear_from(count);
+            }
+            _words.resize(_impl::packed_num_words(count, element_width));
+            _size = count;
+        }
+
+        /// adds or removes elements at the end; added elements are copies of value
+        void resize(size_type count, T const& value)
+        {
+            auto const old_size = _size;
+            resize(count);
+            if (count > old_size) {
+                std::fill(begin() + static_cast<difference_type>(old_size), end(), value);
+            }
+        }
+
+        void clear()
+        {
+            resize(0);
+        }
+
+        void push_back(T const& value)
+        {
+            _words.resize(_impl::packed_num_words(_size + 1, element_width));
+            (*this)[_size++] = value;
+        }
+
+        void pop_back()
+        {
+            CNL_ASSERT(_size > 0);
+            resize(_size - 1);
+        }
+
+        [[nodiscard]] auto operator[](size_type index) -> reference
+        {
+            return reference{_words.data(), index};
+        }
+
+        [[nodiscard]] auto operator[](size_type index) const -> const_reference
+        {
+            return _impl::packed_value_from_bits<T, T>(_impl::packed_read_bits<T>(_words.data(), index));
+        }
+
+        [[nodiscard]] auto front() -> reference
+        {
+            return (*this)[0];
+        }
+
+        [[nodiscard]] auto front() const -> const_reference
+        {
+            return (*this)[0];
+        }
+
+        [[nodiscard]] auto back() -> reference
+        {
+            return (*this)[_size - 1];
+        }
+
+        [[nodiscard]] auto back() const -> const_reference
+        {
+            return (*this)[_size - 1];
+        }
+
+        [[nodiscard]] auto begin() -> iterator
+        {
+            return iterator{_words.data(), 0};
+        }
+
+        [[nodiscard]] auto begin() const -> const_iterator
+        {
+            return const_iterator{_words.data(), 0};
+        }
+
+        [[nodiscard]] auto cbegin() const -> const_iterator
+        {
+            return begin();
+        }
+
+        [[nodiscard]] auto end() -> iterator
+        {
+            return iterator{_words.data(), _size};
+        }
+
+        [[nodiscard]] auto end() const -> const_iterator
+        {
+            return const_iterator{_words.data(), _size};
+        }
+
+        [[nodiscard]] auto cend() const -> const_iterator
+        {
+            return end();
+        }
+
+        /// the words in which the elements are stored, including the padding word
+        [[nodiscard]] auto words() -> std::span<_impl::packed_word>
+        {
+            return _words;
+        }
+
+        /// the words in which the elements are stored, including the padding word
+        [[nodiscard]] auto words() const -> std::span<_impl::packed_word const>
+        {
+            return _words;
+        }
+
+        /// unused bits are always zero, so equal elements are equal words
+        [[nodiscard]] friend auto operator==(packed_vector const& lhs, packed_vector const& rhs) -> bool
+        {
+            return lhs._size == rhs._size && lhs._words == rhs._words;
+        }
+
+    private:
+        // zeroes the bits of the elements from index onward, which are about to be removed
+        void clear_from(size_type index)
+        {
+            auto const offset = index * element_width;
+            auto const word = offset / _impl::packed_word_width;
+            auto const used = static_cast<int>(offset % _impl::packed_word_width);
+            _words[word] &= (_impl::packed_word{1} << used) - 1;
+            std::fill(_words.begin() + static_cast<difference_type>(word + 1), _words.end(), 0);
+        }
+
+        std::vector<_impl::packed_word> _words = std::vector<_impl::packed_word>(1);
+        size_type _size = 0;
+    };
+}
+
+#endif  // CNL_IMPL_PACKED_VECTOR_H
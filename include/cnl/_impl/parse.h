@@ -166,7 +166,7 @@ namespace cnl {
             int num_digits;
         };
 
-        constexpr auto separator{'\''};
+        inline constexpr auto separator{'\''};
 
         [[nodiscard]] constexpr auto scan_msb(
                 char const* str, int length, bool is_negative, int base, int stride, int offset, int max_num_bits)
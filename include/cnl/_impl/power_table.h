@@ -0,0 +1,61 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_POWER_TABLE_H)
+#define CNL_IMPL_POWER_TABLE_H
+
+#include "../numeric_limits.h"
+#include "type_traits/is_integral.h"
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::power_table - every power of a radix which an integer can represent
+
+        template<typename S, int Radix>
+        using power_table_value_type = decltype(std::declval<S>() * Radix);
+
+        // fundamental integers, for which building the whole table is cheap;
+        // for others, e.g. wide_integer, it would exceed constexpr evaluation limits
+        template<typename S, int Radix>
+        concept power_tabulable = integral<power_table_value_type<S, Radix>>;
+
+        template<typename S, int Radix>
+        requires power_tabulable<S, Radix> struct power_table {
+            static_assert(1 < Radix);
+
+            using value_type = power_table_value_type<S, Radix>;
+
+            [[nodiscard]] static constexpr auto num_powers()
+            {
+                auto count = 1;
+                for (auto power = value_type{1}; power <= numeric_limits<value_type>::max() / Radix;
+                     power = power * Radix) {
+                    ++count;
+                }
+                return count;
+            }
+
+            [[nodiscard]] static constexpr auto make_values()
+            {
+                auto powers = std::array<value_type, num_powers()>{};
+                powers[0] = value_type{1};
+                for (auto index = std::size_t{1}; index != powers.size(); ++index) {
+                    powers[index] = powers[index - 1] * Radix;
+                }
+                return powers;
+            }
+
+            static constexpr auto values = make_values();
+        };
+    }
+}
+
+#endif  // CNL_IMPL_POWER_TABLE_H
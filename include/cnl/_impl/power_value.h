@@ -10,6 +10,7 @@
 #include "../constant.h"
 #include "num_traits/digits.h"
 #include "num_traits/from_value.h"
+#include "power_table.h"
 
 #include <type_traits>
 
@@ -64,6 +65,19 @@ namespace cnl {
             }
         };
 
+        template<typename S, int Exponent, int Radix, bool OddExponent>
+        requires(Radix != 2 && power_tabulable<S, Radix>) struct power_value_fn<
+                S, Exponent, Radix, true, OddExponent, false> {
+            static_assert(
+                    Exponent < int(power_table<S, Radix>::values.size()),
+                    "attempted operation will result in overflow");
+
+            [[nodiscard]] constexpr auto operator()() const
+            {
+                return power_table<S, Radix>::values[Exponent];
+            }
+        };
+
         template<typename S, int Exponent, int Radix, bool PositiveExponent, bool OddExponent>
         struct power_value_fn<S, Exponent, Radix, PositiveExponent, OddExponent, true> {
             [[nodiscard]] constexpr auto operator()() const -> S
@@ -0,0 +1,33 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_REDUCE_EXECUTION_H)
+#define CNL_IMPL_REDUCE_EXECUTION_H
+
+/// compositional numeric library, execution policies
+namespace cnl::execution {
+    /// \brief execution policy which performs a \ref cnl::reduce on the calling thread
+    ///
+    /// \sa cnl::execution::seq, cnl::execution::parallel_policy
+    struct sequenced_policy {
+    };
+
+    /// \brief execution policy which divides a \ref cnl::reduce between threads
+    ///
+    /// \sa cnl::execution::par, cnl::execution::sequenced_policy
+    struct parallel_policy {
+        /// the greatest number of threads to use, including the calling thread;
+        /// if zero, `std::thread::hardware_concurrency()` is used
+        unsigned threads{0};
+    };
+
+    /// \brief instance of \ref cnl::execution::sequenced_policy
+    inline constexpr sequenced_policy seq{};
+
+    /// \brief instance of \ref cnl::execution::parallel_policy which uses every hardware thread
+    inline constexpr parallel_policy par{};
+}
+
+#endif  // CNL_IMPL_REDUCE_EXECUTION_H
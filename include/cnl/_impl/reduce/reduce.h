@@ -0,0 +1,249 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_REDUCE_REDUCE_H)
+#define CNL_IMPL_REDUCE_REDUCE_H
+
+#include "../cnl_assert.h"
+#include "../cstdint/types.h"
+#include "../linalg/dot.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/max_digits.h"
+#include "../num_traits/set_digits.h"
+#include "../num_traits/unwrap.h"
+#include "../num_traits/wrap.h"
+#include "../type_traits/is_integral.h"
+#include "../type_traits/remove_cvref.h"
+#include "../used_digits.h"
+#include "execution.h"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // accumulator selection
+
+        // numbers whose sums are the sums of their fundamental integers,
+        // e.g. integers, scaled_integer and elastic_integer
+        template<typename T>
+        concept reduce_operand = integral<linalg_rep_t<T>> && requires(T const& a)
+        {
+            a + a;
+        };
+
+        template<typename T>
+        concept execution_policy =
+                std::same_as<T, execution::sequenced_policy> || std::same_as<T, execution::parallel_policy>;
+
+        // digits needed to hold any sum of Terms values of type T
+        template<typename T, std::size_t Terms>
+        inline constexpr auto reduce_sum_digits = digits<T> + ((Terms > 1) ? used_digits(Terms - 1) : 0);
+
+        // fundamental integer which accumulates a chunk of values: the narrowest which is at
+        // least as wide as int and which holds at least 256 values
+        template<typename T>
+        using reduce_chunk_t = set_digits_t<int, std::max(digits<int>, digits<T> + digits<uint8>)>;
+
+        template<typename T>
+        inline constexpr auto reduce_chunk_terms = std::size_t{1} << (digits<reduce_chunk_t<T>> - digits<T>);
+
+        // fewest values which are worth summing on a thread of their own
+        inline constexpr auto reduce_thread_terms = std::size_t{1} << 18;
+
+        // type of the value to which transform maps an element of Range
+        template<typename Range, typename Transform>
+        using reduce_transformed_t = remove_cvref_t<
+                std::invoke_result_t<Transform const&, std::ranges::range_reference_t<Range const>>>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // kernels
+
+        // sum of the fundamental integers of the transformed elements
+        template<integral Accumulator, typename Element, typename Transform>
+        [[nodiscard]] constexpr auto reduce_kernel(
+                Element const* data, std::size_t size, Transform const& transform) -> Accumulator
+        {
+            auto sum = Accumulator{0};
+            for (auto index = std::size_t{0}; index != size; ++index) {
+                sum = static_cast<Accumulator>(
+                        sum + static_cast<Accumulator>(cnl::unwrap(std::invoke(transform, data[index]))));
+            }
+            return sum;
+        }
+
+        // as reduce_kernel but accumulates at most reduce_chunk_terms values in a chunk accumulator
+        // before adding them to a wider total
+        template<integral Total, typename Operand, typename Element, typename Transform>
+        [[nodiscard]] constexpr auto reduce_chunked(
+                Element const* data, std::size_t size, Transform const& transform) -> Total
+        {
+            using chunk = reduce_chunk_t<Operand>;
+            if constexpr (digits<chunk> >= digits<Total>) {
+                return reduce_kernel<Total>(data, size, transform);
+            } else {
+                auto total = Total{0};
+                for (auto offset = std::size_t{0}; offset < size; offset += reduce_chunk_terms<Operand>) {
+                    total = static_cast<Total>(
+                            total + reduce_kernel<chunk>(
+                                    data + offset, std::min(reduce_chunk_terms<Operand>, size - offset),
+                                    transform));
+                }
+                return total;
+            }
+        }
+
+        // std::thread::hardware_concurrency can take microseconds and so is called once
+        [[nodiscard]] inline auto reduce_hardware_threads() -> std::size_t
+        {
+            static auto const threads = std::max(std::thread::hardware_concurrency(), 1U);
+            return threads;
+        }
+
+        [[nodiscard]] inline auto reduce_threads(execution::parallel_policy policy, std::size_t size)
+                -> std::size_t
+        {
+            auto const blocks = size / reduce_thread_terms;
+            if (blocks < 2) {
+                return 1;
+            }
+            return std::min(blocks, (policy.threads != 0) ? policy.threads : reduce_hardware_threads());
+        }
+
+        // the elements are divided into one contiguous block per thread; because integer addition
+        // is associative, the total does not depend on the number of threads
+        template<integral Total, typename Operand, typename Element, typename Transform>
+        [[nodiscard]] auto reduce_parallel(
+                execution::parallel_policy policy, Element const* data, std::size_t size,
+                Transform const& transform) -> Total
+        {
+            auto const threads = reduce_threads(policy, size);
+            if (threads == 1) {
+                return reduce_chunked<Total, Operand>(data, size, transform);
+            }
+
+            auto partials = std::vector<Total>(threads);
+            {
+                auto workers = std::vector<std::jthread>{};
+                workers.reserve(threads - 1);
+                for (auto thread = std::size_t{1}; thread != threads; ++thread) {
+                    auto const first = size * thread / threads;
+                    auto const last = size * (thread + 1) / threads;
+                    workers.emplace_back([&partials, &transform, data, first, last, thread] {
+                        partials[thread] = reduce_chunked<Total, Operand>(
+                                data + first, last - first, transform);
+                    });
+                }
+                partials[0] = reduce_chunked<Total, Operand>(data, size / threads, transform);
+            }
+
+            auto total = Total{0};
+            for (auto const partial : partials) {
+                total = static_cast<Total>(total + partial);
+            }
+            return total;
+        }
+    }
+
+    /// \brief type of the result of \ref cnl::reduce of Terms elements of type T
+    ///
+    /// T with enough digits to hold the sum of Terms values without overflow.
+    template<_impl::reduce_operand T, std::size_t Terms>
+    requires(_impl::reduce_sum_digits<T, Terms> <= _impl::max_digits<_impl::linalg_rep_t<T>>)
+    using reduce_result_t = set_digits_t<T, _impl::reduce_sum_digits<T, Terms>>;
+
+    /// \brief exact sum of a range of transformed numbers
+    ///
+    /// \param policy \ref cnl::execution::seq or an instance of
+    /// \ref cnl::execution::parallel_policy, e.g. \ref cnl::execution::par
+    /// \param range contiguous range of elements
+    /// \param transform function object which maps each element to a number, e.g. an integer or a
+    /// \ref cnl::scaled_integer; it is invoked concurrently by a parallel policy
+    /// \return the exact sum of the transformed elements as a \ref cnl::reduce_result_t
+    ///
+    /// If the size of `range` is known at compile time, the result is just wide enough to hold
+    /// the sum of that many values. Otherwise, it is wide enough for 2<sup>31</sup>. Values are
+    /// summed in the narrowest integer no narrower than `int` which holds at least 256 of them and
+    /// these partial sums are then added to a result of the wider type. Thus, 16-bit reps are
+    /// summed in 32-bit lanes.
+    ///
+    /// With a \ref cnl::execution::parallel_policy, the range is divided into one block per
+    /// thread. Each thread sums at least 2<sup>18</sup> elements. The partial sums are exact
+    /// and so the result is identical to that of \ref cnl::execution::seq. As with
+    /// `std::execution::par`, an exception thrown by `transform` on another thread calls
+    /// `std::terminate`.
+    ///
+    /// Example:
+    /// \snippet reduce.cpp transform_reduce example
+    ///
+    /// \sa cnl::reduce, cnl::dot
+    template<_impl::execution_policy Policy, std::ranges::contiguous_range Range, typename Transform>
+    requires std::invocable<Transform const&, std::ranges::range_reference_t<Range const>> && _impl::reduce_operand<_impl::reduce_transformed_t<Range, Transform>>
+    [[nodiscard]] constexpr auto transform_reduce(Policy policy, Range const& range, Transform const& transform)
+    {
+        using operand = _impl::reduce_transformed_t<Range, Transform>;
+        using result = reduce_result_t<operand, _impl::linalg_terms<Range, Range>>;
+        using total = _impl::linalg_rep_t<result>;
+
+        auto const* const data = std::ranges::data(range);
+        auto const size = std::ranges::size(range);
+        CNL_ASSERT((size <= _impl::linalg_terms<Range, Range>));
+        if constexpr (std::is_same_v<Policy, execution::parallel_policy>) {
+            return cnl::wrap<result>(_impl::reduce_parallel<total, operand>(policy, data, size, transform));
+        } else {
+            return cnl::wrap<result>(_impl::reduce_chunked<total, operand>(data, size, transform));
+        }
+    }
+
+    /// \brief exact sum of a range of transformed numbers on the calling thread
+    ///
+    /// \sa cnl::transform_reduce(Policy, Range const&, Transform const&)
+    template<std::ranges::contiguous_range Range, typename Transform>
+    requires std::invocable<Transform const&, std::ranges::range_reference_t<Range const>> && _impl::reduce_operand<_impl::reduce_transformed_t<Range, Transform>>
+    [[nodiscard]] constexpr auto transform_reduce(Range const& range, Transform const& transform)
+    {
+        return cnl::transform_reduce(execution::seq, range, transform);
+    }
+
+    /// \brief exact sum of a range of numbers
+    ///
+    /// \param policy \ref cnl::execution::seq or an instance of
+    /// \ref cnl::execution::parallel_policy, e.g. \ref cnl::execution::par
+    /// \param range contiguous range of numbers, e.g. of \ref cnl::scaled_integer
+    /// \return the exact sum of the elements of `range` as a \ref cnl::reduce_result_t
+    ///
+    /// The sum is calculated as by \ref cnl::transform_reduce.
+    ///
+    /// Example:
+    /// \snippet reduce.cpp reduce example
+    ///
+    /// \sa cnl::transform_reduce
+    template<_impl::execution_policy Policy, std::ranges::contiguous_range Range>
+    requires _impl::reduce_operand<std::ranges::range_value_t<Range>>
+    [[nodiscard]] constexpr auto reduce(Policy policy, Range const& range)
+    {
+        return cnl::transform_reduce(policy, range, std::identity{});
+    }
+
+    /// \brief exact sum of a range of numbers on the calling thread
+    ///
+    /// \sa cnl::reduce(Policy, Range const&)
+    template<std::ranges::contiguous_range Range>
+    requires _impl::reduce_operand<std::ranges::range_value_t<Range>>
+    [[nodiscard]] constexpr auto reduce(Range const& range)
+    {
+        return cnl::transform_reduce(execution::seq, range, std::identity{});
+    }
+}
+
+#endif  // CNL_IMPL_REDUCE_REDUCE_H
@@ -9,9 +9,12 @@
 
 #include "../../numeric_limits.h"
 #include "../custom_operator/native_tag.h"
+#include "../instrumentation.h"
 #include "native_rounding_tag.h"
 #include "nearest_rounding_tag.h"
 #include "neg_inf_rounding_tag.h"
+#include "stochastic_rounding_tag.h"
+#include "tie_to_even_rounding_tag.h"
 #include "tie_to_pos_inf_rounding_tag.h"
 
 #include <type_traits>
@@ -51,8 +54,9 @@ namespace cnl {
         [[nodiscard]] constexpr auto operator()(Source const& from) const
         {
             return numeric_limits<Destination>::is_integer && std::is_floating_point<Source>::value
-                         ? static_cast<Destination>(
-                                 static_cast<long double>(from) + ((from >= Source{}) ? .5L : -.5L))
+                         ? (CNL_INSTRUMENT(cnl::instrumentation::rounding_event, _impl::convert_op, Source, Destination, nearest_rounding_tag),
+                            static_cast<Destination>(
+                                    static_cast<long double>(from) + ((from >= Source{}) ? .5L : -.5L)))
                          : static_cast<Destination>(from);
         }
     };
@@ -77,7 +81,8 @@ namespace cnl {
         [[nodiscard]] constexpr auto operator()(Source const& from) const
         {
             return numeric_limits<Destination>::is_integer && std::is_floating_point<Source>::value
-                         ? static_cast<Destination>(floor(from + static_cast<Source>(.5L)))
+                         ? (CNL_INSTRUMENT(cnl::instrumentation::rounding_event, _impl::convert_op, Source, Destination, tie_to_pos_inf_rounding_tag),
+                            static_cast<Destination>(floor(from + static_cast<Source>(.5L))))
                          : static_cast<Destination>(from);
         }
     };
@@ -102,10 +107,45 @@ namespace cnl {
         [[nodiscard]] constexpr auto operator()(Source const& from) const
         {
             return numeric_limits<Destination>::is_integer && std::is_floating_point<Source>::value
-                         ? static_cast<Destination>(floor(from))
+                         ? (CNL_INSTRUMENT(cnl::instrumentation::rounding_event, _impl::convert_op, Source, Destination, neg_inf_rounding_tag), static_cast<Destination>(floor(from)))
                          : static_cast<Destination>(from);
         }
     };
+
+    template<typename Source, tag SrcTag, typename Destination>
+    requires(!_impl::is_rounding_tag<SrcTag>::value && _impl::are_arithmetic_or_integer<Destination, Source>::value) struct custom_operator<_impl::convert_op, op_value<Source, SrcTag>, op_value<Destination, tie_to_even_rounding_tag>> {
+        [[nodiscard]] constexpr auto operator()(Source const& from) const
+                requires(numeric_limits<Destination>::is_integer && std::is_floating_point<Source>::value)
+        {
+            CNL_INSTRUMENT(cnl::instrumentation::rounding_event, _impl::convert_op, Source, Destination, tie_to_even_rounding_tag);
+            return _impl::tie_to_even_round<Destination>(from);
+        }
+
+        [[nodiscard]] constexpr auto operator()(Source const& from) const
+        {
+            return static_cast<Destination>(from);
+        }
+    };
+
+    template<typename Source, tag SrcTag, typename Destination>
+    requires(!_impl::is_rounding_tag<SrcTag>::value && _impl::are_arithmetic_or_integer<Destination, Source>::value) struct custom_operator<_impl::convert_op, op_value<Source, SrcTag>, op_value<Destination, stochastic_rounding_tag>> {
+        [[nodiscard]] constexpr auto operator()(Source const& from, uint64 bits) const
+                requires(numeric_limits<Destination>::is_integer && std::is_floating_point<Source>::value)
+        {
+            CNL_INSTRUMENT(cnl::instrumentation::rounding_event, _impl::convert_op, Source, Destination, stochastic_rounding_tag);
+            return _impl::stochastic_round<Destination>(from, bits);
+        }
+
+        [[nodiscard]] constexpr auto operator()(Source const& from, uint64 /*bits*/) const
+        {
+            return static_cast<Destination>(from);
+        }
+
+        [[nodiscard]] auto operator()(Source const& from) const
+        {
+            return (*this)(from, _impl::next_stochastic_rounding_bits());
+        }
+    };
     /// \endcond
 
     template<typename Source, rounding_tag SrcTag, typename Destination>
@@ -9,6 +9,7 @@
 
 #include "../custom_operator/definition.h"
 #include "../custom_operator/native_tag.h"
+#include "../instrumentation.h"
 #include "is_rounding_tag.h"
 #include "is_tag.h"
 
@@ -51,6 +52,7 @@ namespace cnl {
         [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
                 -> decltype(lhs / rhs)
         {
+            CNL_INSTRUMENT(cnl::instrumentation::rounding_event, _impl::divide_op, Lhs, Rhs, nearest_rounding_tag);
             return (((lhs < 0) ^ (rhs < 0)) ? lhs - (rhs / 2) : lhs + (rhs / 2)) / rhs;
         }
     };
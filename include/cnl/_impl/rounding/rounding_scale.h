@@ -0,0 +1,253 @@
+
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief branch-free kernels which divide an integer by a power of the radix and round the result
+
+#if !defined(CNL_IMPL_ROUNDING_ROUNDING_SCALE_H)
+#define CNL_IMPL_ROUNDING_ROUNDING_SCALE_H
+
+#include "../cstdint/types.h"
+#include "../duplex_integer/is_duplex_integer.h"
+#include "../num_traits/digits.h"
+#include "../numbers/signedness.h"
+#include "../power_value.h"
+#include "../type_traits/is_integral.h"
+#include "is_rounding_tag.h"
+#include "nearest_rounding_tag.h"
+#include "stochastic_rounding_tag.h"
+#include "tie_to_even_rounding_tag.h"
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::bitwise_rounding_rep
+
+        // integers with two's complement arithmetic whose sign can be
+        // broadcast with an arithmetic right shift
+        template<typename Rep>
+        concept bitwise_rounding_rep = integral<Rep> || any_duplex_integer<Rep>;
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::sign_mask
+
+        // -1 if the value is negative, otherwise 0
+        template<bitwise_rounding_rep Rep>
+        requires(numbers::signedness_v<Rep>)
+                [[nodiscard]] constexpr auto sign_mask(Rep const& rep)
+        {
+            // two steps, as duplex_integer cannot shift the sign bit
+            // across its lower half in a single shift
+            return rep >> (digits<Rep> - 1) >> 1;
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::rounding_scale
+
+        // divides rep by Radix^Shift, rounding as specified by Tag;
+        // the result is of the (promoted) type of the arithmetic expression
+        template<rounding_tag Tag, int Shift, int Radix, bitwise_rounding_rep Rep>
+        struct rounding_scale;
+
+        template<int Shift, int Radix, bitwise_rounding_rep Rep>
+        struct rounding_scale_constants {
+            static_assert(0 < Shift, "rounding is only necessary when a value is scaled down");
+
+            [[nodiscard]] static constexpr auto divisor()
+            {
+                return power_value<Rep, Shift, Radix>();
+            }
+
+            [[nodiscard]] static constexpr auto half()
+            {
+                return divisor() / 2;
+            }
+        };
+
+        // round half away from zero; binary, unsigned
+        template<int Shift, bitwise_rounding_rep Rep>
+        requires(!numbers::signedness_v<Rep>) struct rounding_scale<nearest_rounding_tag, Shift, 2, Rep>
+            : rounding_scale_constants<Shift, 2, Rep> {
+            [[nodiscard]] constexpr auto operator()(Rep const& rep) const
+            {
+                // adds the most significant discarded bit; cannot overflow
+                return (rep >> Shift) + ((rep >> (Shift - 1)) & 1);
+            }
+        };
+
+        // round half away from zero; binary, signed
+        template<int Shift, bitwise_rounding_rep Rep>
+        requires(numbers::signedness_v<Rep>) struct rounding_scale<nearest_rounding_tag, Shift, 2, Rep>
+            : rounding_scale_constants<Shift, 2, Rep> {
+            [[nodiscard]] constexpr auto operator()(Rep const& rep) const
+            {
+                // Subtracting one from negative values
+                // turns the flooring of the right shift into a ceiling;
+                // the result is symmetrical around zero.
+                return (rep + this->half() + sign_mask(rep)) >> Shift;
+            }
+        };
+
+        // round half away from zero; non-binary, unsigned
+        template<int Shift, int Radix, bitwise_rounding_rep Rep>
+        requires(Radix != 2 && !numbers::signedness_v<Rep>) struct rounding_scale<nearest_rounding_tag, Shift, Radix, Rep>
+            : rounding_scale_constants<Shift, Radix, Rep> {
+            [[nodiscard]] constexpr auto operator()(Rep const& rep) const
+            {
+                return (rep + this->half()) / this->divisor();
+            }
+        };
+
+        // round half away from zero; non-binary, signed
+        template<int Shift, int Radix, bitwise_rounding_rep Rep>
+        requires(Radix != 2 && numbers::signedness_v<Rep>) struct rounding_scale<nearest_rounding_tag, Shift, Radix, Rep>
+            : rounding_scale_constants<Shift, Radix, Rep> {
+            [[nodiscard]] constexpr auto operator()(Rep const& rep) const
+            {
+                // conditionally negates half without a branch
+                auto const mask = sign_mask(rep);
+                return (rep + ((this->half() ^ mask) - mask)) / this->divisor();
+            }
+        };
+
+        // round half to even; binary
+        template<int Shift, bitwise_rounding_rep Rep>
+        struct rounding_scale<tie_to_even_rounding_tag, Shift, 2, Rep>
+            : rounding_scale_constants<Shift, 2, Rep> {
+            [[nodiscard]] constexpr auto operator()(Rep const& rep) const
+            {
+                // Rounds up if the most significant discarded bit is set and either
+                // any other discarded bit is set or the truncated result is odd;
+                // nothing is added before shifting, so nothing overflows.
+                auto const truncated = rep >> Shift;
+                auto const round_bit = (rep >> (Shift - 1)) & 1;
+                auto const sticky = static_cast<decltype(truncated)>((rep & (this->half() - 1)) != 0);
+                return truncated + (round_bit & (sticky | (truncated & 1)));
+            }
+        };
+
+        // round half to even; non-binary, unsigned
+        template<int Shift, int Radix, bitwise_rounding_rep Rep>
+        requires(Radix != 2 && !numbers::signedness_v<Rep>) struct rounding_scale<tie_to_even_rounding_tag, Shift, Radix, Rep>
+            : rounding_scale_constants<Shift, Radix, Rep> {
+            [[nodiscard]] constexpr auto operator()(Rep const& rep) const
+            {
+                // the divisor is a compile-time constant, so division and modulo become multiplication
+                auto const quotient = rep / this->divisor();
+                auto const remainder = rep % this->divisor();
+
+                auto const tie = Radix % 2 == 0 && remainder == this->half();
+                return quotient + static_cast<decltype(quotient)>(this->half() < remainder || (tie && (quotient & 1) != 0));
+            }
+        };
+
+        // round half to even; non-binary, signed
+        template<int Shift, int Radix, bitwise_rounding_rep Rep>
+        requires(Radix != 2 && numbers::signedness_v<Rep>) struct rounding_scale<tie_to_even_rounding_tag, Shift, Radix, Rep>
+            : rounding_scale_constants<Shift, Radix, Rep> {
+            [[nodiscard]] constexpr auto operator()(Rep const& rep) const
+            {
+                // floors the quotient so that the remainder is non-negative
+                auto const truncated_quotient = rep / this->divisor();
+                auto const truncated_remainder = rep % this->divisor();
+                auto const mask = sign_mask(truncated_remainder);
+                auto const quotient = truncated_quotient + mask;
+                auto const remainder = truncated_remainder + (this->divisor() & mask);
+
+                auto const tie = Radix % 2 == 0 && remainder == this->half();
+                return quotient + static_cast<decltype(quotient)>(this->half() < remainder || (tie && (quotient & 1) != 0));
+            }
+        };
+
+        // add noise uniformly distributed in [0, divisor) and round down;
+        // the caller supplies the random bits
+        template<int Shift, int Radix, bitwise_rounding_rep Rep>
+        struct stochastic_rounding_noise;
+
+        // binary; the most significant random bits are used
+        template<int Shift, bitwise_rounding_rep Rep>
+        requires(Shift <= 64) struct stochastic_rounding_noise<Shift, 2, Rep> {
+            [[nodiscard]] constexpr auto operator()(uint64 bits) const
+            {
+                return static_cast<Rep>(bits >> (64 - Shift));
+            }
+        };
+
+        template<int Shift, bitwise_rounding_rep Rep>
+        requires(64 < Shift) struct stochastic_rounding_noise<Shift, 2, Rep> {
+            [[nodiscard]] constexpr auto operator()(uint64 bits) const
+            {
+                return static_cast<Rep>(static_cast<Rep>(bits) << (Shift - 64));
+            }
+        };
+
+        // non-binary; modulo bias is negligible for divisors much smaller than 2^64
+        template<int Shift, int Radix, bitwise_rounding_rep Rep>
+        requires(Radix != 2 && digits<Rep> <= 64) struct stochastic_rounding_noise<Shift, Radix, Rep> {
+            [[nodiscard]] constexpr auto operator()(uint64 bits) const
+            {
+                return static_cast<Rep>(bits % static_cast<uint64>(power_value<Rep, Shift, Radix>()));
+            }
+        };
+
+        template<int Shift, int Radix, bitwise_rounding_rep Rep>
+        requires(Radix != 2 && 64 < digits<Rep>) struct stochastic_rounding_noise<Shift, Radix, Rep> {
+            [[nodiscard]] constexpr auto operator()(uint64 bits) const
+            {
+                return static_cast<Rep>(static_cast<Rep>(bits >> 1) % power_value<Rep, Shift, Radix>());
+            }
+        };
+
+        // stochastic; binary
+        template<int Shift, bitwise_rounding_rep Rep>
+        struct rounding_scale<stochastic_rounding_tag, Shift, 2, Rep>
+            : rounding_scale_constants<Shift, 2, Rep> {
+            [[nodiscard]] constexpr auto operator()(Rep const& rep, uint64 bits) const
+            {
+                // the right shift rounds towards negative infinity
+                return (rep + stochastic_rounding_noise<Shift, 2, Rep>{}(bits)) >> Shift;
+            }
+        };
+
+        // stochastic; non-binary, unsigned
+        template<int Shift, int Radix, bitwise_rounding_rep Rep>
+        requires(Radix != 2 && !numbers::signedness_v<Rep>) struct rounding_scale<stochastic_rounding_tag, Shift, Radix, Rep>
+            : rounding_scale_constants<Shift, Radix, Rep> {
+            [[nodiscard]] constexpr auto operator()(Rep const& rep, uint64 bits) const
+            {
+                return (rep + stochastic_rounding_noise<Shift, Radix, Rep>{}(bits)) / this->divisor();
+            }
+        };
+
+        // stochastic; non-binary, signed
+        template<int Shift, int Radix, bitwise_rounding_rep Rep>
+        requires(Radix != 2 && numbers::signedness_v<Rep>) struct rounding_scale<stochastic_rounding_tag, Shift, Radix, Rep>
+            : rounding_scale_constants<Shift, Radix, Rep> {
+            [[nodiscard]] constexpr auto operator()(Rep const& rep, uint64 bits) const
+            {
+                // turns the truncation of negative quotients into flooring
+                auto const dithered = rep + stochastic_rounding_noise<Shift, Radix, Rep>{}(bits);
+                auto const quotient = dithered / this->divisor();
+                return quotient + sign_mask(static_cast<decltype(quotient)>(dithered % this->divisor()));
+            }
+        };
+
+        template<rounding_tag Tag, int Shift, int Radix, bitwise_rounding_rep Rep>
+        [[nodiscard]] constexpr auto rounding_scale_down(Rep const& rep)
+        {
+            return rounding_scale<Tag, Shift, Radix, Rep>{}(rep);
+        }
+
+        template<rounding_tag Tag, int Shift, int Radix, bitwise_rounding_rep Rep>
+        [[nodiscard]] constexpr auto rounding_scale_down(Rep const& rep, uint64 bits)
+        {
+            return rounding_scale<Tag, Shift, Radix, Rep>{}(rep, bits);
+        }
+    }
+}
+
+#endif  // CNL_IMPL_ROUNDING_ROUNDING_SCALE_H
@@ -0,0 +1,108 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief seedable, counter-based source of random bits used by \ref cnl::stochastic_rounding_tag
+
+#if !defined(CNL_IMPL_ROUNDING_STOCHASTIC_ROUNDING_BITS_H)
+#define CNL_IMPL_ROUNDING_STOCHASTIC_ROUNDING_BITS_H
+
+#include "../../numeric_limits.h"
+#include "../cstdint/types.h"
+#include "../power_value.h"
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::stochastic_rounding_bits
+
+        // the counter-th 64-bit output of the generator seeded with seed;
+        // a pure function of its inputs, so loops which call it vectorize
+        // and any element of a sequence can be reproduced independently
+        [[nodiscard]] constexpr auto stochastic_rounding_bits(uint64 seed, uint64 counter)
+        {
+            // SplitMix64 finalizer applied to a Weyl sequence
+            auto z = seed + (counter + 1) * uint64{0x9e3779b97f4a7c15};
+            z = (z ^ (z >> 30)) * uint64{0xbf58476d1ce4e5b9};
+            z = (z ^ (z >> 27)) * uint64{0x94d049bb133111eb};
+            return z ^ (z >> 31);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::stochastic_rounding_fraction
+
+        // uniformly-distributed floating-point value in the range [0, 1)
+        template<typename Float>
+        [[nodiscard]] constexpr auto stochastic_rounding_fraction(uint64 bits)
+        {
+            constexpr auto fraction_digits = (numeric_limits<Float>::digits < 64) ? numeric_limits<Float>::digits : 64;
+            return static_cast<Float>(bits >> (64 - fraction_digits))
+                 * power_value<Float, -fraction_digits, 2>();
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::stochastic_round
+
+        // rounds x up to the next integer with a probability equal to its fractional part;
+        // comparing against the fractional part, rather than adding noise to x,
+        // avoids rounding error in the floating-point addition;
+        // the bits are inverted so that, as with integers, larger bits round up more often
+        template<typename Integer, typename Float>
+        [[nodiscard]] constexpr auto stochastic_round(Float const& x, uint64 bits)
+        {
+            auto const truncated = static_cast<Integer>(x);
+            auto const floored = static_cast<Integer>(
+                    truncated - static_cast<Integer>(x < static_cast<Float>(truncated)));
+            auto const round_up = stochastic_rounding_fraction<Float>(~bits) < x - static_cast<Float>(floored);
+            return static_cast<Integer>(floored + static_cast<Integer>(round_up));
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // cnl::_impl::stochastic_rounding_state
+
+        // per-thread position in the stream of random bits
+        struct stochastic_rounding_state {
+            uint64 seed;
+            uint64 counter;
+        };
+
+        [[nodiscard]] inline auto thread_stochastic_rounding_state() -> stochastic_rounding_state&
+        {
+            thread_local auto state = stochastic_rounding_state{0, 0};
+            return state;
+        }
+
+        // reserves n consecutive outputs of the calling thread's generator
+        // and returns the state from which to generate them
+        [[nodiscard]] inline auto reserve_stochastic_rounding_bits(uint64 n)
+        {
+            auto& state = thread_stochastic_rounding_state();
+            auto const reserved = state;
+            state.counter += n;
+            return reserved;
+        }
+
+        [[nodiscard]] inline auto next_stochastic_rounding_bits()
+        {
+            auto const reserved = reserve_stochastic_rounding_bits(1);
+            return stochastic_rounding_bits(reserved.seed, reserved.counter);
+        }
+    }
+
+    /// \brief seeds the calling thread's source of random bits for \ref cnl::stochastic_rounding_tag
+    ///
+    /// After seeding, the sequence of results produced by stochastically-rounded operations
+    /// on the calling thread is a function of the seed and of the sequence of operations.
+    ///
+    /// \headerfile cnl/rounding.h
+    /// \sa cnl::stochastic_rounding_tag
+    inline void seed_stochastic_rounding(uint64 seed)
+    {
+        _impl::thread_stochastic_rounding_state() = _impl::stochastic_rounding_state{seed, 0};
+    }
+}
+
+#endif  // CNL_IMPL_ROUNDING_STOCHASTIC_ROUNDING_BITS_H
@@ -0,0 +1,128 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_ROUNDING_STOCHASTIC_ROUNDING_TAG_H)
+#define CNL_IMPL_ROUNDING_STOCHASTIC_ROUNDING_TAG_H
+
+#include "../cmath/abs.h"
+#include "../cstdint/types.h"
+#include "../custom_operator/definition.h"
+#include "../custom_operator/native_tag.h"
+#include "is_rounding_tag.h"
+#include "is_tag.h"
+#include "stochastic_rounding_bits.h"
+
+#include <iterator>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief tag to specify stochastic rounding behavior in arithmetic operations
+    ///
+    /// Arithmetic operations using this tag round to one of the two nearest representable values
+    /// with a probability proportional to the proximity of the precise value to each.
+    /// The expected value of the result is the precise value, so rounding error does not
+    /// accumulate as a bias over repeated operations.
+    ///
+    /// The random bits are drawn from a counter-based generator which is local to each thread
+    /// and which can be seeded with \ref cnl::seed_stochastic_rounding.
+    ///
+    /// \headerfile cnl/rounding.h
+    /// \sa cnl::rounding_integer, cnl::seed_stochastic_rounding, cnl::stochastic_convert,
+    /// cnl::add, cnl::convert, cnl::divide, cnl::left_shift, cnl::multiply, cnl::subtract,
+    /// cnl::nearest_rounding_tag
+    struct stochastic_rounding_tag
+        : _impl::homogeneous_deduction_tag_base
+        , _impl::homogeneous_operator_tag_base {
+    };
+
+    namespace _impl {
+        template<>
+        struct is_rounding_tag<stochastic_rounding_tag> : std::true_type {
+        };
+    }
+
+    template<_impl::unary_arithmetic_op Operator, typename Operand>
+    struct custom_operator<Operator, op_value<Operand, stochastic_rounding_tag>>
+        : custom_operator<Operator, op_value<Operand, _impl::native_tag>> {
+    };
+
+    template<_impl::binary_arithmetic_op Operator, typename Lhs, typename Rhs>
+    struct custom_operator<Operator, op_value<Lhs, stochastic_rounding_tag>, op_value<Rhs, stochastic_rounding_tag>>
+        : Operator {
+    };
+
+    template<typename Lhs, typename Rhs>
+    struct custom_operator<_impl::divide_op, op_value<Lhs, stochastic_rounding_tag>, op_value<Rhs, stochastic_rounding_tag>> {
+    private:
+        using result_type = decltype(std::declval<Lhs>() / std::declval<Rhs>());
+
+    public:
+        // rounds the truncated quotient away from zero
+        // with a probability of |remainder / rhs|
+        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs, uint64 bits) const
+                -> result_type
+        {
+            auto const quotient = static_cast<result_type>(lhs / rhs);
+            auto const remainder = _impl::abs(static_cast<result_type>(lhs % rhs));
+            auto const noise = static_cast<result_type>(
+                    bits % static_cast<uint64>(_impl::abs(static_cast<result_type>(rhs))));
+            return (noise < remainder)
+                         ? static_cast<result_type>(((lhs < 0) != (rhs < 0)) ? quotient - 1 : quotient + 1)
+                         : quotient;
+        }
+
+        [[nodiscard]] auto operator()(Lhs const& lhs, Rhs const& rhs) const -> result_type
+        {
+            return (*this)(lhs, rhs, _impl::next_stochastic_rounding_bits());
+        }
+    };
+
+    template<_impl::shift_op Operator, typename Lhs, typename Rhs, tag RhsTag>
+    struct custom_operator<Operator, op_value<Lhs, stochastic_rounding_tag>, op_value<Rhs, RhsTag>> : Operator {
+    };
+
+    template<_impl::prefix_op Operator, typename Rhs>
+    struct custom_operator<Operator, op_value<Rhs, stochastic_rounding_tag>> : Operator {
+    };
+
+    template<_impl::postfix_op Operator, typename Lhs>
+    struct custom_operator<Operator, op_value<Lhs, stochastic_rounding_tag>> : Operator {
+    };
+
+    /// \brief converts a range of values using \ref cnl::stochastic_rounding_tag
+    ///
+    /// Equivalent to calling \ref cnl::convert once per element, in order, except that the random
+    /// bits for each element are computed independently of one another, so that the loop can be
+    /// vectorized. The calling thread's generator is advanced by `last - first`.
+    ///
+    /// \tparam SrcTag specifies the source behavior tag
+    /// \param first beginning of the range of values to convert from
+    /// \param last end of the range of values to convert from
+    /// \param d_first beginning of the range of values to convert to
+    /// \return end of the range of values converted to
+    ///
+    /// \headerfile cnl/rounding.h
+    /// \sa cnl::convert, cnl::seed_stochastic_rounding, cnl::stochastic_rounding_tag
+    template<tag SrcTag = _impl::native_tag, std::random_access_iterator InputIt, std::random_access_iterator OutputIt>
+    auto stochastic_convert(InputIt first, InputIt last, OutputIt d_first) -> OutputIt
+    {
+        using source = std::iter_value_t<InputIt>;
+        using destination = std::iter_value_t<OutputIt>;
+        using convert = custom_operator<
+                _impl::convert_op, op_value<source, SrcTag>, op_value<destination, stochastic_rounding_tag>>;
+
+        auto const size = last - first;
+        auto const state = _impl::reserve_stochastic_rounding_bits(static_cast<uint64>(size));
+        for (auto index = decltype(size){}; index != size; ++index) {
+            d_first[index] = convert{}(
+                    first[index],
+                    _impl::stochastic_rounding_bits(state.seed, state.counter + static_cast<uint64>(index)));
+        }
+        return d_first + size;
+    }
+}
+
+#endif  // CNL_IMPL_ROUNDING_STOCHASTIC_ROUNDING_TAG_H
@@ -0,0 +1,96 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_ROUNDING_TIE_TO_EVEN_ROUNDING_TAG_H)
+#define CNL_IMPL_ROUNDING_TIE_TO_EVEN_ROUNDING_TAG_H
+
+#include "../cmath/abs.h"
+#include "../custom_operator/definition.h"
+#include "../custom_operator/native_tag.h"
+#include "is_rounding_tag.h"
+#include "is_tag.h"
+
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief tag to specify round-half-to-even behavior in arithmetic operations
+    ///
+    /// Arithmetic operations using this tag round to the nearest representable value.
+    /// Values exactly half way between two representable values are rounded to the one
+    /// whose least significant digit is even. Also known as banker's rounding,
+    /// this avoids the upward bias which rounding half away from zero introduces
+    /// when rounding positive values.
+    ///
+    /// \headerfile cnl/rounding.h
+    /// \sa cnl::rounding_integer,
+    /// cnl::add, cnl::convert, cnl::divide, cnl::left_shift, cnl::multiply, cnl::subtract,
+    /// cnl::nearest_rounding_tag
+    struct tie_to_even_rounding_tag
+        : _impl::homogeneous_deduction_tag_base
+        , _impl::homogeneous_operator_tag_base {
+    };
+
+    namespace _impl {
+        template<>
+        struct is_rounding_tag<tie_to_even_rounding_tag> : std::true_type {
+        };
+
+        // rounds a floating-point value to the nearest integer, with ties to even
+        template<typename Integer, typename Float>
+        [[nodiscard]] constexpr auto tie_to_even_round(Float const& x)
+        {
+            auto const truncated = static_cast<Integer>(x);
+            auto const floored = static_cast<Integer>(
+                    truncated - static_cast<Integer>(x < static_cast<Float>(truncated)));
+            auto const fraction = x - static_cast<Float>(floored);
+            auto const round_up = (Float{.5} < fraction) || (fraction == Float{.5} && (floored & 1) != 0);
+            return static_cast<Integer>(floored + static_cast<Integer>(round_up));
+        }
+    }
+
+    template<_impl::unary_arithmetic_op Operator, typename Operand>
+    struct custom_operator<Operator, op_value<Operand, tie_to_even_rounding_tag>>
+        : custom_operator<Operator, op_value<Operand, _impl::native_tag>> {
+    };
+
+    template<_impl::binary_arithmetic_op Operator, typename Lhs, typename Rhs>
+    struct custom_operator<Operator, op_value<Lhs, tie_to_even_rounding_tag>, op_value<Rhs, tie_to_even_rounding_tag>>
+        : Operator {
+    };
+
+    template<typename Lhs, typename Rhs>
+    struct custom_operator<_impl::divide_op, op_value<Lhs, tie_to_even_rounding_tag>, op_value<Rhs, tie_to_even_rounding_tag>> {
+    private:
+        using result_type = decltype(std::declval<Lhs>() / std::declval<Rhs>());
+
+    public:
+        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const -> result_type
+        {
+            auto const quotient = static_cast<result_type>(lhs / rhs);
+            auto const remainder = _impl::abs(static_cast<result_type>(lhs % rhs));
+
+            // compares the remainder with its complement to avoid doubling it
+            auto const complement = static_cast<result_type>(_impl::abs(static_cast<result_type>(rhs)) - remainder);
+            auto const away = (complement < remainder) || (complement == remainder && (quotient & 1) != 0);
+            return away ? static_cast<result_type>(((lhs < 0) != (rhs < 0)) ? quotient - 1 : quotient + 1)
+                        : quotient;
+        }
+    };
+
+    template<_impl::shift_op Operator, typename Lhs, typename Rhs, tag RhsTag>
+    struct custom_operator<Operator, op_value<Lhs, tie_to_even_rounding_tag>, op_value<Rhs, RhsTag>> : Operator {
+    };
+
+    template<_impl::prefix_op Operator, typename Rhs>
+    struct custom_operator<Operator, op_value<Rhs, tie_to_even_rounding_tag>> : Operator {
+    };
+
+    template<_impl::postfix_op Operator, typename Lhs>
+    struct custom_operator<Operator, op_value<Lhs, tie_to_even_rounding_tag>> : Operator {
+    };
+}
+
+#endif  // CNL_IMPL_ROUNDING_TIE_TO_EVEN_ROUNDING_TAG_H
@@ -9,6 +9,7 @@
 
 #include "../custom_operator/definition.h"
 #include "../custom_operator/tagged.h"
+#include "../force_inline.h"
 #include "../num_traits/scale.h"
 #include "definition.h"
 #include "is_scaled_tag.h"
@@ -49,7 +50,7 @@ namespace cnl {
         static constexpr int _rhs_left_shift = RhsExponent - _common_exponent;
 
     public:
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
         {
             return _impl::binary_arithmetic_operate<Operator, _common_power>(
                     _impl::scale<_lhs_left_shift, Radix>(lhs),
@@ -70,7 +71,7 @@ namespace cnl {
             Operator,
             op_value<LhsRep, LhsTag>,
             op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(LhsRep const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(LhsRep const& lhs, Rhs const& rhs) const
         {
             return Operator{}(lhs, rhs);
         }
@@ -9,6 +9,7 @@
 
 #include "../custom_operator/definition.h"
 #include "../custom_operator/op.h"
+#include "../force_inline.h"
 #include "power.h"
 
 /// compositional numeric library
@@ -16,7 +17,7 @@ namespace cnl {
     template<_impl::unary_arithmetic_op Operator, typename Rep, int Exponent, int Radix>
     struct custom_operator<
             Operator, op_value<Rep, power<Exponent, Radix>>> {
-        [[nodiscard]] constexpr auto operator()(Rep const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Rep const& rhs) const
         {
             return Operator{}(rhs);
         }
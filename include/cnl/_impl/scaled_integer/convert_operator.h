@@ -9,11 +9,16 @@
 
 #include "../../floating_point.h"
 #include "../../integer.h"
+#include "../cmath/copysign.h"
+#include "../instrumentation.h"
 #include "../overflow/overflow_operator.h"
 #include "../power_value.h"
 #include "../rounding/native_rounding_tag.h"
 #include "../rounding/nearest_rounding_tag.h"
 #include "../rounding/neg_inf_rounding_tag.h"
+#include "../rounding/rounding_scale.h"
+#include "../rounding/stochastic_rounding_tag.h"
+#include "../rounding/tie_to_even_rounding_tag.h"
 #include "../rounding/tie_to_pos_inf_rounding_tag.h"
 #include "../scaled/is_scaled_tag.h"
 #include "definition.h"
@@ -41,7 +46,7 @@ namespace cnl {
             typename InputRep, int InputExponent,
             typename ResultRep, int ResultExponent,
             int Radix>
-    requires(!(ResultExponent <= InputExponent)) struct custom_operator<
+    requires(!(ResultExponent <= InputExponent) && !_impl::bitwise_rounding_rep<InputRep>) struct custom_operator<
             _impl::convert_op,
             op_value<scaled_integer<InputRep, power<InputExponent, Radix>>, power<0, Radix>>,
             op_value<scaled_integer<ResultRep, power<ResultExponent, Radix>>, nearest_rounding_tag>> {
@@ -57,11 +62,36 @@ namespace cnl {
     public:
         [[nodiscard]] constexpr auto operator()(_input const& from) const
         {
-            // TODO: unsigned specialization
+            CNL_INSTRUMENT(cnl::instrumentation::rounding_event, _impl::convert_op, _input, _result, nearest_rounding_tag);
             return static_cast<_result>(from + ((from >= 0) ? half() : -half()));
         }
     };
 
+    // conversion between two scaled_integer types where rounding *is* an issue
+    // and the rep is a plain integer which can be rounded without branching
+    template<
+            _impl::bitwise_rounding_rep InputRep, int InputExponent,
+            typename ResultRep, int ResultExponent,
+            int Radix>
+    requires(!(ResultExponent <= InputExponent)) struct custom_operator<
+            _impl::convert_op,
+            op_value<scaled_integer<InputRep, power<InputExponent, Radix>>, power<0, Radix>>,
+            op_value<scaled_integer<ResultRep, power<ResultExponent, Radix>>, nearest_rounding_tag>> {
+    private:
+        using _result = scaled_integer<ResultRep, power<ResultExponent, Radix>>;
+        using _input = scaled_integer<InputRep, power<InputExponent, Radix>>;
+
+    public:
+        [[nodiscard]] constexpr auto operator()(_input const& from) const -> _result
+        {
+            CNL_INSTRUMENT(cnl::instrumentation::rounding_event, _impl::convert_op, _input, _result, nearest_rounding_tag);
+            return _impl::from_rep<_result>(static_cast<ResultRep>(
+                    _impl::rounding_scale_down<
+                            nearest_rounding_tag, ResultExponent - InputExponent, Radix>(
+                            _impl::to_rep(from))));
+        }
+    };
+
     // conversion between two scaled_integer types where rounding *isn't* an issue
     template<
             typename InputRep, int InputExponent,
@@ -91,8 +121,7 @@ namespace cnl {
     public:
         [[nodiscard]] constexpr auto operator()(Input const& from) const
         {
-            // TODO: unsigned specialization
-            return static_cast<result>(from + ((from >= 0) ? half() : -half()));
+            return static_cast<result>(from + _impl::copysign(half(), from));
         }
     };
 
@@ -179,6 +208,7 @@ namespace cnl {
     public:
         [[nodiscard]] constexpr auto operator()(_input const& from) const -> _result
         {
+            CNL_INSTRUMENT(cnl::instrumentation::rounding_event, _impl::convert_op, _input, _result, tie_to_pos_inf_rounding_tag);
             // TODO: unsigned specialization
             return _impl::from_rep<_result>(
                     _impl::to_rep(from + half()) >> (ResultExponent - InputExponent));
@@ -272,6 +302,7 @@ namespace cnl {
     public:
         [[nodiscard]] constexpr auto operator()(_input const& from) const
         {
+            CNL_INSTRUMENT(cnl::instrumentation::rounding_event, _impl::convert_op, _input, _result, neg_inf_rounding_tag);
             // TODO: unsigned specialization
             return _impl::from_rep<_result>(
                     _impl::to_rep(from) >> (ResultExponent - InputExponent));
@@ -324,6 +355,240 @@ namespace cnl {
                                  op_value<scaled_integer<Result>, neg_inf_rounding_tag>>{}(from));
         }
     };
+
+    ////////////////////////////////////////////////////////
+    /// cnl::tie_to_even_rounding_tag
+
+    // conversion between two scaled_integer types where rounding *isn't* an issue
+    /// \cond
+    template<
+            typename InputRep, int InputExponent,
+            typename ResultRep, int ResultExponent,
+            int Radix>
+    requires(ResultExponent <= InputExponent) struct custom_operator<
+            _impl::convert_op,
+            op_value<scaled_integer<InputRep, power<InputExponent, Radix>>, _impl::native_tag>,
+            op_value<scaled_integer<ResultRep, power<ResultExponent, Radix>>, tie_to_even_rounding_tag>>
+        : custom_operator<
+                  _impl::convert_op,
+                  op_value<scaled_integer<InputRep, power<InputExponent, Radix>>, _impl::native_tag>,
+                  op_value<scaled_integer<ResultRep, power<ResultExponent, Radix>>, native_rounding_tag>> {
+    };
+
+    // conversion between two scaled_integer types where rounding *is* an issue
+    template<
+            typename InputRep, int InputExponent,
+            typename ResultRep, int ResultExponent,
+            int Radix>
+    requires(!(ResultExponent <= InputExponent) && !_impl::bitwise_rounding_rep<InputRep>) struct custom_operator<
+            _impl::convert_op,
+            op_value<scaled_integer<InputRep, power<InputExponent, Radix>>, _impl::native_tag>,
+            op_value<scaled_integer<ResultRep, power<ResultExponent, Radix>>, tie_to_even_rounding_tag>> {
+    private:
+        using _result = scaled_integer<ResultRep, power<ResultExponent, Radix>>;
+        using _input = scaled_integer<InputRep, power<InputExponent, Radix>>;
+        using _divide = custom_operator<
+                _impl::divide_op,
+                op_value<InputRep, tie_to_even_rounding_tag>,
+                op_value<InputRep, tie_to_even_rounding_tag>>;
+
+    public:
+        [[nodiscard]] constexpr auto operator()(_input const& from) const -> _result
+        {
+            CNL_INSTRUMENT(cnl::instrumentation::rounding_event, _impl::convert_op, _input, _result, tie_to_even_rounding_tag);
+            return _impl::from_rep<_result>(static_cast<ResultRep>(_divide{}(
+                    _impl::to_rep(from),
+                    _impl::power_value<InputRep, ResultExponent - InputExponent, Radix>())));
+        }
+    };
+
+    // conversion between two scaled_integer types where rounding *is* an issue
+    // and the rep is a plain integer which can be rounded without branching
+    template<
+            _impl::bitwise_rounding_rep InputRep, int InputExponent,
+            typename ResultRep, int ResultExponent,
+            int Radix>
+    requires(!(ResultExponent <= InputExponent)) struct custom_operator<
+            _impl::convert_op,
+            op_value<scaled_integer<InputRep, power<InputExponent, Radix>>, _impl::native_tag>,
+            op_value<scaled_integer<ResultRep, power<ResultExponent, Radix>>, tie_to_even_rounding_tag>> {
+    private:
+        using _result = scaled_integer<ResultRep, power<ResultExponent, Radix>>;
+        using _input = scaled_integer<InputRep, power<InputExponent, Radix>>;
+
+    public:
+        [[nodiscard]] constexpr auto operator()(_input const& from) const -> _result
+        {
+            CNL_INSTRUMENT(cnl::instrumentation::rounding_event, _impl::convert_op, _input, _result, tie_to_even_rounding_tag);
+            return _impl::from_rep<_result>(static_cast<ResultRep>(
+                    _impl::rounding_scale_down<
+                            tie_to_even_rounding_tag, ResultExponent - InputExponent, Radix>(
+                            _impl::to_rep(from))));
+        }
+    };
+    /// \endcond
+
+    // conversion from float to scaled_integer
+    template<
+            floating_point Input,
+            typename ResultRep, int ResultExponent, int ResultRadix>
+    struct custom_operator<
+            _impl::convert_op,
+            op_value<Input, _impl::native_tag>,
+            op_value<scaled_integer<ResultRep, power<ResultExponent, ResultRadix>>, tie_to_even_rounding_tag>> {
+    private:
+        using _result = scaled_integer<ResultRep, power<ResultExponent, ResultRadix>>;
+
+    public:
+        [[nodiscard]] constexpr auto operator()(Input const& from) const -> _result
+        {
+            return _impl::from_rep<_result>(_impl::tie_to_even_round<ResultRep>(
+                    from * _impl::power_value<Input, -ResultExponent, ResultRadix>()));
+        }
+    };
+
+    template<integer Input, integer ResultRep, scaled_tag ResultScale>
+    struct custom_operator<
+            _impl::convert_op,
+            op_value<Input, _impl::native_tag>,
+            op_value<scaled_integer<ResultRep, ResultScale>, tie_to_even_rounding_tag>>
+        : custom_operator<
+                  _impl::convert_op,
+                  op_value<scaled_integer<Input>, _impl::native_tag>,
+                  op_value<scaled_integer<ResultRep, ResultScale>, tie_to_even_rounding_tag>> {
+    };
+
+    template<integer InputRep, scaled_tag InputScale, integer Result>
+    struct custom_operator<
+            _impl::convert_op,
+            op_value<scaled_integer<InputRep, InputScale>, _impl::native_tag>,
+            op_value<Result, tie_to_even_rounding_tag>> {
+        using _input = scaled_integer<InputRep, InputScale>;
+
+        [[nodiscard]] constexpr auto operator()(_input const& from) const -> Result
+        {
+            return _impl::to_rep(custom_operator<
+                                 _impl::convert_op,
+                                 op_value<_input, _impl::native_tag>,
+                                 op_value<scaled_integer<Result>, tie_to_even_rounding_tag>>{}(from));
+        }
+    };
+
+    ////////////////////////////////////////////////////////
+    /// cnl::stochastic_rounding_tag
+
+    // conversion between two scaled_integer types where rounding *isn't* an issue
+    /// \cond
+    template<
+            typename InputRep, int InputExponent,
+            typename ResultRep, int ResultExponent,
+            int Radix>
+    requires(ResultExponent <= InputExponent) struct custom_operator<
+            _impl::convert_op,
+            op_value<scaled_integer<InputRep, power<InputExponent, Radix>>, _impl::native_tag>,
+            op_value<scaled_integer<ResultRep, power<ResultExponent, Radix>>, stochastic_rounding_tag>> {
+    private:
+        using _result = scaled_integer<ResultRep, power<ResultExponent, Radix>>;
+        using _input = scaled_integer<InputRep, power<InputExponent, Radix>>;
+
+    public:
+        [[nodiscard]] constexpr auto operator()(_input const& from, uint64 /*bits*/ = 0) const
+        {
+            return custom_operator<
+                    _impl::convert_op,
+                    op_value<_input, _impl::native_tag>,
+                    op_value<_result, native_rounding_tag>>{}(from);
+        }
+    };
+
+    // conversion between two scaled_integer types where rounding *is* an issue
+    template<
+            _impl::bitwise_rounding_rep InputRep, int InputExponent,
+            typename ResultRep, int ResultExponent,
+            int Radix>
+    requires(!(ResultExponent <= InputExponent)) struct custom_operator<
+            _impl::convert_op,
+            op_value<scaled_integer<InputRep, power<InputExponent, Radix>>, _impl::native_tag>,
+            op_value<scaled_integer<ResultRep, power<ResultExponent, Radix>>, stochastic_rounding_tag>> {
+    private:
+        using _result = scaled_integer<ResultRep, power<ResultExponent, Radix>>;
+        using _input = scaled_integer<InputRep, power<InputExponent, Radix>>;
+
+    public:
+        [[nodiscard]] constexpr auto operator()(_input const& from, uint64 bits) const -> _result
+        {
+            CNL_INSTRUMENT(cnl::instrumentation::rounding_event, _impl::convert_op, _input, _result, stochastic_rounding_tag);
+            return _impl::from_rep<_result>(static_cast<ResultRep>(
+                    _impl::rounding_scale_down<
+                            stochastic_rounding_tag, ResultExponent - InputExponent, Radix>(
+                            _impl::to_rep(from), bits)));
+        }
+
+        [[nodiscard]] auto operator()(_input const& from) const -> _result
+        {
+            return (*this)(from, _impl::next_stochastic_rounding_bits());
+        }
+    };
+    /// \endcond
+
+    // conversion from float to scaled_integer
+    template<
+            floating_point Input,
+            typename ResultRep, int ResultExponent, int ResultRadix>
+    struct custom_operator<
+            _impl::convert_op,
+            op_value<Input, _impl::native_tag>,
+            op_value<scaled_integer<ResultRep, power<ResultExponent, ResultRadix>>, stochastic_rounding_tag>> {
+    private:
+        using _result = scaled_integer<ResultRep, power<ResultExponent, ResultRadix>>;
+
+    public:
+        [[nodiscard]] constexpr auto operator()(Input const& from, uint64 bits) const -> _result
+        {
+            return _impl::from_rep<_result>(_impl::stochastic_round<ResultRep>(
+                    from * _impl::power_value<Input, -ResultExponent, ResultRadix>(), bits));
+        }
+
+        [[nodiscard]] auto operator()(Input const& from) const -> _result
+        {
+            return (*this)(from, _impl::next_stochastic_rounding_bits());
+        }
+    };
+
+    template<integer Input, integer ResultRep, scaled_tag ResultScale>
+    struct custom_operator<
+            _impl::convert_op,
+            op_value<Input, _impl::native_tag>,
+            op_value<scaled_integer<ResultRep, ResultScale>, stochastic_rounding_tag>>
+        : custom_operator<
+                  _impl::convert_op,
+                  op_value<scaled_integer<Input>, _impl::native_tag>,
+                  op_value<scaled_integer<ResultRep, ResultScale>, stochastic_rounding_tag>> {
+    };
+
+    template<integer InputRep, scaled_tag InputScale, integer Result>
+    struct custom_operator<
+            _impl::convert_op,
+            op_value<scaled_integer<InputRep, InputScale>, _impl::native_tag>,
+            op_value<Result, stochastic_rounding_tag>> {
+    private:
+        using _input = scaled_integer<InputRep, InputScale>;
+        using _convert = custom_operator<
+                _impl::convert_op,
+                op_value<_input, _impl::native_tag>,
+                op_value<scaled_integer<Result>, stochastic_rounding_tag>>;
+
+    public:
+        [[nodiscard]] constexpr auto operator()(_input const& from, uint64 bits) const -> Result
+        {
+            return _impl::to_rep(_convert{}(from, bits));
+        }
+
+        [[nodiscard]] auto operator()(_input const& from) const -> Result
+        {
+            return _impl::to_rep(_convert{}(from));
+        }
+    };
 }
 
 #endif  // CNL_IMPL_SCALED_INTEGER_TAGGED_CONVERT_OPERATOR_H
@@ -7,6 +7,7 @@
 #if !defined(CNL_IMPL_SCALED_INTEGER_FROM_REP_H)
 #define CNL_IMPL_SCALED_INTEGER_FROM_REP_H
 
+#include "../force_inline.h"
 #include "../num_traits/from_rep.h"
 #include "../wrapper/declaration.h"
 #include "definition.h"
@@ -23,7 +24,7 @@ namespace cnl {
         using result_type =
                 _impl::set_rep_t<scaled_integer<ArchetypeRep, power<Exponent, Radix>>, Rep>;
         /// \brief generates a \ref scaled_integer equivalent to \c r in type and value
-        [[nodiscard]] constexpr auto operator()(Rep const& r) const -> result_type
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Rep const& r) const -> result_type
         {
             return result_type(r, 0);
         }
@@ -0,0 +1,47 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief \ref cnl::scaled_integer specialization of \ref cnl::multiply_add
+
+#if !defined(CNL_IMPL_SCALED_INTEGER_MULTIPLY_ADD_H)
+#define CNL_IMPL_SCALED_INTEGER_MULTIPLY_ADD_H
+
+#include "../multiply_add.h"
+#include "../num_traits/scale.h"
+#include "definition.h"
+#include "from_rep.h"
+
+#include <type_traits>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    ////////////////////////////////////////////////////////////////////////////////
+    // cnl::multiply_add<scaled_integer, scaled_integer, scaled_integer>
+
+    // when the addend has the same or a greater exponent than the product, as with an accumulator,
+    // aligns the addend with the product and then forwards the calculation to the reps
+    template<typename RepA, int ExponentA, typename RepB, int ExponentB, typename RepC, int ExponentC, int Radix>
+    requires(ExponentA + ExponentB <= ExponentC) struct multiply_add<
+            scaled_integer<RepA, power<ExponentA, Radix>>, scaled_integer<RepB, power<ExponentB, Radix>>,
+            scaled_integer<RepC, power<ExponentC, Radix>>> {
+        using _a_type = scaled_integer<RepA, power<ExponentA, Radix>>;
+        using _b_type = scaled_integer<RepB, power<ExponentB, Radix>>;
+        using _c_type = scaled_integer<RepC, power<ExponentC, Radix>>;
+        using _result_type = decltype(std::declval<_a_type>() * std::declval<_b_type>() + std::declval<_c_type>());
+
+        [[nodiscard]] constexpr auto operator()(_a_type const& a, _b_type const& b, _c_type const& c) const
+                -> _result_type
+        {
+            auto const aligned_c = _impl::scale<ExponentC - (ExponentA + ExponentB), Radix>(_impl::to_rep(c));
+            return _impl::from_rep<_result_type>(
+                    multiply_add<RepA, RepB, std::remove_cvref_t<decltype(aligned_c)>>{}(
+                            _impl::to_rep(a), _impl::to_rep(b), aligned_c));
+        }
+    };
+}
+
+#endif  // CNL_IMPL_SCALED_INTEGER_MULTIPLY_ADD_H
@@ -10,6 +10,7 @@
 #if !defined(CNL_IMPL_SCALED_INTEGER_OPERATORS_H)
 #define CNL_IMPL_SCALED_INTEGER_OPERATORS_H
 
+#include "../force_inline.h"
 #include "../scaled/power.h"
 #include "definition.h"
 
@@ -37,7 +38,7 @@ namespace cnl {
                 power<LhsExponent, Radix>>;
         using operator_type = custom_operator<Operator, op_value<lhs_type>, op_value<rhs_type>>;
 
-        [[nodiscard]] constexpr auto operator()(
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(
                 scaled_integer<LhsRep, power<LhsExponent, Radix>> const& lhs,
                 scaled_integer<RhsRep, power<RhsExponent, Radix>> const& rhs) const
         {
@@ -61,7 +62,7 @@ namespace cnl {
         using rhs_type = scaled_integer<RhsRep, power<RhsExponent, Radix>>;
         using operator_type = custom_operator<Operator, op_value<lhs_type>, op_value<rhs_type>>;
 
-        [[nodiscard]] constexpr auto operator()(
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(
                 scaled_integer<LhsRep, power<LhsExponent, Radix>> const& lhs,
                 scaled_integer<RhsRep, power<RhsExponent, Radix>> const& rhs) const
         {
@@ -79,7 +80,7 @@ namespace cnl {
             op_value<scaled_integer<LhsRep, power<LhsExponent, LhsRadix>>>,
             op_value<constant<RhsValue>>> {
         using result_type = scaled_integer<LhsRep, power<LhsExponent + int(RhsValue), LhsRadix>>;
-        [[nodiscard]] constexpr auto operator()(
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(
                 scaled_integer<LhsRep, power<LhsExponent, LhsRadix>> const& lhs,
                 constant<RhsValue>) const
         {
@@ -94,7 +95,7 @@ namespace cnl {
             op_value<scaled_integer<LhsRep, power<LhsExponent, LhsRadix>>>,
             op_value<constant<RhsValue>>> {
         using result_type = scaled_integer<LhsRep, power<LhsExponent - int(RhsValue), LhsRadix>>;
-        [[nodiscard]] constexpr auto operator()(
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(
                 scaled_integer<LhsRep, power<LhsExponent, LhsRadix>> const& lhs,
                 constant<RhsValue>) const
         {
@@ -0,0 +1,134 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_SERIALIZE_BULK_H)
+#define CNL_IMPL_SERIALIZE_BULK_H
+
+#include "../wrapper/rep_span.h"
+#include "byteswap.h"
+#include "encoding.h"
+#include "serialize.h"
+
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <system_error>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // true iff an array of T can be copied to and from the fixed-width format as raw memory
+        template<typename T, typename Encoding>
+        [[nodiscard]] constexpr auto is_memcpy_serializable() -> bool
+        {
+            if constexpr (!std::is_same_v<Encoding, fixed_width_encoding_tag> || !serializable_number<T>) {
+                return false;
+            } else {
+                using wire_type = wire_integer_t<T>;
+                return integral<wire_type> && width<T> == width<wire_type> && rep_layout_of<T, wire_type>;
+            }
+        }
+
+        template<typename Encoding, typename T>
+        auto serialize_range(std::byte* first, std::byte* last, T const* values, std::size_t size)
+                -> serialize_result
+        {
+            if constexpr (is_memcpy_serializable<T, Encoding>()) {
+                auto const bytes = size * sizeof(T);
+                if (static_cast<std::size_t>(last - first) < bytes) {
+                    return serialize_result{last, std::errc::value_too_large};
+                }
+                if constexpr (std::endian::native == std::endian::little) {
+                    std::memcpy(first, values, bytes);
+                } else {
+                    for (auto index = std::size_t{0}; index != size; ++index) {
+                        auto const swapped = byteswap(cnl::unwrap(values[index]));
+                        std::memcpy(first + index * sizeof(T), &swapped, sizeof(T));
+                    }
+                }
+                return serialize_result{first + bytes, std::errc{}};
+            } else {
+                auto result = serialize_result{first, std::errc{}};
+                for (auto index = std::size_t{0}; index != size && result.ec == std::errc{};
+                     ++index) {
+                    result = serialize<Encoding>(result.ptr, last, values[index]);
+                }
+                return result;
+            }
+        }
+
+        template<typename Encoding, typename T>
+        auto deserialize_range(std::byte const* first, std::byte const* last, T* values, std::size_t size)
+                -> deserialize_result
+        {
+            if constexpr (is_memcpy_serializable<T, Encoding>()) {
+                auto const bytes = size * sizeof(T);
+                if (static_cast<std::size_t>(last - first) < bytes) {
+                    return deserialize_result{last, std::errc::invalid_argument};
+                }
+                std::memcpy(values, first, bytes);
+                if constexpr (std::endian::native != std::endian::little) {
+                    for (auto index = std::size_t{0}; index != size; ++index) {
+                        values[index] = cnl::wrap<T>(byteswap(cnl::unwrap(values[index])));
+                    }
+                }
+                return deserialize_result{first + bytes, std::errc{}};
+            } else {
+                auto result = deserialize_result{first, std::errc{}};
+                for (auto index = std::size_t{0}; index != size && result.ec == std::errc{};
+                     ++index) {
+                    result = deserialize<Encoding>(result.ptr, last, values[index]);
+                }
+                return result;
+            }
+        }
+    }
+
+    /// \brief writes a contiguous range of numbers to a buffer of bytes
+    ///
+    /// \tparam Encoding \ref cnl::fixed_width_encoding_tag (the default) or
+    ///         \ref cnl::varint_encoding_tag
+    /// \param out destination of the serialized values
+    /// \param values the numbers to write
+    ///
+    /// The output is the concatenation of the output of \ref cnl::serialize for each element.
+    /// Where the fixed-width format of an element is its object representation, e.g. for
+    /// `cnl::scaled_integer<int32, power<-16>>`, the range is copied with `std::memcpy` on
+    /// little-endian platforms and with byte-swap intrinsics on big-endian platforms.
+    ///
+    /// \sa cnl::deserialize
+    template<typename Encoding = fixed_width_encoding_tag, std::ranges::contiguous_range Values>
+    requires serializable<std::ranges::range_value_t<Values>>
+    auto serialize(std::span<std::byte> out, Values const& values) -> serialize_result
+    {
+        return _impl::serialize_range<Encoding>(
+                out.data(), out.data() + out.size(), std::ranges::data(values),
+                std::ranges::size(values));
+    }
+
+    /// \brief reads a contiguous range of numbers written by \ref cnl::serialize
+    ///
+    /// \tparam Encoding the encoding used to write the values
+    /// \param in source of the serialized values
+    /// \param values the numbers to assign, of which there are as many as were written
+    ///
+    /// On failure, the elements of `values` from the one which could not be read onward are
+    /// unspecified.
+    ///
+    /// \sa cnl::serialize
+    template<typename Encoding = fixed_width_encoding_tag, std::ranges::contiguous_range Values>
+    requires serializable<std::ranges::range_value_t<Values>>
+    auto deserialize(std::span<std::byte const> in, Values&& values) -> deserialize_result
+    {
+        return _impl::deserialize_range<Encoding>(
+                in.data(), in.data() + in.size(), std::ranges::data(values),
+                std::ranges::size(values));
+    }
+}
+
+#endif  // CNL_IMPL_SERIALIZE_BULK_H
@@ -0,0 +1,59 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_SERIALIZE_BYTESWAP_H)
+#define CNL_IMPL_SERIALIZE_BYTESWAP_H
+
+#include "../config.h"
+#include "../cstdint/types.h"
+#include "../numbers/set_signedness.h"
+#include "../type_traits/is_integral.h"
+
+#include <bit>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // reverses the order of the bytes of a fundamental integer; equivalent to C++23 std::byteswap
+        template<integral Integer>
+        [[nodiscard]] constexpr auto byteswap(Integer value) -> Integer
+        {
+            using unsigned_type = numbers::set_signedness_t<Integer, false>;
+            auto const u = static_cast<unsigned_type>(value);
+#if defined(CNL_GCC_INTRINSICS_ENABLED)
+            if constexpr (sizeof(Integer) == 2) {
+                return static_cast<Integer>(__builtin_bswap16(u));
+            } else if constexpr (sizeof(Integer) == 4) {
+                return static_cast<Integer>(__builtin_bswap32(u));
+            } else if constexpr (sizeof(Integer) == 8) {
+                return static_cast<Integer>(__builtin_bswap64(u));
+            }
+#endif
+            auto result = unsigned_type{};
+            for (auto byte = 0; byte != int{sizeof(Integer)}; ++byte) {
+                result = static_cast<unsigned_type>(
+                        (result << 8) | static_cast<uint8>(u >> (byte * 8)));
+            }
+            return static_cast<Integer>(result);
+        }
+
+        // converts between native byte order and little-endian byte order
+        template<integral Integer>
+        [[nodiscard]] constexpr auto little_endian(Integer value) -> Integer
+        {
+            static_assert(
+                    std::endian::native == std::endian::little
+                            || std::endian::native == std::endian::big,
+                    "mixed-endian platforms are not supported");
+            if constexpr (std::endian::native == std::endian::little) {
+                return value;
+            } else {
+                return byteswap(value);
+            }
+        }
+    }
+}
+
+#endif  // CNL_IMPL_SERIALIZE_BYTESWAP_H
@@ -0,0 +1,54 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_SERIALIZE_ENCODING_H)
+#define CNL_IMPL_SERIALIZE_ENCODING_H
+
+#include <cstddef>
+#include <system_error>
+
+/// compositional numeric library
+namespace cnl {
+    /// \brief tag specifying that \ref cnl::serialize writes every value of a type in the same
+    /// number of bytes
+    ///
+    /// A number occupies `ceil(W / 8)` bytes, where `W` is its width in bits (digits plus sign).
+    /// The bytes hold the two's complement value of the number's rep, least significant byte first.
+    ///
+    /// \sa cnl::varint_encoding_tag, cnl::serialized_size
+    struct fixed_width_encoding_tag {
+    };
+
+    /// \brief tag specifying that \ref cnl::serialize writes numbers of small magnitude in fewer bytes
+    ///
+    /// A number is written as a LEB128 variable-length integer: seven bits per byte, least
+    /// significant group first, with the top bit of every byte but the last set. Signed reps are
+    /// first zigzag-encoded so that values near zero, either side, stay short.
+    ///
+    /// \sa cnl::fixed_width_encoding_tag, cnl::serialized_size
+    struct varint_encoding_tag {
+    };
+
+    /// \brief result of \ref cnl::serialize
+    ///
+    /// As with `std::to_chars_result`, `ptr` is one past the last byte written on success and `ec`
+    /// is `std::errc::value_too_large` if the output is too small to hold the value.
+    struct serialize_result {
+        std::byte* ptr;
+        std::errc ec;
+    };
+
+    /// \brief result of \ref cnl::deserialize
+    ///
+    /// As with `std::from_chars_result`, `ptr` is one past the last byte read. `ec` is
+    /// `std::errc::invalid_argument` if the input ends before the value and
+    /// `std::errc::result_out_of_range` if the value does not fit in the destination type.
+    struct deserialize_result {
+        std::byte const* ptr;
+        std::errc ec;
+    };
+}
+
+#endif  // CNL_IMPL_SERIALIZE_ENCODING_H
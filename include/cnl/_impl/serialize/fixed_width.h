@@ -0,0 +1,92 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_SERIALIZE_FIXED_WIDTH_H)
+#define CNL_IMPL_SERIALIZE_FIXED_WIDTH_H
+
+#include "../cstdint/types.h"
+#include "../duplex_integer/is_duplex_integer.h"
+#include "../num_traits/width.h"
+#include "../numbers/set_signedness.h"
+#include "../numbers/signedness.h"
+#include "../type_traits/is_integral.h"
+#include "byteswap.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <type_traits>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // the fundamental integers and multi-word integers to which every serializable number unwraps
+        template<typename T>
+        concept wire_integer = integral<T> || any_duplex_integer<T>;
+
+        template<any_duplex_integer Duplex>
+        using duplex_upper_t = std::remove_cvref_t<decltype(std::declval<Duplex>().upper())>;
+
+        template<any_duplex_integer Duplex>
+        using duplex_lower_t = std::remove_cvref_t<decltype(std::declval<Duplex>().lower())>;
+
+        // writes the lowest Bytes bytes of value, least significant first
+        template<int Bytes, wire_integer Integer>
+        constexpr void write_fixed_width(Integer const& value, std::byte* out)
+        {
+            static_assert(Bytes * 8 <= width<Integer>);
+            if constexpr (any_duplex_integer<Integer>) {
+                constexpr auto lower_bytes = width<duplex_lower_t<Integer>> / 8;
+                static_assert(Bytes > lower_bytes);
+                write_fixed_width<lower_bytes>(value.lower(), out);
+                write_fixed_width<Bytes - lower_bytes>(value.upper(), out + lower_bytes);
+            } else if constexpr (Bytes == sizeof(Integer)) {
+                auto const bytes = std::bit_cast<std::array<std::byte, sizeof(Integer)>>(
+                        little_endian(value));
+                std::copy(begin(bytes), end(bytes), out);
+            } else {
+                for (auto byte = 0; byte != Bytes; ++byte) {
+                    out[byte] = static_cast<std::byte>(static_cast<uint8>(value >> (byte * 8)));
+                }
+            }
+        }
+
+        // reads Bytes bytes, least significant first, and sign-extends them if Integer is signed
+        template<wire_integer Integer, int Bytes>
+        [[nodiscard]] constexpr auto read_fixed_width(std::byte const* in) -> Integer
+        {
+            static_assert(Bytes * 8 <= width<Integer>);
+            if constexpr (any_duplex_integer<Integer>) {
+                using lower_type = duplex_lower_t<Integer>;
+                constexpr auto lower_bytes = width<lower_type> / 8;
+                static_assert(Bytes > lower_bytes);
+                return Integer(
+                        read_fixed_width<duplex_upper_t<Integer>, Bytes - lower_bytes>(in + lower_bytes),
+                        read_fixed_width<lower_type, lower_bytes>(in));
+            } else if constexpr (Bytes == sizeof(Integer)) {
+                auto bytes = std::array<std::byte, sizeof(Integer)>{};
+                std::copy(in, in + sizeof(Integer), begin(bytes));
+                return little_endian(std::bit_cast<Integer>(bytes));
+            } else {
+                using unsigned_type = numbers::set_signedness_t<Integer, false>;
+                auto u = unsigned_type{};
+                for (auto byte = 0; byte != Bytes; ++byte) {
+                    u = static_cast<unsigned_type>(
+                            u | static_cast<unsigned_type>(static_cast<uint8>(in[byte])) << (byte * 8));
+                }
+                if constexpr (numbers::signedness_v<Integer>) {
+                    constexpr auto unused = width<Integer> - Bytes * 8;
+                    return static_cast<Integer>(
+                            static_cast<Integer>(static_cast<unsigned_type>(u << unused)) >> unused);
+                } else {
+                    return u;
+                }
+            }
+        }
+    }
+}
+
+#endif  // CNL_IMPL_SERIALIZE_FIXED_WIDTH_H
@@ -0,0 +1,213 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_SERIALIZE_SERIALIZE_H)
+#define CNL_IMPL_SERIALIZE_SERIALIZE_H
+
+#include "../fraction/ctors.h"
+#include "../fraction/definition.h"
+#include "../num_traits/unwrap.h"
+#include "../num_traits/width.h"
+#include "../num_traits/wrap.h"
+#include "../numbers/signedness.h"
+#include "encoding.h"
+#include "fixed_width.h"
+#include "varint.h"
+
+#include <cstddef>
+#include <span>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        template<typename T>
+        inline constexpr bool is_fraction = false;
+
+        template<typename Numerator, typename Denominator>
+        inline constexpr bool is_fraction<fraction<Numerator, Denominator>> = true;
+
+        template<typename T>
+        using wire_integer_t = decltype(cnl::unwrap(std::declval<T>()));
+
+        // an integer, or a number which unwraps to one
+        template<typename T>
+        concept serializable_number = !is_fraction<T> && wire_integer<wire_integer_t<T>>;
+
+        template<typename T>
+        struct is_serializable : std::bool_constant<serializable_number<T>> {
+        };
+
+        template<typename Numerator, typename Denominator>
+        struct is_serializable<fraction<Numerator, Denominator>>
+            : std::bool_constant<
+                      serializable_number<Numerator> && serializable_number<Denominator>> {
+        };
+
+        template<typename T, typename Encoding>
+        struct serialized_size;
+
+        template<serializable_number T>
+        struct serialized_size<T, fixed_width_encoding_tag>
+            : std::integral_constant<int, (width<T> + 7) / 8> {
+        };
+
+        template<serializable_number T>
+        struct serialized_size<T, varint_encoding_tag>
+            : std::integral_constant<int, max_varint_bytes(width<T>)> {
+        };
+
+        template<typename Numerator, typename Denominator, typename Encoding>
+        struct serialized_size<fraction<Numerator, Denominator>, Encoding>
+            : std::integral_constant<
+                      int, serialized_size<Numerator, Encoding>::value
+                                   + serialized_size<Denominator, Encoding>::value> {
+        };
+
+        // true iff value, the wire integer of a T, is in the range of T
+        template<serializable_number T>
+        [[nodiscard]] constexpr auto in_range(wire_integer_t<T> const& value)
+        {
+            using wire_type = wire_integer_t<T>;
+            if constexpr (width<T> == width<wire_type>) {
+                return true;
+            } else if constexpr (numbers::signedness_v<wire_type>) {
+                auto const upper = static_cast<wire_type>(value >> (width<T> - 1));
+                return upper == wire_type{} || upper == static_cast<wire_type>(-1);
+            } else {
+                return static_cast<wire_type>(value >> width<T>) == wire_type{};
+            }
+        }
+
+        template<typename Encoding, serializable_number T>
+        constexpr auto serialize(std::byte* first, std::byte* last, T const& value)
+                -> serialize_result
+        {
+            if constexpr (std::is_same_v<Encoding, fixed_width_encoding_tag>) {
+                constexpr auto size = serialized_size<T, Encoding>::value;
+                if (last - first < size) {
+                    return serialize_result{last, std::errc::value_too_large};
+                }
+                write_fixed_width<size>(cnl::unwrap(value), first);
+                return serialize_result{first + size, std::errc{}};
+            } else {
+                auto const end = write_varint(cnl::unwrap(value), first, last);
+                return end ? serialize_result{end, std::errc{}}
+                           : serialize_result{last, std::errc::value_too_large};
+            }
+        }
+
+        template<typename Encoding, typename Numerator, typename Denominator>
+        constexpr auto serialize(
+                std::byte* first, std::byte* last, fraction<Numerator, Denominator> const& value)
+                -> serialize_result
+        {
+            auto const result = serialize<Encoding>(first, last, value.numerator);
+            if (result.ec != std::errc{}) {
+                return result;
+            }
+            return serialize<Encoding>(result.ptr, last, value.denominator);
+        }
+
+        template<typename Encoding, serializable_number T>
+        constexpr auto deserialize(std::byte const* first, std::byte const* last, T& value)
+                -> deserialize_result
+        {
+            using wire_type = wire_integer_t<T>;
+            auto wire = wire_type{};
+            auto result = deserialize_result{};
+            if constexpr (std::is_same_v<Encoding, fixed_width_encoding_tag>) {
+                constexpr auto size = serialized_size<T, Encoding>::value;
+                if (last - first < size) {
+                    return deserialize_result{last, std::errc::invalid_argument};
+                }
+                wire = read_fixed_width<wire_type, size>(first);
+                result = deserialize_result{first + size, std::errc{}};
+            } else {
+                result = read_varint(first, last, wire);
+                if (result.ec != std::errc{}) {
+                    return result;
+                }
+            }
+
+            if (!in_range<T>(wire)) {
+                return deserialize_result{result.ptr, std::errc::result_out_of_range};
+            }
+            value = cnl::wrap<T>(wire);
+            return result;
+        }
+
+        template<typename Encoding, typename Numerator, typename Denominator>
+        constexpr auto deserialize(
+                std::byte const* first, std::byte const* last,
+                fraction<Numerator, Denominator>& value) -> deserialize_result
+        {
+            auto numerator = Numerator{};
+            auto denominator = Denominator{};
+            auto result = deserialize<Encoding>(first, last, numerator);
+            if (result.ec == std::errc{}) {
+                result = deserialize<Encoding>(result.ptr, last, denominator);
+            }
+            if (result.ec == std::errc{}) {
+                value = fraction<Numerator, Denominator>{numerator, denominator};
+            }
+            return result;
+        }
+    }
+
+    /// \brief the types which \ref cnl::serialize can write: integers, numbers such as
+    /// \ref cnl::scaled_integer and \ref cnl::wide_integer which wrap integers, and \ref cnl::fraction
+    /// of these
+    template<typename T>
+    concept serializable = _impl::is_serializable<T>::value;
+
+    /// \brief the greatest number of bytes which \ref cnl::serialize writes for a value of type `T`
+    ///
+    /// \tparam T the type of the serialized value
+    /// \tparam Encoding \ref cnl::fixed_width_encoding_tag or \ref cnl::varint_encoding_tag
+    ///
+    /// With \ref cnl::fixed_width_encoding_tag, every value of `T` takes exactly this many bytes.
+    template<serializable T, typename Encoding = fixed_width_encoding_tag>
+    inline constexpr int serialized_size = _impl::serialized_size<T, Encoding>::value;
+
+    /// \brief writes a number to a buffer of bytes in a format independent of the platform
+    ///
+    /// \tparam Encoding \ref cnl::fixed_width_encoding_tag (the default) or
+    ///         \ref cnl::varint_encoding_tag
+    /// \param out destination of the serialized value
+    /// \param value the number to write
+    ///
+    /// \return the end of the written bytes and an error code; see \ref cnl::serialize_result
+    ///
+    /// Only the rep is written; type-level properties, such as the exponent of a
+    /// \ref cnl::scaled_integer, are not. A \ref cnl::fraction is written as its numerator then its
+    /// denominator.
+    ///
+    /// \sa cnl::deserialize, cnl::serialized_size
+    template<typename Encoding = fixed_width_encoding_tag, serializable T>
+    constexpr auto serialize(std::span<std::byte> out, T const& value) -> serialize_result
+    {
+        return _impl::serialize<Encoding>(out.data(), out.data() + out.size(), value);
+    }
+
+    /// \brief reads a number written by \ref cnl::serialize
+    ///
+    /// \tparam Encoding the encoding used to write the value
+    /// \param in source of the serialized value
+    /// \param value the number to assign; unchanged on failure
+    ///
+    /// \return the end of the read bytes and an error code; see \ref cnl::deserialize_result
+    ///
+    /// \sa cnl::serialize
+    template<typename Encoding = fixed_width_encoding_tag, serializable T>
+    constexpr auto deserialize(std::span<std::byte const> in, T& value) -> deserialize_result
+    {
+        return _impl::deserialize<Encoding>(in.data(), in.data() + in.size(), value);
+    }
+}
+
+#endif  // CNL_IMPL_SERIALIZE_SERIALIZE_H
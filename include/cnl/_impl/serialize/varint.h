@@ -0,0 +1,98 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_SERIALIZE_VARINT_H)
+#define CNL_IMPL_SERIALIZE_VARINT_H
+
+#include "../cstdint/types.h"
+#include "../num_traits/digits.h"
+#include "../num_traits/width.h"
+#include "../numbers/set_signedness.h"
+#include "../numbers/signedness.h"
+#include "encoding.h"
+#include "fixed_width.h"
+
+#include <cstddef>
+#include <system_error>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // the greatest number of bytes in the varint encoding of an integer of the given width
+        [[nodiscard]] constexpr auto max_varint_bytes(int width)
+        {
+            return (width + 6) / 7;
+        }
+
+        // maps signed values to unsigned values: 0, -1, 1, -2, 2... -> 0, 1, 2, 3, 4...
+        template<wire_integer Integer>
+        [[nodiscard]] constexpr auto zigzag(Integer const& value)
+        {
+            using unsigned_type = numbers::set_signedness_t<Integer, false>;
+            if constexpr (numbers::signedness_v<Integer>) {
+                return static_cast<unsigned_type>(
+                        static_cast<unsigned_type>(static_cast<unsigned_type>(value) << 1)
+                        ^ static_cast<unsigned_type>(value >> digits<Integer>));
+            } else {
+                return value;
+            }
+        }
+
+        template<wire_integer Integer>
+        [[nodiscard]] constexpr auto unzigzag(numbers::set_signedness_t<Integer, false> const& u)
+        {
+            if constexpr (numbers::signedness_v<Integer>) {
+                auto const magnitude = static_cast<Integer>(u >> 1);
+                return (u & 1) ? static_cast<Integer>(~magnitude) : magnitude;
+            } else {
+                return u;
+            }
+        }
+
+        // returns one past the last byte written or nullptr if [first, last) is too small
+        template<wire_integer Integer>
+        constexpr auto write_varint(Integer const& value, std::byte* first, std::byte* last)
+                -> std::byte*
+        {
+            auto u = zigzag(value);
+            using unsigned_type = decltype(u);
+            for (; first != last; ++first) {
+                auto const group = static_cast<uint8>(static_cast<uint8>(u) & 0x7f);
+                u = static_cast<unsigned_type>(u >> 7);
+                if (u == unsigned_type{}) {
+                    *first = std::byte{group};
+                    return first + 1;
+                }
+                *first = std::byte{static_cast<uint8>(group | 0x80)};
+            }
+            return nullptr;
+        }
+
+        template<wire_integer Integer>
+        constexpr auto read_varint(std::byte const* first, std::byte const* last, Integer& value)
+                -> deserialize_result
+        {
+            using unsigned_type = numbers::set_signedness_t<Integer, false>;
+            constexpr auto integer_width = width<Integer>;
+            auto u = unsigned_type{};
+            for (auto shift = 0; first != last; shift += 7) {
+                auto const byte = static_cast<uint8>(*first++);
+                auto const group = static_cast<uint8>(byte & 0x7f);
+                if (shift >= integer_width
+                    || (shift > integer_width - 7 && (group >> (integer_width - shift)) != 0)) {
+                    return deserialize_result{first, std::errc::result_out_of_range};
+                }
+                u = static_cast<unsigned_type>(u | static_cast<unsigned_type>(static_cast<unsigned_type>(group) << shift));
+                if (!(byte & 0x80)) {
+                    value = unzigzag<Integer>(u);
+                    return deserialize_result{first, std::errc{}};
+                }
+            }
+            return deserialize_result{last, std::errc::invalid_argument};
+        }
+    }
+}
+
+#endif  // CNL_IMPL_SERIALIZE_VARINT_H
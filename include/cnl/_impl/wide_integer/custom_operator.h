@@ -8,6 +8,7 @@
 #define CNL_IMPL_WIDE_INTEGER_GENERIC_H
 
 #include "../custom_operator/definition.h"
+#include "../force_inline.h"
 #include "../num_traits/to_rep.h"
 #include "definition.h"
 
@@ -25,7 +26,7 @@ namespace cnl {
                     Operator,
                     op_value<wide_integer<LhsDigits, LhsNarrowest>>,
                     op_value<wide_integer<RhsDigits, RhsNarrowest>>> {
-        [[nodiscard]] constexpr auto operator()(
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(
                 wide_integer<LhsDigits, LhsNarrowest> const& lhs,
                 wide_integer<RhsDigits, RhsNarrowest> const& rhs) const
         {
@@ -7,6 +7,7 @@
 #if !defined(CNL_IMPL_WIDE_INTEGER_FROM_REP_H)
 #define CNL_IMPL_WIDE_INTEGER_FROM_REP_H
 
+#include "../force_inline.h"
 #include "../num_traits/from_rep.h"
 #include "../wide_tag/declaration.h"
 #include "definition.h"
@@ -16,7 +17,7 @@
 namespace cnl {
     template<typename ArchetypeRep, int Digits, typename Narrowest, typename Rep>
     struct from_rep<_impl::wrapper<ArchetypeRep, wide_tag<Digits, Narrowest>>, Rep> {
-        [[nodiscard]] constexpr auto operator()(Rep const& rep) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Rep const& rep) const
                 -> _impl::set_rep_t<_impl::wrapper<ArchetypeRep, wide_tag<Digits, Narrowest>>, Rep>
         {
             return rep;
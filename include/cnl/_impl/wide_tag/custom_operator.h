@@ -9,6 +9,7 @@
 
 #include "../custom_operator/definition.h"
 #include "../custom_operator/native_tag.h"
+#include "../force_inline.h"
 #include "../num_traits/digits.h"
 #include "../num_traits/set_width.h"
 #include "../num_traits/to_rep.h"
@@ -39,7 +40,7 @@ namespace cnl {
     requires(!_impl::is_wide_tag<SrcTag>) struct custom_operator<
             _impl::convert_op,
             op_value<Src, SrcTag>, op_value<Dest, DestTag>> {
-        [[nodiscard]] constexpr auto operator()(Src const& from) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Src const& from) const
         {
             return custom_operator<_impl::convert_op, op_value<Src, SrcTag>, op_value<Dest>>{}(from);
         }
@@ -48,7 +49,7 @@ namespace cnl {
 
     template<typename Src, _impl::any_wide_tag SrcTag, typename Dest, tag DestTag>
     struct custom_operator<_impl::convert_op, op_value<Src, SrcTag>, op_value<Dest, DestTag>> {
-        [[nodiscard]] constexpr auto operator()(Src const& from) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Src const& from) const
         {
             return custom_operator<_impl::convert_op, op_value<Src>, op_value<Dest>>{}(from);
         }
@@ -77,7 +78,7 @@ namespace cnl {
         using result = typename result_tag::rep;
 
     public:
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const -> result
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const -> result
         {
             return static_cast<result>(Operator{}(lhs, rhs));
         }
@@ -88,7 +89,7 @@ namespace cnl {
             Operator,
             op_value<Lhs, wide_tag<LhsDigits, LhsNarrowest>>,
             op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
         {
             return Operator{}(lhs, rhs);
         }
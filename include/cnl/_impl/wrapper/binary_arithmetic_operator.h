@@ -9,10 +9,12 @@
 
 #include "../../floating_point.h"
 #include "../custom_operator/definition.h"
+#include "../custom_operator/flat_operator.h"
 #include "../custom_operator/is_same_tag_family.h"
 #include "../custom_operator/native_tag.h"
 #include "../custom_operator/op.h"
 #include "../custom_operator/overloads.h"
+#include "../force_inline.h"
 #include "../num_traits/set_rep.h"
 #include "../num_traits/set_tag.h"
 #include "is_wrapper.h"
@@ -27,7 +29,7 @@ namespace cnl {
     // higher OP any_wrapper
     template<_impl::binary_arithmetic_op Operator, floating_point Lhs, _impl::any_wrapper Rhs>
     struct custom_operator<Operator, op_value<Lhs>, op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
         {
             return Operator()(lhs, static_cast<Lhs>(rhs));
         }
@@ -36,7 +38,7 @@ namespace cnl {
     // any_wrapper OP higher
     template<_impl::binary_arithmetic_op Operator, _impl::any_wrapper Lhs, floating_point Rhs>
     struct custom_operator<Operator, op_value<Lhs>, op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
         {
             return Operator()(static_cast<Rhs>(lhs), rhs);
         }
@@ -45,7 +47,7 @@ namespace cnl {
     // lower OP any_wrapper
     template<_impl::binary_arithmetic_op Operator, class Lhs, class Rhs>
     requires _impl::number_can_wrap<Rhs, Lhs>::value struct custom_operator<Operator, op_value<Lhs>, op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
         {
             return Operator()(_impl::from_value<Rhs>(lhs), rhs);
         }
@@ -54,7 +56,7 @@ namespace cnl {
     // any_wrapper OP lower
     template<_impl::binary_arithmetic_op Operator, class Lhs, class Rhs>
     requires _impl::number_can_wrap<Lhs, Rhs>::value struct custom_operator<Operator, op_value<Lhs>, op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
         {
             return Operator()(lhs, from_value<Lhs, Rhs>{}(rhs));
         }
@@ -62,16 +64,20 @@ namespace cnl {
 
     template<_impl::binary_arithmetic_op Operator, _impl::any_wrapper Lhs, _impl::any_wrapper Rhs>
     requires(_impl::is_same_tag_family<_impl::tag_of_t<Lhs>, _impl::tag_of_t<Rhs>>::value) struct custom_operator<Operator, op_value<Lhs>, op_value<Rhs>> {
-        using _rep_operator = custom_operator<
+        using _tag_operator = custom_operator<
                 Operator,
                 op_value<_impl::rep_of_t<Lhs>, _impl::tag_of_t<Lhs>>,
                 op_value<_impl::rep_of_t<Rhs>, _impl::tag_of_t<Rhs>>>;
+        using _rep_operator = std::conditional_t<
+                _impl::is_transparent_operator<_tag_operator, Operator>,
+                _impl::flat_operator_t<Operator, _impl::rep_of_t<Lhs>, _impl::rep_of_t<Rhs>>,
+                _tag_operator>;
         using _result_rep = decltype(_rep_operator{}(
                 _impl::to_rep(std::declval<Lhs>()), _impl::to_rep(std::declval<Rhs>())));
         using _result_tag = _impl::op_result<Operator, _impl::tag_of_t<Lhs>, _impl::tag_of_t<Rhs>>;
         using _result_archetype = _impl::set_rep_t<_impl::set_tag_t<Lhs, _result_tag>, _result_rep>;
 
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
         {
             return _impl::from_rep<_result_archetype>(
                     _rep_operator{}(_impl::to_rep(lhs), _impl::to_rep(rhs)));
@@ -9,7 +9,9 @@
 
 #include "../../floating_point.h"
 #include "../custom_operator/definition.h"
+#include "../custom_operator/flat_operator.h"
 #include "../custom_operator/overloads.h"
+#include "../force_inline.h"
 #include "../num_traits/from_value.h"
 #include "definition.h"
 #include "operator_helpers.h"
@@ -21,7 +23,7 @@ namespace cnl {
     // higher OP wrapper
     template<_impl::comparison_op Operator, floating_point Lhs, _impl::any_wrapper Rhs>
     struct custom_operator<Operator, op_value<Lhs>, op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
         {
             return Operator()(lhs, static_cast<Lhs>(rhs));
         }
@@ -30,7 +32,7 @@ namespace cnl {
     // wrapper OP higher
     template<_impl::comparison_op Operator, _impl::any_wrapper Lhs, floating_point Rhs>
     struct custom_operator<Operator, op_value<Lhs>, op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
         {
             return Operator()(static_cast<Rhs>(lhs), rhs);
         }
@@ -39,7 +41,7 @@ namespace cnl {
     // lower OP wrapper
     template<_impl::comparison_op Operator, class Lhs, class Rhs>
     requires _impl::number_can_wrap<Rhs, Lhs>::value struct custom_operator<Operator, op_value<Lhs>, op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
         {
             return Operator()(_impl::from_value<Rhs>(lhs), rhs);
         }
@@ -48,7 +50,7 @@ namespace cnl {
     // wrapper OP lower
     template<_impl::comparison_op Operator, class Lhs, class Rhs>
     requires _impl::number_can_wrap<Lhs, Rhs>::value struct custom_operator<Operator, op_value<Lhs>, op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
         {
             return Operator()(lhs, from_value<Lhs, Rhs>{}(rhs));
         }
@@ -56,10 +58,10 @@ namespace cnl {
 
     template<_impl::comparison_op Operator, typename LhsRep, typename RhsRep, tag Tag>
     struct custom_operator<Operator, op_value<_impl::wrapper<LhsRep, Tag>>, op_value<_impl::wrapper<RhsRep, Tag>>> {
-        [[nodiscard]] constexpr auto operator()(
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(
                 _impl::wrapper<LhsRep, Tag> const& lhs, _impl::wrapper<RhsRep, Tag> const& rhs) const
         {
-            return Operator()(_impl::to_rep(lhs), _impl::to_rep(rhs));
+            return _impl::flat_operator_t<Operator, LhsRep, RhsRep>{}(_impl::to_rep(lhs), _impl::to_rep(rhs));
         }
     };
 }
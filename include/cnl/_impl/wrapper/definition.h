@@ -11,6 +11,7 @@
 
 #include "../custom_operator/definition.h"
 #include "../custom_operator/tagged.h"
+#include "../force_inline.h"
 #include "../num_traits/from_value.h"
 #include "can_convert_tag_family.h"
 #include "declaration.h"
@@ -30,7 +31,7 @@ namespace cnl {
 
         protected:
             /// constructor taking the rep type
-            constexpr wrapper(Rep r, int)
+            CNL_FORCE_INLINE constexpr wrapper(Rep r, int)
                 : _rep(std::move(std::move(r)))
             {
             }
@@ -40,7 +41,7 @@ namespace cnl {
             template<typename RhsRep, tag RhsTag>
             requires can_convert_tag_family<Tag, RhsTag>::value
                     // NOLINTNEXTLINE(hicpp-explicit-conversions, google-explicit-constructor)
-                    constexpr wrapper(wrapper<RhsRep, RhsTag> const& i)
+                    CNL_FORCE_INLINE constexpr wrapper(wrapper<RhsRep, RhsTag> const& i)
                 : _rep(convert<Tag, RhsTag, Rep>(to_rep(i)))
             {
             }
@@ -49,16 +50,16 @@ namespace cnl {
             template<_impl::any_wrapper Number>
             requires(!can_convert_tag_family<Tag, tag_of_t<Number>>::value)
                     // NOLINTNEXTLINE(hicpp-explicit-conversions, google-explicit-constructor)
-                    constexpr wrapper(Number const& i)
+                    CNL_FORCE_INLINE constexpr wrapper(Number const& i)
                 : _rep(convert<Tag, _impl::native_tag, Rep>(i))
             {
             }
 
             /// constructor taking a number type that isn't _impl::wrapper
             template<class S>
-            requires(!is_wrapper<S>)
+            requires(!is_wrapper<S> && arithmetic<S>)
                     // NOLINTNEXTLINE(hicpp-explicit-conversions, google-explicit-constructor)
-                    constexpr wrapper(S const& s)
+                    CNL_FORCE_INLINE constexpr wrapper(S const& s)
                 : _rep(convert<Tag, _impl::native_tag, Rep>(s))
 
             {
@@ -66,13 +67,13 @@ namespace cnl {
 
             template<class S>
             requires(!is_wrapper<S>)
-                    [[nodiscard]] constexpr explicit
+                    [[nodiscard]] CNL_FORCE_INLINE constexpr explicit
                     operator S() const
             {
                 return convert<_impl::native_tag, Tag, S>(_rep);
             }
 
-            [[nodiscard]] explicit constexpr operator bool() const
+            [[nodiscard]] CNL_FORCE_INLINE explicit constexpr operator bool() const
             {
                 return static_cast<bool>(_rep);
             }
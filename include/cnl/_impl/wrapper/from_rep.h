@@ -8,6 +8,7 @@
 #define CNL_IMPL_WRAPPER_FROM_REP_H
 
 #include "../custom_operator/tag.h"
+#include "../force_inline.h"
 #include "../num_traits/from_rep.h"
 #include "definition.h"
 #include "set_rep.h"
@@ -16,7 +17,7 @@
 namespace cnl {
     template<typename NumberRep, tag NumberTag, typename Rep>
     struct from_rep<_impl::wrapper<NumberRep, NumberTag>, Rep> {
-        [[nodiscard]] constexpr auto operator()(Rep const& rep) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Rep const& rep) const
                 -> _impl::set_rep_t<_impl::wrapper<NumberRep, NumberTag>, Rep>
         {
             return rep;
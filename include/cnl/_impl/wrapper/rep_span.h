@@ -0,0 +1,110 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(CNL_IMPL_WRAPPER_REP_SPAN_H)
+#define CNL_IMPL_WRAPPER_REP_SPAN_H
+
+#include "../num_traits/rep_of.h"
+#include "is_wrapper.h"
+
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+/// compositional numeric library
+namespace cnl {
+    namespace _impl {
+        // true iff Rep is T, the rep of T, the rep of the rep of T etc.,
+        // and every layer in between has the same object representation as its rep
+        template<typename T, typename Rep>
+        [[nodiscard]] constexpr auto is_rep_layout() -> bool
+        {
+            if constexpr (std::is_same_v<T, Rep>) {
+                return true;
+            } else if constexpr (!is_wrapper<T>) {
+                return false;
+            } else {
+                using rep = rep_of_t<T>;
+                return std::is_standard_layout_v<T> && std::is_trivially_copyable_v<T>
+                    && sizeof(T) == sizeof(rep) && alignof(T) == alignof(rep)
+                    && is_rep_layout<rep, Rep>();
+            }
+        }
+
+        template<typename T, typename Rep>
+        concept rep_layout_of = is_rep_layout<T, Rep>();
+
+        template<typename Range>
+        using span_of_t = decltype(std::span(std::declval<Range>()));
+
+        // Element with the const qualification of Range's elements
+        template<typename Range, typename Element>
+        using span_element_t = std::conditional_t<
+                std::is_const_v<typename span_of_t<Range>::element_type>,
+                Element const, Element>;
+    }
+
+    /// \brief views a contiguous range of integers as a span of numbers which they represent
+    ///
+    /// \tparam T the numeric type of the resulting span's elements
+    /// \param reps contiguous range of `T`'s rep -- or of the rep of `T`'s rep, and so on
+    ///
+    /// \return a `std::span` of `T` over the same memory as `reps`, with the same extent and
+    /// constness; no elements are copied
+    ///
+    /// The elements of the span have the values `cnl::from_rep<T>(r)` for each element, `r`,
+    /// of `reps` and writes through the span modify `reps`. Because `T` is implicitly
+    /// created by operations such as `std::memcpy`, `read` and `mmap`, buffers populated in these
+    /// ways can be viewed as `T`.
+    ///
+    /// \note `T` and its rep must share an object representation. This is the case for all CNL
+    /// numeric types whose rep is trivially copyable.
+    ///
+    /// \sa to_rep_span, from_rep
+    template<typename T, std::ranges::contiguous_range Reps>
+    requires _impl::rep_layout_of<T, std::ranges::range_value_t<Reps>>
+    [[nodiscard]] auto from_rep_span(Reps&& reps)
+    {
+        auto const span = std::span(std::forward<Reps>(reps));
+        using span_type = decltype(span);
+        using value_type = _impl::span_element_t<Reps, T>;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return std::span<value_type, span_type::extent>(
+                reinterpret_cast<value_type*>(span.data()), span.size());
+    }
+
+    /// \brief views a contiguous range of numbers as a span of their reps
+    ///
+    /// \tparam Rep the type of the resulting span's elements; defaults to the rep of the
+    /// range's elements but can be the rep of that rep, and so on
+    /// \param values contiguous range of numbers
+    ///
+    /// \return a `std::span` of `Rep` over the same memory as `values`, with the same extent and
+    /// constness; no elements are copied
+    ///
+    /// \sa from_rep_span, to_rep
+    template<typename Rep = void, std::ranges::contiguous_range Values>
+    requires _impl::any_wrapper<std::ranges::range_value_t<Values>> && _impl::rep_layout_of<
+            std::ranges::range_value_t<Values>,
+            std::conditional_t<
+                    std::is_void_v<Rep>, _impl::rep_of_t<std::ranges::range_value_t<Values>>,
+                    Rep>>
+    [[nodiscard]] auto to_rep_span(Values&& values)
+    {
+        auto const span = std::span(std::forward<Values>(values));
+        using span_type = decltype(span);
+        using rep_type = _impl::span_element_t<
+                Values, std::conditional_t<
+                                std::is_void_v<Rep>,
+                                _impl::rep_of_t<std::ranges::range_value_t<Values>>, Rep>>;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return std::span<rep_type, span_type::extent>(
+                reinterpret_cast<rep_type*>(span.data()), span.size());
+    }
+}
+
+#endif  // CNL_IMPL_WRAPPER_REP_SPAN_H
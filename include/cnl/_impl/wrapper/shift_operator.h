@@ -8,6 +8,7 @@
 #define CNL_IMPL_WRAPPER_SHIFT_OPERATOR_H
 
 #include "../custom_operator/native_tag.h"
+#include "../force_inline.h"
 #include "from_rep.h"
 #include "is_wrapper.h"
 #include "operator_helpers.h"
@@ -20,7 +21,7 @@ namespace cnl {
     // includes derived classes
     template<_impl::shift_op Operator, class Lhs, _impl::any_wrapper Rhs>
     requires(!_impl::is_wrapper<Lhs>) struct custom_operator<Operator, op_value<Lhs>, op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(Lhs const& lhs, Rhs const& rhs) const
         {
             return Operator()(lhs, _impl::rep_of_t<Rhs>{_impl::to_rep(rhs)});
         }
@@ -30,7 +31,7 @@ namespace cnl {
     template<_impl::shift_op Operator, _impl::any_wrapper Lhs, class Rhs>
     requires _impl::number_can_wrap<Lhs, Rhs>::value struct custom_operator<
             Operator, op_value<Lhs>, op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(
                 Lhs const& lhs, Rhs const& rhs) const
         {
             return _impl::from_rep<Lhs>(
@@ -44,7 +45,7 @@ namespace cnl {
     template<_impl::shift_op Operator, typename LhsRep, tag LhsTag, _impl::any_wrapper Rhs>
     struct custom_operator<
             Operator, op_value<_impl::wrapper<LhsRep, LhsTag>>, op_value<Rhs>> {
-        [[nodiscard]] constexpr auto operator()(
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(
                 _impl::wrapper<LhsRep, LhsTag> const& lhs, Rhs const& rhs) const
         {
             return _impl::from_rep<_impl::wrapper<LhsRep, LhsTag>>(
@@ -7,6 +7,7 @@
 #if !defined(CNL_IMPL_WRAPPER_TO_REP_H)
 #define CNL_IMPL_WRAPPER_TO_REP_H
 
+#include "../force_inline.h"
 #include "../num_traits/rep_of.h"
 #include "../num_traits/to_rep.h"
 #include "is_wrapper.h"
@@ -17,17 +18,17 @@ namespace cnl {
     struct to_rep<Number> {
         using rep_type = _impl::rep_of_t<Number>;
 
-        [[nodiscard]] constexpr auto& operator()(Number& n) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto& operator()(Number& n) const
         {
             return n._rep;
         }
 
-        [[nodiscard]] constexpr auto const& operator()(Number const& n) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto const& operator()(Number const& n) const
         {
             return n._rep;
         }
 
-        [[nodiscard]] constexpr auto&& operator()(Number&& n) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto&& operator()(Number&& n) const
         {
             return std::forward<rep_type>(n._rep);
         }
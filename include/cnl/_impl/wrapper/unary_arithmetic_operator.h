@@ -11,6 +11,7 @@
 #include "../custom_operator/definition.h"
 #include "../custom_operator/native_tag.h"
 #include "../custom_operator/overloads.h"
+#include "../force_inline.h"
 #include "definition.h"
 #include "from_rep.h"
 #include "make_wrapper.h"
@@ -20,7 +21,7 @@
 namespace cnl {
     template<_impl::unary_arithmetic_op Operator, typename Rep, tag Tag>
     struct custom_operator<Operator, op_value<_impl::wrapper<Rep, Tag>>> {
-        [[nodiscard]] constexpr auto operator()(_impl::wrapper<Rep, Tag> const& rhs) const
+        [[nodiscard]] CNL_FORCE_INLINE constexpr auto operator()(_impl::wrapper<Rep, Tag> const& rhs) const
         {
             return _impl::from_rep<_impl::wrapper<Rep, Tag>>(
                     custom_operator<Operator, op_value<Rep, Tag>>{}(_impl::to_rep(rhs)));
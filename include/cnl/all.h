@@ -149,23 +149,32 @@
 #include "arithmetic.h"
 #include "bit.h"
 #include "cmath.h"
+#include "complex.h"
+#include "compressed.h"
 #include "constant.h"
 #include "cstdint.h"
 #include "elastic_integer.h"
 #include "elastic_scaled_integer.h"
+#include "fft.h"
+#include "filter.h"
 #include "fixed_point.h"
 #include "floating_point.h"
 #include "fraction.h"
 #include "integer.h"
+#include "linalg.h"
 #include "num_traits.h"
 #include "number.h"
 #include "numeric.h"
 #include "numeric_limits.h"
 #include "overflow.h"
 #include "overflow_integer.h"
+#include "packed.h"
+#include "reduce.h"
+#include "rep_span.h"
 #include "rounding.h"
 #include "rounding_integer.h"
 #include "scaled_integer.h"
+#include "serialize.h"
 #include "static_integer.h"
 #include "static_number.h"
 #include "type_traits.h"
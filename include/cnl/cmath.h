@@ -13,6 +13,8 @@
 
 #include "_impl/cmath/abs.h"
 #include "_impl/cmath/sqrt.h"
+#include "_impl/multiply_add.h"
+#include "floating_point.h"
 
 #include <cmath>
 
@@ -20,7 +22,14 @@
 namespace cnl {
     using _impl::abs;
 
-    using std::sqrt;
+    /// \brief floating-point overload of cnl::sqrt
+    /// \headerfile cnl/cmath.h
+    /// \return square root of `x`
+    template<floating_point Float>
+    [[nodiscard]] inline auto sqrt(Float const& x)
+    {
+        return std::sqrt(x);
+    }
 }
 
 #endif  // CNL_CMATH_H
@@ -0,0 +1,63 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief module interface unit of the CNL numeric library
+///
+/// Provides the contents of \ref cnl/all.h as named module, `cnl`:
+/// \code
+/// import cnl;
+///
+/// auto n = cnl::static_number<15, -8>{1.25};
+/// \endcode
+///
+/// Everything declared by the headers is exported, including implementation details in
+/// `cnl::_impl`. Macros such as `CNL_INT128_ENABLED` are not exported. Auxiliary headers, such as
+/// \verbatim<cnl/auxiliary/boost.multiprecision.h>\endverbatim, must still be included.
+
+module;
+
+// standard headers used by CNL are included here so that they are not attached to module cnl
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <climits>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <numbers>
+#include <numeric>
+#include <ostream>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <version>
+
+export module cnl;
+
+export {
+#include "all.h"
+}
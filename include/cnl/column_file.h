@@ -0,0 +1,31 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file cnl/column_file.h
+/// \brief a self-describing file format for long sequences of a single number type,
+/// `cnl::column_writer` and `cnl::column_reader`
+///
+/// A column file consists of
+/// 1. a 64-byte \ref cnl::column_header which describes the element type, followed by
+/// 2. the fundamental rep of each element, little-endian, followed by zeros up to a multiple of 64
+///    bytes and
+/// 3. a \ref cnl::column_block for every \ref cnl::column_header::block_size elements.
+///
+/// Because the elements are stored as they are laid out in memory, \ref cnl::column_reader maps
+/// them with `mmap` and presents them as a `std::span` without parsing.
+///
+/// This header is not included by \ref cnl/all.h because it uses operating system facilities.
+
+#if !defined(CNL_COLUMN_FILE_H)
+#define CNL_COLUMN_FILE_H
+
+#include "_impl/column_file/block.h"
+#include "_impl/column_file/errc.h"
+#include "_impl/column_file/header.h"
+#include "_impl/column_file/reader.h"
+#include "_impl/column_file/type.h"
+#include "_impl/column_file/writer.h"
+
+#endif  // CNL_COLUMN_FILE_H
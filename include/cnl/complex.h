@@ -0,0 +1,18 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief complex numbers of any numeric type, `cnl::complex`, and kernels which operate on
+/// sequences of them stored as separate arrays, `cnl::complex_span`
+
+#if !defined(CNL_COMPLEX_H)
+#define CNL_COMPLEX_H
+
+#include "_impl/complex/definition.h"
+#include "_impl/complex/kernels.h"
+#include "_impl/complex/operators.h"
+#include "_impl/complex/span.h"
+
+#endif  // CNL_COMPLEX_H
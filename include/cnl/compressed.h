@@ -0,0 +1,15 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief arrays of numbers compressed as offsets from a frame of reference,
+/// `cnl::compressed_vector` and `cnl::decompress`
+
+#if !defined(CNL_COMPRESSED_H)
+#define CNL_COMPRESSED_H
+
+#include "_impl/compressed/vector.h"
+
+#endif  // CNL_COMPRESSED_H
@@ -0,0 +1,14 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief fast Fourier transform with block floating point scaling, `cnl::fft`
+
+#if !defined(CNL_FFT_H)
+#define CNL_FFT_H
+
+#include "_impl/fft/fft.h"
+
+#endif  // CNL_FFT_H
@@ -0,0 +1,15 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief digital filters with exact accumulation, `cnl::fir_filter` and `cnl::iir_filter`
+
+#if !defined(CNL_FILTER_H)
+#define CNL_FILTER_H
+
+#include "_impl/filter/fir.h"
+#include "_impl/filter/iir.h"
+
+#endif  // CNL_FILTER_H
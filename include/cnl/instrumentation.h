@@ -0,0 +1,106 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file cnl/instrumentation.h
+/// \brief counts of the operations, overflows, roundings and slow paths which CNL types perform
+///
+/// Define `CNL_USE_INSTRUMENTATION=1` to enable counting. Otherwise, no events are reported,
+/// the instrumentation points compile to nothing and \ref cnl::instrumentation::snapshot
+/// returns no counters.
+///
+/// Example:
+/// \code
+/// auto const counters = cnl::instrumentation::snapshot();
+/// cnl::instrumentation::write_csv(std::cout, counters);
+/// \endcode
+
+#if !defined(CNL_INSTRUMENTATION_H)
+#define CNL_INSTRUMENTATION_H
+
+#include "_impl/instrumentation.h"
+#include "_impl/instrumentation/counters.h"
+
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// compositional numeric library, instrumentation namespace
+namespace cnl::instrumentation {
+    /// \brief the number of times that an event occurred
+    /// \sa cnl::instrumentation::snapshot
+    struct counter {
+        /// name of the event, e.g. "overflow"
+        std::string_view event;
+
+        /// type of the operation, e.g. "cnl::_impl::add_op"
+        std::string operation;
+
+        /// comma-separated types to which the operation was applied
+        std::string type;
+
+        /// sum of the counts of all threads
+        uint64 count;
+    };
+
+    /// \brief returns the number of times that each event has occurred so far
+    ///
+    /// Counts of running threads and of threads which have finished are summed.
+    /// Events which have not occurred are not included.
+    inline auto snapshot() -> std::vector<counter>
+    {
+        auto& registry = _impl::get_instrumentation_registry();
+        auto const lock = std::lock_guard{registry.mutex};
+
+        auto counters = std::vector<counter>{};
+        for (auto index = std::size_t{0}; index != registry.keys.size(); ++index) {
+            auto count = registry.finished[index];
+            for (auto const* thread : registry.threads) {
+                count += (*thread)[index].load(std::memory_order_relaxed);
+            }
+            if (count) {
+                auto const& key = registry.keys[index];
+                counters.push_back(counter{key.event, key.operation, key.type, count});
+            }
+        }
+        return counters;
+    }
+
+    /// \brief sets all counts to zero
+    ///
+    /// \note An event which is counted by another thread during the call may be lost.
+    inline void reset()
+    {
+        auto& registry = _impl::get_instrumentation_registry();
+        auto const lock = std::lock_guard{registry.mutex};
+
+        registry.finished = {};
+        for (auto* thread : registry.threads) {
+            for (auto& count : *thread) {
+                count.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// \brief writes counters in CSV format with a header row: event, operation, type, count
+    inline void write_csv(std::ostream& out, std::vector<counter> const& counters)
+    {
+        auto const quoted = [](std::string_view field) {
+            auto result = std::string{"\""};
+            for (auto c : field) {
+                result += (c == '"') ? "\"\"" : std::string(1, c);
+            }
+            return result + "\"";
+        };
+
+        out << "event,operation,type,count\n";
+        for (auto const& c : counters) {
+            out << c.event << ',' << quoted(c.operation) << ',' << quoted(c.type) << ','
+                << static_cast<unsigned long long>(c.count) << '\n';
+        }
+    }
+}
+
+#endif  // CNL_INSTRUMENTATION_H
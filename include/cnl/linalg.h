@@ -0,0 +1,15 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief linear algebra kernels with exact accumulation, `cnl::dot` and `cnl::gemm`
+
+#if !defined(CNL_LINALG_H)
+#define CNL_LINALG_H
+
+#include "_impl/linalg/dot.h"
+#include "_impl/linalg/gemm.h"
+
+#endif  // CNL_LINALG_H
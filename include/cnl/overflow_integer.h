@@ -15,6 +15,7 @@
 #include "_impl/custom_operator/definition.h"
 #include "_impl/custom_operator/native_tag.h"
 #include "_impl/custom_operator/tagged.h"
+#include "_impl/multiply_add.h"
 #include "_impl/num_traits/from_value.h"
 #include "_impl/num_traits/from_value_recursive.h"
 #include "_impl/num_traits/rep_of.h"
@@ -43,6 +44,28 @@ namespace cnl {
         }
     };
 
+    ////////////////////////////////////////////////////////////////////////////////
+    // cnl::multiply_add<overflow_integer, overflow_integer, overflow_integer>
+
+    // calculates the exact result and then checks it for overflow once
+    template<typename RepA, typename RepB, typename RepC, overflow_tag Tag>
+    requires _impl::exactly_multiply_addable<RepA, RepB, RepC> struct multiply_add<
+            _impl::wrapper<RepA, Tag>, _impl::wrapper<RepB, Tag>, _impl::wrapper<RepC, Tag>> {
+        using _result_type = decltype(
+                std::declval<_impl::wrapper<RepA, Tag>>() * std::declval<_impl::wrapper<RepB, Tag>>()
+                + std::declval<_impl::wrapper<RepC, Tag>>());
+
+        [[nodiscard]] constexpr auto operator()(
+                _impl::wrapper<RepA, Tag> const& a, _impl::wrapper<RepB, Tag> const& b,
+                _impl::wrapper<RepC, Tag> const& c) const -> _result_type
+        {
+            return _impl::from_rep<_result_type>(
+                    convert<Tag, _impl::native_tag, _impl::rep_of_t<_result_type>>(
+                            _impl::exact_multiply_add<RepA, RepB, RepC>{}(
+                                    _impl::to_rep(a), _impl::to_rep(b), _impl::to_rep(c))));
+        }
+    };
+
     ////////////////////////////////////////////////////////////////////////////////
     // cnl::set_rep<Rep, OverflowTag>
 
@@ -0,0 +1,17 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief containers of numbers which occupy exactly as many bits as their digits and sign require,
+/// `cnl::packed_array` and `cnl::packed_vector`
+
+#if !defined(CNL_PACKED_H)
+#define CNL_PACKED_H
+
+#include "_impl/packed/array.h"
+#include "_impl/packed/bulk.h"
+#include "_impl/packed/vector.h"
+
+#endif  // CNL_PACKED_H
@@ -0,0 +1,16 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief exact sums of ranges which may be divided between threads, `cnl::reduce` and
+/// `cnl::transform_reduce`
+
+#if !defined(CNL_REDUCE_H)
+#define CNL_REDUCE_H
+
+#include "_impl/reduce/execution.h"
+#include "_impl/reduce/reduce.h"
+
+#endif  // CNL_REDUCE_H
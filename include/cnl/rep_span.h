@@ -0,0 +1,15 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief zero-copy views between buffers of numbers and buffers of their reps,
+/// `cnl::from_rep_span` and `cnl::to_rep_span`
+
+#if !defined(CNL_REP_SPAN_H)
+#define CNL_REP_SPAN_H
+
+#include "_impl/wrapper/rep_span.h"
+
+#endif  // CNL_REP_SPAN_H
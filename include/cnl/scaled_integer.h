@@ -18,6 +18,7 @@
 #include "_impl/scaled_integer/integer.h"
 #include "_impl/scaled_integer/is_wrapper.h"
 #include "_impl/scaled_integer/math.h"
+#include "_impl/scaled_integer/multiply_add.h"
 #include "_impl/scaled_integer/named.h"
 #include "_impl/scaled_integer/num_traits.h"
 #include "_impl/scaled_integer/numbers.h"
@@ -0,0 +1,17 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief platform-independent binary serialization of numbers, `cnl::serialize` and
+/// `cnl::deserialize`
+
+#if !defined(CNL_SERIALIZE_H)
+#define CNL_SERIALIZE_H
+
+#include "_impl/serialize/bulk.h"
+#include "_impl/serialize/encoding.h"
+#include "_impl/serialize/serialize.h"
+
+#endif  // CNL_SERIALIZE_H
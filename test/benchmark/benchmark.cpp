@@ -4,12 +4,16 @@
 //  (See accompanying file ../../LICENSE_1_0.txt or copy at
 //          http://www.boost.org/LICENSE_1_0.txt)
 
+#include "perf_counters.h"
 #include "sample_functions.h"
 
 #include <cnl/cmath.h>
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <vector>
+
 using cnl::numeric_limits;
 using cnl::scaled_integer;
 
@@ -26,12 +30,14 @@ static void add(benchmark::State& state)
 {
     auto addend1 = static_cast<T>(numeric_limits<T>::max() / 5);
     auto addend2 = static_cast<T>(numeric_limits<T>::max() / 3);
+    auto counters = perf_counters{};
     while (state.KeepRunning()) {
         benchmark::DoNotOptimize(addend1);
         benchmark::DoNotOptimize(addend2);
         auto value = addend1 + addend2;
         benchmark::DoNotOptimize(value);
     }
+    counters.report(state);
 }
 
 template<class T>
@@ -39,12 +45,14 @@ static void sub(benchmark::State& state)
 {
     auto minuend = static_cast<T>(numeric_limits<T>::max() / 5);
     auto subtrahend = static_cast<T>(numeric_limits<T>::max() / 3);
+    auto counters = perf_counters{};
     while (state.KeepRunning()) {
         benchmark::DoNotOptimize(minuend);
         benchmark::DoNotOptimize(subtrahend);
         auto value = minuend + subtrahend;
         benchmark::DoNotOptimize(value);
     }
+    counters.report(state);
 }
 
 template<class T>
@@ -52,12 +60,14 @@ static void mul(benchmark::State& state)
 {
     auto factor1 = static_cast<T>(numeric_limits<T>::max() / int8_t{5});
     auto factor2 = static_cast<T>(numeric_limits<T>::max() / int8_t{3});
+    auto counters = perf_counters{};
     while (state.KeepRunning()) {
         benchmark::DoNotOptimize(factor1);
         benchmark::DoNotOptimize(factor2);
         auto value = factor1 * factor2;
         benchmark::DoNotOptimize(value);
     }
+    counters.report(state);
 }
 
 template<class T>
@@ -65,23 +75,27 @@ static void div(benchmark::State& state)
 {
     auto nume = static_cast<T>(numeric_limits<T>::max() / int8_t{5});
     auto denom = static_cast<T>(numeric_limits<T>::max() / int8_t{3});
+    auto counters = perf_counters{};
     while (state.KeepRunning()) {
         benchmark::DoNotOptimize(nume);
         benchmark::DoNotOptimize(denom);
         auto value = nume / denom;
         benchmark::DoNotOptimize(value);
     }
+    counters.report(state);
 }
 
 template<class T>
 static void bm_sqrt(benchmark::State& state)
 {
     auto input = static_cast<T>(numeric_limits<T>::max() / int8_t{5});
+    auto counters = perf_counters{};
     while (state.KeepRunning()) {
         benchmark::DoNotOptimize(input);
         auto output = cnl::sqrt(input);
         benchmark::DoNotOptimize(output);
     }
+    counters.report(state);
 }
 
 template<class T>
@@ -90,6 +104,7 @@ static void bm_magnitude_squared(benchmark::State& state)
     auto x = T{1LL};
     auto y = T{4LL};
     auto z = T{9LL};
+    auto counters = perf_counters{};
     while (state.KeepRunning()) {
         benchmark::DoNotOptimize(x);
         benchmark::DoNotOptimize(y);
@@ -97,6 +112,7 @@ static void bm_magnitude_squared(benchmark::State& state)
         auto value = magnitude_squared(x, y, z);
         benchmark::DoNotOptimize(value);
     }
+    counters.report(state);
 }
 
 template<class T>
@@ -108,6 +124,7 @@ static void bm_circle_intersect_generic(benchmark::State& state)
     auto x2 = T{4LL};
     auto y2 = T{13LL};
     auto r2 = T{9LL};
+    auto counters = perf_counters{};
     while (state.KeepRunning()) {
         benchmark::DoNotOptimize(x1);
         benchmark::DoNotOptimize(y1);
@@ -118,6 +135,7 @@ static void bm_circle_intersect_generic(benchmark::State& state)
         auto value = circle_intersect_generic(x1, y1, r1, x2, y2, r2);
         benchmark::DoNotOptimize(value);
     }
+    counters.report(state);
 }
 
 template<class T>
@@ -129,6 +147,7 @@ static void circle_intersect_generic(benchmark::State& state)
     auto x2 = T{4};
     auto y2 = T{13};
     auto r2 = T{9};
+    auto counters = perf_counters{};
     while (state.KeepRunning()) {
         benchmark::DoNotOptimize(x1);
         benchmark::DoNotOptimize(y1);
@@ -139,6 +158,7 @@ static void circle_intersect_generic(benchmark::State& state)
         auto value = circle_intersect_generic(x1, y1, r1, x2, y2, r2);
         benchmark::DoNotOptimize(value);
     }
+    counters.report(state);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -153,6 +173,54 @@ using s15_16 = scaled_integer<int32_t, cnl::power<-16>>;
 using u32_32 = scaled_integer<uint64_t, cnl::power<-32>>;
 using s31_32 = scaled_integer<int64_t, cnl::power<-32>>;
 
+////////////////////////////////////////////////////////////////////////////////
+// requantization benchmarks
+
+// converts an array of s15_16 to s7_8 with the given rounding mode
+template<class RoundingTag>
+static void bm_requantize(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto input = std::vector<s15_16>(size);
+    auto output = std::vector<s7_8>(size);
+    auto rep = int32_t{-0x7f7f7f};
+    std::generate(begin(input), end(input), [&rep] {
+        rep += 0x3b9d;
+        return cnl::_impl::from_rep<s15_16>(rep);
+    });
+    auto counters = perf_counters{};
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.data());
+        std::transform(begin(input), end(input), begin(output), [](s15_16 const& from) {
+            return cnl::convert<RoundingTag, cnl::_impl::native_tag, s7_8>(from);
+        });
+        benchmark::ClobberMemory();
+    }
+    counters.report(state, state.range(0));
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
+// converts an array of s15_16 to s7_8 with cnl::stochastic_convert
+static void bm_requantize_stochastic_bulk(benchmark::State& state)
+{
+    auto const size = static_cast<std::size_t>(state.range(0));
+    auto input = std::vector<s15_16>(size);
+    auto output = std::vector<s7_8>(size);
+    auto rep = int32_t{-0x7f7f7f};
+    std::generate(begin(input), end(input), [&rep] {
+        rep += 0x3b9d;
+        return cnl::_impl::from_rep<s15_16>(rep);
+    });
+    auto counters = perf_counters{};
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(input.data());
+        cnl::stochastic_convert(begin(input), end(input), begin(output));
+        benchmark::ClobberMemory();
+    }
+    counters.report(state, state.range(0));
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // multi-type benchmark macros
 
@@ -230,3 +298,18 @@ FIXED_POINT_BENCHMARK_REAL(bm_circle_intersect_generic)
 // tests involving unoptimized math function, cnl::sqrt
 // NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
 FIXED_POINT_BENCHMARK_REAL(bm_sqrt)
+
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_requantize, cnl::native_rounding_tag)->Arg(1 << 12);
+
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_requantize, cnl::nearest_rounding_tag)->Arg(1 << 12);
+
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_requantize, cnl::tie_to_even_rounding_tag)->Arg(1 << 12);
+
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK_TEMPLATE1(bm_requantize, cnl::stochastic_rounding_tag)->Arg(1 << 12);
+
+// NOLINTNEXTLINE(cppcoreguidelines-owning-memory,cppcoreguidelines-avoid-non-const-global-variables)
+BENCHMARK(bm_requantize_stochastic_bulk)->Arg(1 << 12);
@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+
+"""Compares google/benchmark results against a stored baseline.
+
+Each CNL benchmark is compared relative to the equivalent benchmark of a native type (e.g.
+matrix/overflow_integer<saturated>/32/mul against matrix/native/32/mul) so that differences in
+machine load and speed between the two runs cancel out and what remains is the overhead of the
+CNL type. Benchmarks with no native equivalent are compared by absolute time.
+"""
+
+from argparse import ArgumentParser
+from json import dump, load, loads
+from math import comb, hypot
+from re import compile as compile_regex
+from subprocess import check_output
+from sys import exit, stderr
+
+# names of types in benchmark names and the native types to which they are compared
+native_equivalents = {
+    # benchmark.cpp
+    "u4_4": "uint8_t",
+    "s3_4": "int8_t",
+    "u8_8": "uint16_t",
+    "s7_8": "int16_t",
+    "u16_16": "uint32_t",
+    "s15_16": "int32_t",
+    "u32_32": "uint64_t",
+    "s31_32": "int64_t",
+
+    # kernels.cpp
+    "scaled_integer<int16>": "int16",
+    "scaled_integer<int32>": "int32",
+    "overflow_integer<saturated>": "int32",
+    "overflow_integer<trapping>": "int32",
+    "rounding_integer<nearest>": "int32",
+    "elastic_integer": "int32",
+    "static_number": "int32",
+    "wide_integer": "int64",
+}
+
+template_name_pattern = compile_regex(r"^([^<]+)<(.+)>$")
+matrix_name_pattern = compile_regex(r"^matrix/([^/]+)/([^/]+)/([^/]+)$")
+kernel_name_pattern = compile_regex(r"^kernel/([^/]+)/([^/]+)/([^/]+)$")
+
+
+def native_equivalent(name):
+    """Returns the name of the benchmark of the equivalent native type, or None."""
+    match = matrix_name_pattern.match(name)
+    if match:
+        family, width, operation = match.groups()
+        return None if family == "native" else "matrix/native/{}/{}".format(width, operation)
+
+    match = kernel_name_pattern.match(name)
+    if match:
+        kernel, type_name, size = match.groups()
+        native = native_equivalents.get(type_name)
+        return native and "kernel/{}/{}/{}".format(kernel, native, size)
+
+    match = template_name_pattern.match(name)
+    if match:
+        function, type_name = match.groups()
+        native = native_equivalents.get(type_name)
+        return native and "{}<{}>".format(function, native)
+
+    return None
+
+
+def run_benchmarks(args):
+    """Runs the benchmark executable and returns its JSON output."""
+    command = [
+        args.executable,
+        "--benchmark_format=json",
+        "--benchmark_repetitions={}".format(args.repetitions),
+        "--benchmark_filter={}".format(args.filter)
+    ]
+    return loads(check_output(command).decode("utf-8"))
+
+
+def samples_from_results(results, metric):
+    """Returns a dictionary of benchmark name to list of per-repetition values of the metric."""
+    samples = {}
+    for entry in results["benchmarks"]:
+        if entry.get("run_type", "iteration") != "iteration":
+            continue
+        name = entry.get("run_name", entry["name"])
+        samples.setdefault(name, []).append(float(entry[metric]))
+    return samples
+
+
+def median_interval(samples, confidence):
+    """Returns the median and a distribution-free confidence interval around it.
+
+    The interval is bounded by order statistics chosen using the binomial distribution, so it
+    makes no assumption about the distribution of the timings, which is typically skewed."""
+    ordered = sorted(samples)
+    count = len(ordered)
+    middle = count // 2
+    median = ordered[middle] if count % 2 else (ordered[middle - 1] + ordered[middle]) / 2
+
+    # widen the interval one order statistic at a time until it has the required coverage
+    low, high = middle - (0 if count % 2 else 1), middle
+    while low > 0:
+        coverage = sum(comb(count, k) for k in range(low + 1, high + 1)) / 2 ** count
+        if coverage >= confidence:
+            break
+        low, high = low - 1, high + 1
+    return median, ordered[low], ordered[min(high, count - 1)]
+
+
+class Measure:
+    """median and confidence interval of a benchmark, optionally relative to a native equivalent"""
+
+    def __init__(self, median, low, high, relative, unit):
+        self.median = median
+        self.low = low
+        self.high = high
+        self.relative = relative
+        self.unit = unit
+
+    def __str__(self):
+        unit = "x native" if self.relative else self.unit
+        return "{:.3g} [{:.3g}, {:.3g}] {}".format(self.median, self.low, self.high, unit)
+
+
+def measures_from_samples(samples, confidence, unit):
+    intervals = {name: median_interval(times, confidence) for name, times in samples.items()}
+    measures = {}
+    for name, (median, low, high) in intervals.items():
+        native = intervals.get(native_equivalent(name))
+        if native:
+            native_median, native_low, native_high = native
+            # combine the relative widths of the two intervals in quadrature
+            ratio = median / native_median
+            low_error = hypot((median - low) / median, (native_high - native_median) / native_median)
+            high_error = hypot((high - median) / median, (native_median - native_low) / native_median)
+            measures[name] = Measure(ratio, ratio * (1. - low_error), ratio * (1. + high_error), True, unit)
+        else:
+            measures[name] = Measure(median, low, high, False, unit)
+    return measures
+
+
+def find_regressions(baseline, current, threshold):
+    """Returns a list of (name, baseline, current) for benchmarks whose median exceeds the
+    baseline median by more than threshold and where each median lies outside the other's
+    confidence interval."""
+    regressions = []
+    for name in sorted(set(baseline) & set(current)):
+        before, after = baseline[name], current[name]
+        if before.relative != after.relative:
+            continue
+        if after.median > before.median * (1. + threshold) and after.low > before.median and after.median > before.high:
+            regressions.append((name, before, after))
+    return regressions
+
+
+def report_regressions(regressions, threshold):
+    lines = ["{} benchmark(s) regressed by more than {:.0%}:".format(len(regressions), threshold)]
+    for name, before, after in regressions:
+        lines += [
+            "",
+            name,
+            "  - baseline: {}".format(before),
+            "  + current:  {}".format(after),
+            "    change:   {:+.1%}".format(after.median / before.median - 1.)
+        ]
+    return "\n".join(lines)
+
+
+def record(args):
+    results = run_benchmarks(args)
+    with open(args.baseline, "w") as file:
+        dump(results, file, indent=2)
+
+
+def check(args):
+    with open(args.baseline) as file:
+        baseline_results = load(file)
+    if args.current:
+        with open(args.current) as file:
+            current_results = load(file)
+    else:
+        current_results = run_benchmarks(args)
+
+    unit = "ns" if args.metric.endswith("_time") else args.metric
+    baseline = measures_from_samples(samples_from_results(baseline_results, args.metric), args.confidence, unit)
+    current = measures_from_samples(samples_from_results(current_results, args.metric), args.confidence, unit)
+    regressions = find_regressions(baseline, current, args.threshold)
+    if regressions:
+        print(report_regressions(regressions, args.threshold))
+        return 1
+
+    print("no regressions among {} benchmark(s)".format(len(set(baseline) & set(current))))
+    return 0
+
+
+if __name__ == "__main__":
+    parser = ArgumentParser(description="Record a google/benchmark baseline or check the benchmarks against one.")
+    parser.add_argument("mode", choices=["record", "check"], help="record a new baseline or check against an existing one")
+    parser.add_argument("baseline", help="path to the baseline JSON file")
+    parser.add_argument("--current", help="check this JSON file of results instead of running the benchmarks")
+    parser.add_argument("--metric", help="field of the results to compare, e.g. real_time", default="cpu_time")
+    parser.add_argument("--executable", help="path to the benchmark executable", default="./test-benchmark")
+    parser.add_argument("--filter", help="filters benchmarks based on regex pattern", default=".*")
+    parser.add_argument("--repetitions", help="number of times to run each benchmark", type=int, default=9)
+    parser.add_argument("--confidence", help="confidence level of the interval around each median", type=float, default=.95)
+    parser.add_argument("--threshold", help="relative increase in median which counts as a regression", type=float, default=.1)
+
+    args = parser.parse_args()
+    if args.repetitions < 2:
+        stderr.write("at least two repetitions are required\n")
+        exit(2)
+
+    exit(record(args) if args.mode == "record" else check(args))
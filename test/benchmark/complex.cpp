@@ -0,0 +1,168 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief throughput benchmarks of cnl::complex_multiply and cnl::complex_norm
+///
+/// Benchmarks are named "complex/<operation>/<type>/<size>". Types named "q15" take parts of
+/// 16 bits and requantize the exact products to 16 bits, rounding to nearest. Types named
+/// "q15_exact" write the exact products, of 64 bits, instead. For comparison,
+/// types named "float" perform the same operation on separate arrays of float and types named
+/// "std_complex" on an array of std::complex<float>.
+
+#include "perf_counters.h"
+
+#include <cnl/complex.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <benchmark/benchmark.h>
+
+#include <complex>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace {
+    using q15 = cnl::scaled_integer<cnl::int16, cnl::power<-15>>;
+    using rounding_q15 = cnl::scaled_integer<cnl::rounding_integer<cnl::int16>, cnl::power<-15>>;
+
+    template<typename T>
+    auto make_buffer(std::size_t size, int seed)
+    {
+        auto buffer = std::vector<T>(size);
+        for (auto index = std::size_t{0}; index != size; ++index) {
+            buffer[index] = static_cast<T>(
+                    static_cast<float>((index * 7919 + seed * 104729) % 65535) / 32768.F - .99F);
+        }
+        return buffer;
+    }
+
+    template<typename Out>
+    void bm_multiply(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const a_real = make_buffer<q15>(size, 1);
+        auto const a_imag = make_buffer<q15>(size, 2);
+        auto const b_real = make_buffer<q15>(size, 3);
+        auto const b_imag = make_buffer<q15>(size, 4);
+        auto out_real = std::vector<Out>(size);
+        auto out_imag = std::vector<Out>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(a_real.data());
+            cnl::complex_multiply(
+                    cnl::complex_span{a_real, a_imag}, cnl::complex_span{b_real, b_imag},
+                    cnl::complex_span{out_real, out_imag});
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void bm_multiply_float(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const a_real = make_buffer<float>(size, 1);
+        auto const a_imag = make_buffer<float>(size, 2);
+        auto const b_real = make_buffer<float>(size, 3);
+        auto const b_imag = make_buffer<float>(size, 4);
+        auto out_real = std::vector<float>(size);
+        auto out_imag = std::vector<float>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(a_real.data());
+            for (auto index = std::size_t{0}; index != size; ++index) {
+                out_real[index] = a_real[index] * b_real[index] - a_imag[index] * b_imag[index];
+                out_imag[index] = a_real[index] * b_imag[index] + a_imag[index] * b_real[index];
+            }
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void bm_multiply_std_complex(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const a_real = make_buffer<float>(size, 1);
+        auto const a_imag = make_buffer<float>(size, 2);
+        auto const b_real = make_buffer<float>(size, 3);
+        auto const b_imag = make_buffer<float>(size, 4);
+        auto a = std::vector<std::complex<float>>(size);
+        auto b = std::vector<std::complex<float>>(size);
+        for (auto index = std::size_t{0}; index != size; ++index) {
+            a[index] = {a_real[index], a_imag[index]};
+            b[index] = {b_real[index], b_imag[index]};
+        }
+        auto out = std::vector<std::complex<float>>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(a.data());
+            for (auto index = std::size_t{0}; index != size; ++index) {
+                out[index] = a[index] * b[index];
+            }
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void bm_norm(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const real = make_buffer<q15>(size, 1);
+        auto const imag = make_buffer<q15>(size, 2);
+        auto out = std::vector<cnl::complex_norm_t<q15>>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(real.data());
+            cnl::complex_norm(cnl::complex_span{real, imag}, out);
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void bm_norm_float(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const real = make_buffer<float>(size, 1);
+        auto const imag = make_buffer<float>(size, 2);
+        auto out = std::vector<float>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(real.data());
+            for (auto index = std::size_t{0}; index != size; ++index) {
+                out[index] = real[index] * real[index] + imag[index] * imag[index];
+            }
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template<typename Function>
+    void register_complex(std::string const& name, Function* function)
+    {
+        benchmark::RegisterBenchmark(("complex/" + name).c_str(), function)
+                ->RangeMultiplier(64)
+                ->Range(1 << 10, 1 << 16);
+    }
+
+    auto register_all()
+    {
+        register_complex("multiply/q15", bm_multiply<rounding_q15>);
+        register_complex("multiply/q15_exact", bm_multiply<cnl::complex_product_t<q15, q15>>);
+        register_complex("multiply/float", bm_multiply_float);
+        register_complex("multiply/std_complex", bm_multiply_std_complex);
+        register_complex("norm/q15", bm_norm);
+        register_complex("norm/float", bm_norm_float);
+        return true;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+    [[maybe_unused]] auto const complex_registered = register_all();
+}
@@ -0,0 +1,117 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief throughput benchmarks of cnl::compressed_vector
+///
+/// Benchmarks are named "compressed/<operation>/<size>". "compressed/scan/<size>" sums the elements
+/// of a cnl::compressed_vector one decoded block at a time and "compressed/scan_raw/<size>" sums the
+/// same elements stored uncompressed.
+
+#include "perf_counters.h"
+
+#include <cnl/compressed.h>
+#include <cnl/scaled_integer.h>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr auto min_size = 1 << 10;
+    constexpr auto max_size = 1 << 24;
+    constexpr auto size_multiplier = 64;
+
+    using q16 = cnl::scaled_integer<cnl::int32, cnl::power<-16>>;
+
+    // a slowly-changing signal; each block of 128 elements needs 10 bits per element
+    auto make_signal(std::size_t size)
+    {
+        auto signal = std::vector<cnl::int32>(size);
+        auto state = cnl::uint32{1};
+        auto level = cnl::int32{0};
+        for (auto& sample : signal) {
+            state = state * 1664525U + 1013904223U;
+            level += static_cast<cnl::int32>(state >> 29U) - 3;
+            sample = level + static_cast<cnl::int32>((state >> 8U) & 0x1ffU);
+        }
+        return signal;
+    }
+
+    void bm_decompress(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const compressed = cnl::compressed_vector<q16>{make_signal(size)};
+        auto out = std::vector<cnl::int32>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(compressed.words().data());
+            cnl::decompress(compressed, out);
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(compressed.size_bytes()));
+    }
+
+    void bm_scan(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const compressed = cnl::compressed_vector<q16>{make_signal(size)};
+        auto block = std::array<cnl::int32, compressed.block_size>{};
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            auto sum = cnl::int64{0};
+            for (auto index = std::size_t{0}; index != compressed.num_blocks(); ++index) {
+                auto const decoded = std::span(block).first(compressed.block_length(index));
+                compressed.decompress_block(index, decoded);
+                sum = std::accumulate(begin(decoded), end(decoded), sum);
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(compressed.size_bytes()));
+    }
+
+    void bm_scan_raw(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const raw = make_signal(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(raw.data());
+            benchmark::DoNotOptimize(std::accumulate(begin(raw), end(raw), cnl::int64{0}));
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+        state.SetBytesProcessed(
+                state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(cnl::int32)));
+    }
+
+    template<typename Function>
+    void register_compressed(std::string const& name, Function* function)
+    {
+        benchmark::RegisterBenchmark(("compressed/" + name).c_str(), function)
+                ->RangeMultiplier(size_multiplier)
+                ->Range(min_size, max_size);
+    }
+
+    auto register_all()
+    {
+        register_compressed("decompress", bm_decompress);
+        register_compressed("scan", bm_scan);
+        register_compressed("scan_raw", bm_scan_raw);
+        return true;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+    [[maybe_unused]] auto const compressed_registered = register_all();
+}
@@ -0,0 +1,74 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief benchmarks of composite types built without optimization
+///
+/// Built into test-benchmark-debug with -O0 to track the cost of each level of a composite type
+/// in debug builds, where none of the levels are inlined. Also built into
+/// test-benchmark-debug-force-inline with CNL_USE_FORCE_INLINE enabled.
+
+#include <cnl/all.h>
+
+#include <benchmark/benchmark.h>
+
+BENCHMARK_MAIN();  // NOLINT
+
+namespace {
+    using static_number = cnl::static_number<15, -8>;
+
+    using safe_scaled_integer = cnl::scaled_integer<
+            cnl::rounding_integer<
+                    cnl::overflow_integer<cnl::int32, cnl::saturated_overflow_tag>,
+                    cnl::nearest_rounding_tag>,
+            cnl::power<-8>>;
+
+    template<class T>
+    void add(benchmark::State& state)
+    {
+        auto addend1 = T{1.25};
+        auto addend2 = T{2.5};
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(addend1);
+            benchmark::DoNotOptimize(addend2);
+            auto value = addend1 + addend2;
+            benchmark::DoNotOptimize(value);
+        }
+    }
+
+    template<class T>
+    void mul(benchmark::State& state)
+    {
+        auto factor1 = T{1.25};
+        auto factor2 = T{2.5};
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(factor1);
+            benchmark::DoNotOptimize(factor2);
+            auto value = factor1 * factor2;
+            benchmark::DoNotOptimize(value);
+        }
+    }
+
+    template<class T>
+    void less(benchmark::State& state)
+    {
+        auto lhs = T{1.25};
+        auto rhs = T{2.5};
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(lhs);
+            benchmark::DoNotOptimize(rhs);
+            auto value = lhs < rhs;
+            benchmark::DoNotOptimize(value);
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE1(add, static_number);
+BENCHMARK_TEMPLATE1(mul, static_number);
+BENCHMARK_TEMPLATE1(less, static_number);
+
+BENCHMARK_TEMPLATE1(add, safe_scaled_integer);
+BENCHMARK_TEMPLATE1(mul, safe_scaled_integer);
+BENCHMARK_TEMPLATE1(less, safe_scaled_integer);
@@ -0,0 +1,179 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief throughput benchmarks of cnl::fft
+///
+/// Benchmarks are named "fft/<type>/<size>". For comparison, types named "float" perform the
+/// same radix-4 and radix-2 stages in float, without scaling. Each iteration copies the input
+/// before transforming it.
+
+#include "perf_counters.h"
+
+#include <cnl/fft.h>
+#include <cnl/scaled_integer.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    using q15 = cnl::scaled_integer<cnl::int16, cnl::power<-15>>;
+    using q31 = cnl::scaled_integer<cnl::int32, cnl::power<-31>>;
+
+    template<typename T, std::size_t Size>
+    auto make_signal(int seed)
+    {
+        auto signal = std::vector<T>(Size);
+        for (auto index = std::size_t{0}; index != Size; ++index) {
+            signal[index] = static_cast<T>(
+                    static_cast<float>((index * 7919 + seed * 104729) % 2001) / 1000.F - 1.F);
+        }
+        return signal;
+    }
+
+    // a float FFT with the same stages and twiddle layout as cnl::fft
+    template<std::size_t Size>
+    class float_fft {
+    public:
+        float_fft()
+        {
+            for (auto stage = std::size_t{0}; stage != cnl::_impl::fft_stages<Size>; ++stage) {
+                auto const radix = cnl::_impl::fft_radix<Size>(stage);
+                auto const span = cnl::_impl::fft_span<Size>(stage);
+                auto const stride = span / radix;
+                for (auto power = std::size_t{1}; power != radix; ++power) {
+                    for (auto j = std::size_t{0}; j != stride; ++j) {
+                        auto const angle = -2 * std::numbers::pi * static_cast<double>(power * j) / static_cast<double>(span);
+                        _twiddle_real.push_back(static_cast<float>(std::cos(angle)));
+                        _twiddle_imag.push_back(static_cast<float>(std::sin(angle)));
+                    }
+                }
+            }
+        }
+
+        void operator()(float* real, float* imag) const
+        {
+            for (auto stage = std::size_t{0}; stage != cnl::_impl::fft_stages<Size>; ++stage) {
+                auto const radix = cnl::_impl::fft_radix<Size>(stage);
+                auto const span = cnl::_impl::fft_span<Size>(stage);
+                auto const stride = span / radix;
+                auto const* const wr = _twiddle_real.data() + cnl::_impl::fft_twiddle_offset<Size>(stage);
+                auto const* const wi = _twiddle_imag.data() + cnl::_impl::fft_twiddle_offset<Size>(stage);
+                for (auto first = std::size_t{0}; first != Size; first += span) {
+                    auto* const r = real + first;
+                    auto* const i = imag + first;
+                    if (radix == 2) {
+                        for (auto j = std::size_t{0}; j != stride; ++j) {
+                            auto const dr = r[j] - r[j + stride];
+                            auto const di = i[j] - i[j + stride];
+                            r[j] += r[j + stride];
+                            i[j] += i[j + stride];
+                            r[j + stride] = dr * wr[j] - di * wi[j];
+                            i[j + stride] = dr * wi[j] + di * wr[j];
+                        }
+                    } else {
+                        for (auto j = std::size_t{0}; j != stride; ++j) {
+                            auto const esr = r[j] + r[j + 2 * stride];
+                            auto const esi = i[j] + i[j + 2 * stride];
+                            auto const edr = r[j] - r[j + 2 * stride];
+                            auto const edi = i[j] - i[j + 2 * stride];
+                            auto const osr = r[j + stride] + r[j + 3 * stride];
+                            auto const osi = i[j + stride] + i[j + 3 * stride];
+                            auto const odr = r[j + stride] - r[j + 3 * stride];
+                            auto const odi = i[j + stride] - i[j + 3 * stride];
+                            auto const o1r = esr - osr;
+                            auto const o1i = esi - osi;
+                            auto const o2r = edr + odi;
+                            auto const o2i = edi - odr;
+                            auto const o3r = edr - odi;
+                            auto const o3i = edi + odr;
+                            r[j] = esr + osr;
+                            i[j] = esi + osi;
+                            r[j + stride] = o1r * wr[stride + j] - o1i * wi[stride + j];
+                            i[j + stride] = o1r * wi[stride + j] + o1i * wr[stride + j];
+                            r[j + 2 * stride] = o2r * wr[j] - o2i * wi[j];
+                            i[j + 2 * stride] = o2r * wi[j] + o2i * wr[j];
+                            r[j + 3 * stride] = o3r * wr[2 * stride + j] - o3i * wi[2 * stride + j];
+                            i[j + 3 * stride] = o3r * wi[2 * stride + j] + o3i * wr[2 * stride + j];
+                        }
+                    }
+                }
+            }
+            cnl::_impl::fft_bit_reverse<Size>(real, imag);
+        }
+
+    private:
+        std::vector<float> _twiddle_real;
+        std::vector<float> _twiddle_imag;
+    };
+
+    template<typename T, std::size_t Size>
+    void bm_fft(benchmark::State& state)
+    {
+        auto const in_real = make_signal<T, Size>(1);
+        auto const in_imag = make_signal<T, Size>(2);
+        auto real = std::array<T, Size>{};
+        auto imag = std::array<T, Size>{};
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            std::copy(begin(in_real), end(in_real), begin(real));
+            std::copy(begin(in_imag), end(in_imag), begin(imag));
+            benchmark::DoNotOptimize(cnl::fft(real, imag));
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, Size);
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(Size));
+    }
+
+    template<std::size_t Size>
+    void bm_fft_float(benchmark::State& state)
+    {
+        auto const in_real = make_signal<float, Size>(1);
+        auto const in_imag = make_signal<float, Size>(2);
+        auto real = std::array<float, Size>{};
+        auto imag = std::array<float, Size>{};
+        auto const fft = float_fft<Size>{};
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            std::copy(begin(in_real), end(in_real), begin(real));
+            std::copy(begin(in_imag), end(in_imag), begin(imag));
+            fft(real.data(), imag.data());
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, Size);
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(Size));
+    }
+
+    template<std::size_t... Sizes>
+    void register_sizes(std::string const& name, std::index_sequence<Sizes...>)
+    {
+        (benchmark::RegisterBenchmark(
+                 ("fft/" + name + "/" + std::to_string(Sizes)).c_str(),
+                 (name == "q15")   ? bm_fft<q15, Sizes>
+                 : (name == "q31") ? bm_fft<q31, Sizes>
+                                   : bm_fft_float<Sizes>),
+         ...);
+    }
+
+    auto register_all()
+    {
+        using sizes = std::index_sequence<256, 1024, 4096>;
+        register_sizes("q15", sizes{});
+        register_sizes("q31", sizes{});
+        register_sizes("float", sizes{});
+        return true;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+    [[maybe_unused]] auto const fft_registered = register_all();
+}
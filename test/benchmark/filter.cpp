@@ -0,0 +1,180 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief throughput benchmarks of cnl::fir_filter and cnl::iir_filter
+///
+/// Benchmarks are named "filter/<filter>/<type>/<size>". For comparison, types named "float"
+/// perform the same filtering with the same structure in float.
+
+#include "perf_counters.h"
+
+#include <cnl/filter.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr auto taps = std::size_t{32};
+
+    using q7 = cnl::scaled_integer<cnl::int8, cnl::power<-7>>;
+    using q15 = cnl::scaled_integer<cnl::int16, cnl::power<-15>>;
+    using q14 = cnl::scaled_integer<cnl::int16, cnl::power<-14>>;
+    using rounding_q15 = cnl::scaled_integer<cnl::rounding_integer<cnl::int16>, cnl::power<-15>>;
+
+    template<typename T>
+    auto make_signal(std::size_t size)
+    {
+        auto signal = std::vector<T>(size);
+        for (auto index = std::size_t{0}; index != size; ++index) {
+            signal[index] = static_cast<T>(static_cast<float>(index * 7919 % 2000) / 2000.F - .5F);
+        }
+        return signal;
+    }
+
+    template<typename T>
+    auto make_coefficients()
+    {
+        auto coefficients = std::array<T, taps>{};
+        for (auto tap = std::size_t{0}; tap != taps; ++tap) {
+            coefficients[tap] = static_cast<T>(1.F / taps);
+        }
+        return coefficients;
+    }
+
+    // a float FIR filter with the same structure as cnl::fir_filter
+    class float_fir_filter {
+    public:
+        explicit float_fir_filter(std::array<float, taps> const& coefficients)
+        {
+            std::copy(coefficients.rbegin(), coefficients.rend(), begin(_coefficients));
+        }
+
+        void process(std::span<float const> in, std::span<float> out)
+        {
+            _samples.resize(taps - 1 + in.size());
+            std::copy(begin(in), end(in), begin(_samples) + taps - 1);
+            std::fill(begin(out), end(out), 0.F);
+            for (auto tap = std::size_t{0}; tap != taps; ++tap) {
+                for (auto index = std::size_t{0}; index != in.size(); ++index) {
+                    out[index] += _coefficients[tap] * _samples[tap + index];
+                }
+            }
+            std::copy(end(_samples) - (taps - 1), end(_samples), begin(_samples));
+        }
+
+    private:
+        std::array<float, taps> _coefficients{};
+        std::vector<float> _samples = std::vector<float>(taps - 1);
+    };
+
+    // the products of Q15 samples with Q15 coefficients are summed in 64 bits
+    // and with Q7 coefficients, in 32 bits
+    template<typename Coeff>
+    void bm_fir(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const in = make_signal<q15>(size);
+        auto out = std::vector<rounding_q15>(size);
+        auto filter = cnl::fir_filter<Coeff, q15, taps, rounding_q15>{make_coefficients<Coeff>()};
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(in.data());
+            filter.process(in, out);
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void bm_fir_float(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const in = make_signal<float>(size);
+        auto out = std::vector<float>(size);
+        auto filter = float_fir_filter{make_coefficients<float>()};
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(in.data());
+            filter.process(in, out);
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // Butterworth low-pass with cut-off at a tenth of the sample rate
+    constexpr auto b0 = .06745527F;
+    constexpr auto b1 = .13491055F;
+    constexpr auto b2 = .06745527F;
+    constexpr auto a1 = -1.1429805F;
+    constexpr auto a2 = .4128016F;
+
+    void bm_iir(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const in = make_signal<q15>(size);
+        auto out = std::vector<rounding_q15>(size);
+        auto filter = cnl::iir_filter<q14, q15, rounding_q15>{{q14{b0}, q14{b1}, q14{b2}, q14{a1}, q14{a2}}};
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(in.data());
+            filter.process(in, out);
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void bm_iir_float(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const in = make_signal<float>(size);
+        auto out = std::vector<float>(size);
+        auto x = std::array<float, 2>{};
+        auto y = std::array<float, 2>{};
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(in.data());
+            for (auto index = std::size_t{0}; index != size; ++index) {
+                auto const x0 = in[index];
+                auto const y0 = b0 * x0 + b1 * x[0] + b2 * x[1] - a1 * y[0] - a2 * y[1];
+                x = {x0, x[0]};
+                y = {y0, y[0]};
+                out[index] = y0;
+            }
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template<typename Function>
+    void register_filter(std::string const& name, Function* function)
+    {
+        benchmark::RegisterBenchmark(("filter/" + name).c_str(), function)
+                ->RangeMultiplier(64)
+                ->Range(1 << 10, 1 << 16);
+    }
+
+    auto register_all()
+    {
+        register_filter("fir32/q15", bm_fir<q15>);
+        register_filter("fir32/q7_q15", bm_fir<q7>);
+        register_filter("fir32/float", bm_fir_float);
+        register_filter("biquad/q15", bm_iir);
+        register_filter("biquad/float", bm_iir_float);
+        return true;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+    [[maybe_unused]] auto const filter_registered = register_all();
+}
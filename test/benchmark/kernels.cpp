@@ -0,0 +1,255 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief throughput benchmarks of array kernels over buffers of CNL types
+///
+/// Unlike the single-value benchmarks, these process whole buffers with independent operations,
+/// so that the results show whether the kernels vectorize and how they scale with cache size.
+/// Benchmarks are named "kernel/<kernel>/<type>/<size>" and report items and bytes processed,
+/// and hardware counters per element where they are available.
+
+#include "perf_counters.h"
+
+#include <cnl/all.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+    ////////////////////////////////////////////////////////////////////////////////
+    // buffer sizes, in elements
+
+    constexpr auto min_size = 1 << 10;
+    constexpr auto max_size = 1 << 24;
+    constexpr auto size_multiplier = 16;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // helpers
+
+    // small values which are representable by every type and whose running sum stays small
+    template<typename T>
+    auto make_buffer(std::size_t size)
+    {
+        auto buffer = std::vector<T>(size);
+        auto index = 0;
+        std::generate(begin(buffer), end(buffer), [&index] {
+            return static_cast<T>(cnl::int64{(index++ % 7) - 3});
+        });
+        return buffer;
+    }
+
+    // alternately 1 and -1, so that the running sum of its products with the above stays small
+    template<typename T>
+    auto make_alternating_buffer(std::size_t size)
+    {
+        auto buffer = std::vector<T>(size);
+        auto index = 0;
+        std::generate(begin(buffer), end(buffer), [&index] {
+            return static_cast<T>(cnl::int64{((index++ & 1) != 0) ? -1 : 1});
+        });
+        return buffer;
+    }
+
+    template<typename T>
+    void set_processed(benchmark::State& state, int reads, int writes)
+    {
+        auto const items = state.iterations() * state.range(0);
+        state.SetItemsProcessed(items);
+        state.SetBytesProcessed(items * (reads + writes) * static_cast<std::int64_t>(sizeof(T)));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // kernels
+
+    // out[i] = a * x[i] + y[i]
+    template<typename T>
+    void bm_axpy(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const a = static_cast<T>(cnl::int64{2});
+        auto const x = make_buffer<T>(size);
+        auto const y = make_buffer<T>(size);
+        auto out = std::vector<T>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(x.data());
+            benchmark::DoNotOptimize(y.data());
+            for (auto i = std::size_t{}; i != size; ++i) {
+                out[i] = static_cast<T>(a * x[i] + y[i]);
+            }
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0));
+        set_processed<T>(state, 2, 1);
+    }
+
+    // sum of x[i] * y[i], accumulated in the product type
+    template<typename T>
+    void bm_dot(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const x = make_buffer<T>(size);
+        auto const y = make_alternating_buffer<T>(size);
+        using accumulator = decltype(x[0] * y[0]);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(x.data());
+            benchmark::DoNotOptimize(y.data());
+            auto sum = accumulator{};
+            for (auto i = std::size_t{}; i != size; ++i) {
+                sum = static_cast<accumulator>(sum + x[i] * y[i]);
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        counters.report(state, state.range(0));
+        set_processed<T>(state, 2, 0);
+    }
+
+    // 16-tap finite impulse response filter
+    template<typename T>
+    void bm_fir(benchmark::State& state)
+    {
+        constexpr auto num_taps = std::size_t{16};
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const taps = make_alternating_buffer<T>(num_taps);
+        auto const x = make_buffer<T>(size + num_taps - 1);
+        auto out = std::vector<T>(size);
+        using accumulator = decltype(taps[0] * x[0]);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(x.data());
+            for (auto i = std::size_t{}; i != size; ++i) {
+                auto sum = accumulator{};
+                for (auto tap = std::size_t{}; tap != num_taps; ++tap) {
+                    sum = static_cast<accumulator>(sum + taps[tap] * x[i + tap]);
+                }
+                out[i] = static_cast<T>(sum);
+            }
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0));
+        set_processed<T>(state, 1, 1);
+    }
+
+    // out[i] = x[i], converted to a narrower type
+    template<typename T, typename Narrow>
+    void bm_requantize(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const x = make_buffer<T>(size);
+        auto out = std::vector<Narrow>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(x.data());
+            std::transform(begin(x), end(x), begin(out), [](T const& element) {
+                return static_cast<Narrow>(element);
+            });
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0));
+        auto const items = state.iterations() * state.range(0);
+        state.SetItemsProcessed(items);
+        state.SetBytesProcessed(items * static_cast<std::int64_t>(sizeof(T) + sizeof(Narrow)));
+    }
+
+    // sum of x[i]
+    template<typename T>
+    void bm_sum(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const x = make_buffer<T>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(x.data());
+            auto sum = T{};
+            for (auto const& element : x) {
+                sum = static_cast<T>(sum + element);
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        counters.report(state, state.range(0));
+        set_processed<T>(state, 1, 0);
+    }
+
+    // greatest x[i]
+    template<typename T>
+    void bm_max(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const x = make_buffer<T>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(x.data());
+            auto greatest = x[0];
+            for (auto const& element : x) {
+                greatest = (greatest < element) ? element : greatest;
+            }
+            benchmark::DoNotOptimize(greatest);
+        }
+        counters.report(state, state.range(0));
+        set_processed<T>(state, 1, 0);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // registration
+
+    template<typename Function>
+    void register_kernel(std::string const& name, Function* function)
+    {
+        benchmark::RegisterBenchmark(("kernel/" + name).c_str(), function)
+                ->RangeMultiplier(size_multiplier)
+                ->Range(min_size, max_size);
+    }
+
+    template<typename T, typename Narrow>
+    void register_kernels(std::string const& name)
+    {
+        register_kernel("axpy/" + name, bm_axpy<T>);
+        register_kernel("dot/" + name, bm_dot<T>);
+        register_kernel("fir/" + name, bm_fir<T>);
+        register_kernel("requantize/" + name, bm_requantize<T, Narrow>);
+        register_kernel("sum/" + name, bm_sum<T>);
+        register_kernel("max/" + name, bm_max<T>);
+    }
+
+    auto register_all_kernels()
+    {
+        register_kernels<float, cnl::int16>("float");
+        register_kernels<double, float>("double");
+        register_kernels<cnl::int16, cnl::int8>("int16");
+        register_kernels<cnl::int32, cnl::int16>("int32");
+        register_kernels<cnl::int64, cnl::int32>("int64");
+        // exponents leave room for the products in the rep
+        register_kernels<
+                cnl::scaled_integer<cnl::int16, cnl::power<-4>>,
+                cnl::scaled_integer<cnl::int8, cnl::power<-2>>>("scaled_integer<int16>");
+        register_kernels<
+                cnl::scaled_integer<cnl::int32, cnl::power<-8>>,
+                cnl::scaled_integer<cnl::int16, cnl::power<-4>>>("scaled_integer<int32>");
+        register_kernels<
+                cnl::overflow_integer<cnl::int32, cnl::saturated_overflow_tag>,
+                cnl::overflow_integer<cnl::int16, cnl::saturated_overflow_tag>>("overflow_integer<saturated>");
+        register_kernels<
+                cnl::overflow_integer<cnl::int32, cnl::trapping_overflow_tag>,
+                cnl::overflow_integer<cnl::int16, cnl::trapping_overflow_tag>>("overflow_integer<trapping>");
+        register_kernels<
+                cnl::rounding_integer<cnl::int32, cnl::nearest_rounding_tag>,
+                cnl::rounding_integer<cnl::int16, cnl::nearest_rounding_tag>>("rounding_integer<nearest>");
+        register_kernels<cnl::elastic_integer<31>, cnl::elastic_integer<15>>("elastic_integer");
+        register_kernels<cnl::static_number<31, -16>, cnl::static_number<15, -8>>("static_number");
+        register_kernels<cnl::wide_integer<127>, cnl::wide_integer<63>>("wide_integer");
+        return true;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+    [[maybe_unused]] auto const kernels_registered = register_all_kernels();
+}
@@ -0,0 +1,196 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief throughput benchmarks of cnl::dot and cnl::gemm
+///
+/// Benchmarks are named "linalg/<operation>/<type>/<size>". For comparison, types named "float"
+/// perform the same calculation on float and types named "int64" widen every product of the 8-bit
+/// reps to 64 bits in a hand-written loop. GEMM sizes are the dimension of square matrices.
+
+#include "perf_counters.h"
+
+#include <cnl/linalg.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+    using q7 = cnl::scaled_integer<cnl::int8, cnl::power<-7>>;
+    using rounding_q7 = cnl::scaled_integer<cnl::rounding_integer<cnl::int8>, cnl::power<-7>>;
+
+    template<typename T>
+    auto make_buffer(std::size_t size)
+    {
+        auto buffer = std::vector<T>(size);
+        for (auto index = std::size_t{0}; index != size; ++index) {
+            buffer[index] = static_cast<T>(static_cast<float>(index * 37 % 255) / 128.F - .99F);
+        }
+        return buffer;
+    }
+
+    void bm_dot(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const a = make_buffer<q7>(size);
+        auto const b = make_buffer<q7>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(a.data());
+            benchmark::DoNotOptimize(cnl::dot(a, b));
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void bm_dot_int64(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const a = make_buffer<q7>(size);
+        auto const b = make_buffer<q7>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(a.data());
+            auto sum = cnl::int64{0};
+            for (auto index = std::size_t{0}; index != size; ++index) {
+                sum += cnl::int64{cnl::unwrap(a[index])} * cnl::unwrap(b[index]);
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void bm_dot_float(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const a = make_buffer<float>(size);
+        auto const b = make_buffer<float>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(a.data());
+            auto sum = 0.F;
+            for (auto index = std::size_t{0}; index != size; ++index) {
+                sum += a[index] * b[index];
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // items are multiply-adds
+    void set_gemm_processed(benchmark::State& state)
+    {
+        auto const size = state.range(0);
+        state.SetItemsProcessed(state.iterations() * size * size * size);
+    }
+
+    void bm_gemm(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const a = make_buffer<q7>(size * size);
+        auto const b = make_buffer<q7>(size * size);
+        auto c = std::vector<rounding_q7>(size * size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(a.data());
+            cnl::gemm(a, b, c, size, size, size);
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0) * state.range(0) * state.range(0));
+        set_gemm_processed(state);
+    }
+
+    // the loop order which a hand-written GEMM typically uses
+    void bm_gemm_int64(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const a = make_buffer<q7>(size * size);
+        auto const b = make_buffer<q7>(size * size);
+        auto totals = std::vector<cnl::int64>(size * size);
+        auto c = std::vector<rounding_q7>(size * size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(a.data());
+            std::fill(begin(totals), end(totals), cnl::int64{0});
+            for (auto row = std::size_t{0}; row != size; ++row) {
+                for (auto depth = std::size_t{0}; depth != size; ++depth) {
+                    auto const element_a = cnl::int64{cnl::unwrap(a[row * size + depth])};
+                    for (auto column = std::size_t{0}; column != size; ++column) {
+                        totals[row * size + column] += element_a * cnl::unwrap(b[depth * size + column]);
+                    }
+                }
+            }
+            for (auto index = std::size_t{0}; index != c.size(); ++index) {
+                c[index] = static_cast<rounding_q7>(
+                        cnl::wrap<cnl::scaled_integer<cnl::int64, cnl::power<-14>>>(totals[index]));
+            }
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0) * state.range(0) * state.range(0));
+        set_gemm_processed(state);
+    }
+
+    void bm_gemm_float(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const a = make_buffer<float>(size * size);
+        auto const b = make_buffer<float>(size * size);
+        auto c = std::vector<float>(size * size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(a.data());
+            std::fill(begin(c), end(c), 0.F);
+            for (auto row = std::size_t{0}; row != size; ++row) {
+                for (auto depth = std::size_t{0}; depth != size; ++depth) {
+                    auto const element_a = a[row * size + depth];
+                    for (auto column = std::size_t{0}; column != size; ++column) {
+                        c[row * size + column] += element_a * b[depth * size + column];
+                    }
+                }
+            }
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0) * state.range(0) * state.range(0));
+        set_gemm_processed(state);
+    }
+
+    template<typename Function>
+    void register_dot(std::string const& name, Function* function)
+    {
+        benchmark::RegisterBenchmark(("linalg/dot/" + name).c_str(), function)
+                ->RangeMultiplier(64)
+                ->Range(1 << 10, 1 << 22);
+    }
+
+    template<typename Function>
+    void register_gemm(std::string const& name, Function* function)
+    {
+        benchmark::RegisterBenchmark(("linalg/gemm/" + name).c_str(), function)
+                ->RangeMultiplier(4)
+                ->Range(16, 256);
+    }
+
+    auto register_all()
+    {
+        register_dot("q7", bm_dot);
+        register_dot("int64", bm_dot_int64);
+        register_dot("float", bm_dot_float);
+        register_gemm("q7", bm_gemm);
+        register_gemm("int64", bm_gemm_int64);
+        register_gemm("float", bm_gemm_float);
+        return true;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+    [[maybe_unused]] auto const linalg_registered = register_all();
+}
@@ -0,0 +1,265 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief benchmarks of each operation on each CNL type family at a range of widths
+///
+/// Benchmarks are named "matrix/<family>/<width>/<operation>", e.g. "matrix/elastic_integer/32/mul",
+/// so that the results can be filtered along any axis with `--benchmark_filter`.
+/// Combinations which a family does not support are not registered.
+
+#include "perf_counters.h"
+
+#include <cnl/all.h>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <string>
+#include <tuple>
+
+namespace {
+    ////////////////////////////////////////////////////////////////////////////////
+    // type families, indexed by width
+
+    template<int Width>
+    using native = cnl::set_digits_t<int, Width - 1>;
+
+    template<int Width>
+    using wide = cnl::wide_integer<Width - 1>;
+
+    template<int Width>
+    using duplex = cnl::_impl::duplex_integer<
+            cnl::set_digits_t<int, Width / 2 - 1>, cnl::set_digits_t<unsigned, Width / 2>>;
+
+    template<int Width>
+    using overflow_native = cnl::overflow_integer<native<Width>, cnl::native_overflow_tag>;
+
+    template<int Width>
+    using overflow_saturated = cnl::overflow_integer<native<Width>, cnl::saturated_overflow_tag>;
+
+    template<int Width>
+    using overflow_throwing = cnl::overflow_integer<native<Width>, cnl::throwing_overflow_tag>;
+
+    template<int Width>
+    using overflow_trapping = cnl::overflow_integer<native<Width>, cnl::trapping_overflow_tag>;
+
+    template<int Width>
+    using overflow_undefined = cnl::overflow_integer<native<Width>, cnl::undefined_overflow_tag>;
+
+    template<int Width>
+    using rounding_native = cnl::rounding_integer<native<Width>, cnl::native_rounding_tag>;
+
+    template<int Width>
+    using rounding_nearest = cnl::rounding_integer<native<Width>, cnl::nearest_rounding_tag>;
+
+    template<int Width>
+    using rounding_tie_to_even = cnl::rounding_integer<native<Width>, cnl::tie_to_even_rounding_tag>;
+
+    template<int Width>
+    using elastic = cnl::elastic_integer<Width - 1>;
+
+    template<int Width>
+    using scaled = cnl::scaled_integer<native<Width>, cnl::power<-Width / 2>>;
+
+    template<int Width>
+    using static_number = cnl::static_number<Width - 1, -Width / 2>;
+
+    template<int Width>
+    using fraction = cnl::fraction<native<Width>>;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // operations
+
+    struct add_operation {
+        static constexpr auto name = "add";
+
+        template<typename T>
+        auto operator()(T const& lhs, T const& rhs) const
+        {
+            return lhs + rhs;
+        }
+    };
+
+    struct sub_operation {
+        static constexpr auto name = "sub";
+
+        template<typename T>
+        auto operator()(T const& lhs, T const& rhs) const
+        {
+            return lhs - rhs;
+        }
+    };
+
+    struct mul_operation {
+        static constexpr auto name = "mul";
+
+        template<typename T>
+        auto operator()(T const& lhs, T const& rhs) const
+        {
+            return lhs * rhs;
+        }
+    };
+
+    struct div_operation {
+        static constexpr auto name = "div";
+
+        template<typename T>
+        auto operator()(T const& lhs, T const& rhs) const
+        {
+            return lhs / rhs;
+        }
+    };
+
+    struct mod_operation {
+        static constexpr auto name = "mod";
+
+        template<typename T>
+        auto operator()(T const& lhs, T const& rhs) const -> decltype(lhs % rhs)
+        {
+            return lhs % rhs;
+        }
+    };
+
+    struct shift_operation {
+        static constexpr auto name = "shift";
+
+        int shift = 1;
+
+        template<typename T>
+        auto operator()(T const& lhs, T const&) const -> decltype(lhs >> shift)
+        {
+            return lhs >> shift;
+        }
+    };
+
+    struct compare_operation {
+        static constexpr auto name = "compare";
+
+        template<typename T>
+        auto operator()(T const& lhs, T const& rhs) const
+        {
+            return lhs < rhs;
+        }
+    };
+
+    struct convert_operation {
+        static constexpr auto name = "convert";
+
+        template<typename T>
+        auto operator()(T const& lhs, T const&) const -> decltype(static_cast<double>(lhs))
+        {
+            return static_cast<double>(lhs);
+        }
+    };
+
+    struct to_chars_operation {
+        static constexpr auto name = "to_chars";
+
+        std::array<char, 128> chars{};
+
+        template<typename T>
+        auto operator()(T const& lhs, T const&) -> decltype(cnl::to_chars(chars.data(), chars.data(), lhs).ptr)
+        {
+            return cnl::to_chars(chars.data(), chars.data() + chars.size(), lhs).ptr;
+        }
+    };
+
+    struct sqrt_operation {
+        static constexpr auto name = "sqrt";
+
+        template<typename T>
+        auto operator()(T const& lhs, T const&) const -> decltype(cnl::sqrt(lhs))
+        {
+            return cnl::sqrt(lhs);
+        }
+    };
+
+    using operations = std::tuple<
+            add_operation, sub_operation, mul_operation, div_operation, mod_operation,
+            shift_operation, compare_operation, convert_operation, to_chars_operation,
+            sqrt_operation>;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // benchmarking function
+
+    template<typename Operation, typename T>
+    void bm_matrix(benchmark::State& state)
+    {
+        auto operation = Operation{};
+        // 64-bit operands, to initialize the widest of the scaled types without overflow
+        auto lhs = static_cast<T>(cnl::int64{5});
+        auto rhs = static_cast<T>(cnl::int64{3});
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(lhs);
+            benchmark::DoNotOptimize(rhs);
+            auto value = operation(lhs, rhs);
+            benchmark::DoNotOptimize(value);
+        }
+        counters.report(state);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // registration
+
+    template<typename Operation, typename T>
+    concept supports = requires(Operation& operation, T const& operand)
+    {
+        operation(operand, operand);
+    };
+
+    template<typename Operation, typename T>
+    void register_operation(std::string const&)
+    {
+    }
+
+    template<typename Operation, typename T>
+    requires supports<Operation, T> void register_operation(std::string const& prefix)
+    {
+        benchmark::RegisterBenchmark((prefix + Operation::name).c_str(), bm_matrix<Operation, T>);
+    }
+
+    template<typename T, typename... Operations>
+    void register_operations(std::string const& prefix, std::tuple<Operations...> const*)
+    {
+        (register_operation<Operations, T>(prefix), ...);
+    }
+
+    template<template<int> class Family, int... Widths>
+    void register_family(std::string const& name)
+    {
+        (register_operations<Family<Widths>>(
+                 "matrix/" + name + "/" + std::to_string(Widths) + "/",
+                 static_cast<operations const*>(nullptr)),
+         ...);
+    }
+
+    auto register_matrix()
+    {
+        register_family<native, 8, 16, 32, 64>("native");
+#if defined(CNL_INT128_ENABLED)
+        register_family<native, 128>("native");
+#endif
+        register_family<wide, 32, 64, 128, 256>("wide_integer");
+        register_family<duplex, 64, 128>("duplex_integer");
+        register_family<overflow_native, 8, 16, 32, 64>("overflow_integer<native>");
+        register_family<overflow_saturated, 8, 16, 32, 64>("overflow_integer<saturated>");
+        register_family<overflow_throwing, 8, 16, 32, 64>("overflow_integer<throwing>");
+        register_family<overflow_trapping, 8, 16, 32, 64>("overflow_integer<trapping>");
+        register_family<overflow_undefined, 8, 16, 32, 64>("overflow_integer<undefined>");
+        register_family<rounding_native, 8, 16, 32, 64>("rounding_integer<native>");
+        register_family<rounding_nearest, 8, 16, 32, 64>("rounding_integer<nearest>");
+        register_family<rounding_tie_to_even, 8, 16, 32, 64>("rounding_integer<tie_to_even>");
+        register_family<elastic, 8, 16, 32, 64>("elastic_integer");
+        register_family<scaled, 8, 16, 32, 64>("scaled_integer");
+        register_family<static_number, 8, 16, 32>("static_number");
+        register_family<fraction, 8, 16, 32, 64>("fraction");
+        return true;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+    [[maybe_unused]] auto const matrix_registered = register_matrix();
+}
@@ -0,0 +1,152 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief throughput benchmarks of cnl::pack and cnl::unpack
+///
+/// Benchmarks are named "packed/<operation>/<type>/<size>". For comparison, "packed/copy/<type>/<size>"
+/// copies an unpacked buffer of the native rep of the same type.
+
+#include "perf_counters.h"
+
+#include <cnl/elastic_integer.h>
+#include <cnl/packed.h>
+#include <cnl/static_integer.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr auto min_size = 1 << 10;
+    constexpr auto max_size = 1 << 22;
+    constexpr auto size_multiplier = 64;
+
+    template<typename T>
+    using rep = cnl::_impl::packed_rep_t<T>;
+
+    template<typename T>
+    auto make_packed(std::size_t size)
+    {
+        auto packed = cnl::packed_vector<T>(size);
+        auto index = 0;
+        std::generate(packed.begin(), packed.end(), [&index] {
+            return T{(index++ % 255) - 127};
+        });
+        return packed;
+    }
+
+    // bytes read from the packed buffer and written to the unpacked buffer
+    template<typename T>
+    void set_processed(benchmark::State& state, cnl::packed_vector<T> const& packed)
+    {
+        auto const iterations = state.iterations();
+        state.SetItemsProcessed(iterations * state.range(0));
+        state.SetBytesProcessed(
+                iterations * static_cast<std::int64_t>(
+                        packed.words().size_bytes() + packed.size() * sizeof(rep<T>)));
+    }
+
+    template<typename T>
+    void bm_unpack(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const packed = make_packed<T>(size);
+        auto out = std::vector<rep<T>>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(packed.words().data());
+            cnl::unpack(packed, out);
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0));
+        set_processed(state, packed);
+    }
+
+    template<typename T>
+    void bm_pack(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto packed = make_packed<T>(size);
+        auto in = std::vector<rep<T>>(size);
+        cnl::unpack(packed, in);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(in.data());
+            cnl::pack(in, packed);
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0));
+        set_processed(state, packed);
+    }
+
+    // element-by-element decode through iterators
+    template<typename T>
+    void bm_iterate(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const packed = make_packed<T>(size);
+        auto out = std::vector<T>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(packed.words().data());
+            std::copy(packed.begin(), packed.end(), begin(out));
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0));
+        set_processed(state, packed);
+    }
+
+    // the same copy as bm_unpack without packing, with the narrowest native integer that holds T
+    template<typename T, typename Native>
+    void bm_copy(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const in = std::vector<Native>(size);
+        auto out = std::vector<rep<T>>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(in.data());
+            std::copy(begin(in), end(in), begin(out));
+            benchmark::ClobberMemory();
+        }
+        counters.report(state, state.range(0));
+        auto const iterations = state.iterations();
+        state.SetItemsProcessed(iterations * state.range(0));
+        state.SetBytesProcessed(iterations * state.range(0)
+                                * static_cast<std::int64_t>(sizeof(Native) + sizeof(rep<T>)));
+    }
+
+    template<typename Function>
+    void register_packed(std::string const& name, Function* function)
+    {
+        benchmark::RegisterBenchmark(("packed/" + name).c_str(), function)
+                ->RangeMultiplier(size_multiplier)
+                ->Range(min_size, max_size);
+    }
+
+    template<typename T, typename Native>
+    void register_type(std::string const& name)
+    {
+        register_packed("unpack/" + name, bm_unpack<T>);
+        register_packed("pack/" + name, bm_pack<T>);
+        register_packed("iterate/" + name, bm_iterate<T>);
+        register_packed("copy/" + name, bm_copy<T, Native>);
+    }
+
+    auto register_all()
+    {
+        register_type<cnl::elastic_integer<12>, cnl::int16>("elastic_integer<12>");
+        register_type<cnl::static_integer<20>, cnl::int32>("static_integer<20>");
+        return true;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+    [[maybe_unused]] auto const packed_registered = register_all();
+}
@@ -0,0 +1,156 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief hardware performance counters, reported as custom counters of google/benchmark
+///
+/// On Linux, \ref perf_counters counts CPU cycles, instructions, branch misses and cache misses
+/// of the calling thread with perf_event_open. Events which the system cannot count, e.g. in a
+/// virtual machine or where /proc/sys/kernel/perf_event_paranoid forbids it, are not reported.
+/// Elsewhere, no events are reported.
+///
+/// Counts are reported per item, i.e. per iteration or per element of an array kernel, as
+/// "cycles", "instructions", "branch_misses" and "cache_misses".
+
+#if !defined(CNL_BENCHMARK_PERF_COUNTERS_H)
+#define CNL_BENCHMARK_PERF_COUNTERS_H
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <array>
+#endif
+
+// counts hardware events from construction until report
+class perf_counters {
+public:
+    perf_counters()
+    {
+#if defined(__linux__)
+        for (auto const& e : available_events()) {
+            auto const fd = open(e, _fds.empty() ? -1 : _fds.front());
+            if (fd == -1) {
+                close_all();
+                return;
+            }
+            _fds.push_back(fd);
+        }
+        if (!_fds.empty()) {
+            ioctl(_fds.front(), PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(_fds.front(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#endif
+    }
+
+    perf_counters(perf_counters const&) = delete;
+    perf_counters(perf_counters&&) = delete;
+    auto operator=(perf_counters const&) -> perf_counters& = delete;
+    auto operator=(perf_counters&&) -> perf_counters& = delete;
+
+    ~perf_counters()
+    {
+#if defined(__linux__)
+        close_all();
+#endif
+    }
+
+    // stops counting and adds the counts, divided by the number of items processed, to state
+    void report(benchmark::State& state, std::int64_t items_per_iteration = 1)
+    {
+#if defined(__linux__)
+        if (_fds.empty()) {
+            return;
+        }
+        ioctl(_fds.front(), PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+        // layout of PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING
+        auto buffer = std::array<std::uint64_t, 3 + events.size()>{};
+        auto const size = static_cast<long>((3 + _fds.size()) * sizeof(std::uint64_t));
+        auto const items = static_cast<double>(state.iterations() * items_per_iteration);
+        if (::read(_fds.front(), buffer.data(), buffer.size() * sizeof(std::uint64_t)) != size
+            || buffer[0] != _fds.size() || buffer[2] == 0 || items == 0) {
+            return;
+        }
+
+        // where there are more events than hardware counters, the kernel takes turns to count them
+        auto const scale = static_cast<double>(buffer[1]) / static_cast<double>(buffer[2]);
+        auto const& names = available_events();
+        for (auto index = std::size_t{0}; index != _fds.size(); ++index) {
+            state.counters[names[index].name] = static_cast<double>(buffer[3 + index]) * scale / items;
+        }
+#else
+        static_cast<void>(state);
+        static_cast<void>(items_per_iteration);
+#endif
+    }
+
+private:
+#if defined(__linux__)
+    struct event {
+        char const* name;
+        std::uint32_t type;
+        std::uint64_t config;
+    };
+
+    static constexpr auto events = std::array{
+            event{"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            event{"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            event{"branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+            event{"cache_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES}};
+
+    // returns a file descriptor which counts e in the calling thread, or -1
+    static auto open(event const& e, int group) -> int
+    {
+        auto attributes = perf_event_attr{};
+        attributes.size = sizeof(attributes);
+        attributes.type = e.type;
+        attributes.config = e.config;
+        attributes.disabled = (group == -1) ? 1 : 0;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        attributes.read_format =
+                PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, group, 0));
+    }
+
+    // the events which this system can count, determined once so that every benchmark
+    // reports the same counters, as is required by the CSV output of google/benchmark
+    static auto available_events() -> std::vector<event> const&
+    {
+        static auto const available = [] {
+            auto result = std::vector<event>{};
+            for (auto const& e : events) {
+                auto const fd = open(e, -1);
+                if (fd != -1) {
+                    ::close(fd);
+                    result.push_back(e);
+                }
+            }
+            return result;
+        }();
+        return available;
+    }
+
+    void close_all()
+    {
+        for (auto const fd : _fds) {
+            ::close(fd);
+        }
+        _fds.clear();
+    }
+
+    std::vector<int> _fds;
+#endif
+};
+
+#endif  // CNL_BENCHMARK_PERF_COUNTERS_H
@@ -0,0 +1,105 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief throughput benchmarks of cnl::reduce
+///
+/// Benchmarks are named "reduce/<type>/<size>". Types named "q15" use cnl::execution::seq and
+/// types named "q15_par" use cnl::execution::par. For comparison, types named "int64" widen every
+/// 16-bit rep to 64 bits in a hand-written loop and types named "float" sum floats in order.
+
+#include "perf_counters.h"
+
+#include <cnl/reduce.h>
+#include <cnl/scaled_integer.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace {
+    using q15 = cnl::scaled_integer<cnl::int16, cnl::power<-15>>;
+
+    template<typename T>
+    auto make_buffer(std::size_t size)
+    {
+        auto buffer = std::vector<T>(size);
+        for (auto index = std::size_t{0}; index != size; ++index) {
+            buffer[index] = static_cast<T>(static_cast<float>(index * 7919 % 65535) / 32768.F - .99F);
+        }
+        return buffer;
+    }
+
+    template<typename Policy>
+    void bm_reduce(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const values = make_buffer<q15>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(values.data());
+            benchmark::DoNotOptimize(cnl::reduce(Policy{}, values));
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void bm_reduce_int64(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const values = make_buffer<q15>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(values.data());
+            auto sum = cnl::int64{0};
+            for (auto const value : values) {
+                sum += cnl::unwrap(value);
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    void bm_reduce_float(benchmark::State& state)
+    {
+        auto const size = static_cast<std::size_t>(state.range(0));
+        auto const values = make_buffer<float>(size);
+        auto counters = perf_counters{};
+        while (state.KeepRunning()) {
+            benchmark::DoNotOptimize(values.data());
+            auto sum = 0.F;
+            for (auto const value : values) {
+                sum += value;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        counters.report(state, state.range(0));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template<typename Function>
+    void register_reduce(std::string const& name, Function* function)
+    {
+        benchmark::RegisterBenchmark(("reduce/" + name).c_str(), function)
+                ->RangeMultiplier(64)
+                ->Range(1 << 12, 1 << 24)
+                ->UseRealTime();
+    }
+
+    auto register_all()
+    {
+        register_reduce("q15", bm_reduce<cnl::execution::sequenced_policy>);
+        register_reduce("q15_par", bm_reduce<cnl::execution::parallel_policy>);
+        register_reduce("int64", bm_reduce_int64);
+        register_reduce("float", bm_reduce_float);
+        return true;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,cert-err58-cpp)
+    [[maybe_unused]] auto const reduce_registered = register_all();
+}
@@ -6,19 +6,43 @@ import sys
 
 help_text = "please provide CSV-formatted google/benchmark output"
 
-def sum_from_rows(rows):
-    return ["total"] + [str(sum(float(cell) for cell in column)) for
-    column in itertools.islice(zip(*rows), 1, None)]
+# columns which are copied from the benchmark output and summed in the total row
+summed_columns = ("name", "iterations", "real_time", "cpu_time")
+
+# hardware counters, per element, which are reported where test/benchmark/perf_counters.h provides them
+miss_columns = ("branch_misses", "cache_misses")
+
+def sum_column(column):
+    cells = [cell for cell in column if cell != ""]
+    return str(sum(float(cell) for cell in cells)) if len(cells) == len(column) else ""
+
+def sum_from_rows(rows, num_summed):
+    return ["total"] + [sum_column(column) for
+    column in itertools.islice(zip(*rows), 1, num_summed)] + [""] * (len(rows[0]) - num_summed)
 
 def report_from_table(table):
-    return table + [sum_from_rows(table[1:])]
+    num_summed = len([title for title in table[0] if title in summed_columns])
+    return table + [sum_from_rows(table[1:], num_summed)]
+
+def ipc(cycles, instructions):
+    return str(float(instructions) / float(cycles)) if cycles and instructions and float(cycles) else ""
 
 def table_from_benchmarks(table):
+    titles = table[0]
+    counters = [title for title in miss_columns if title in titles]
+    has_ipc = "cycles" in titles and "instructions" in titles
+
+    def cell(row, title):
+        index = titles.index(title)
+        return row[index] if index < len(row) else ""
+
     def filter_row(row):
-        return [str(cell[0]) for cell in zip(row, table[0]) if cell[1]
-        in ("name","iterations","real_time","cpu_time")]
+        return ([str(cell[0]) for cell in zip(row, titles) if cell[1] in summed_columns]
+            + ([ipc(cell(row, "cycles"), cell(row, "instructions"))] if has_ipc else [])
+            + [cell(row, title) for title in counters])
 
-    return [filter_row(row) for row in table]
+    title_row = [title for title in titles if title in summed_columns] + (["IPC"] if has_ipc else []) + counters
+    return [title_row] + [filter_row(row) for row in table[1:]]
 
 def report_from_benchmarks(table):
     return report_from_table(table_from_benchmarks(table))
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+
+"""Measures the time and memory taken to compile instantiate.cpp.
+
+Compiles instantiate.cpp with -fsyntax-only, so that only the front end is measured, for each
+type family and number of instantiations. Results are written in the JSON format of
+google/benchmark, named "compile/<family>/<count>", with the peak memory use of the compiler in
+the additional field, "max_rss" (kB). Use test/benchmark/compare.py to track them over time, e.g.
+
+    compile_time.py --compiler g++ --output baseline.json
+    compile_time.py --compiler g++ --output current.json
+    compare.py check baseline.json --current current.json
+    compare.py check baseline.json --current current.json --metric max_rss
+"""
+
+from argparse import ArgumentParser
+from json import dump
+from os import path, wait4
+from shlex import split
+from subprocess import DEVNULL, PIPE, Popen
+from sys import stderr, stdout
+from time import perf_counter
+
+families = ["static_number", "wide_integer", "elastic_scaled_integer", "safe_scaled_integer"]
+
+
+def compile_once(args, family, count):
+    """Compiles instantiate.cpp once and returns a google/benchmark-style result."""
+    source = path.join(path.dirname(path.abspath(__file__)), "instantiate.cpp")
+    command = [args.compiler] + split(args.flags) + [
+        "-I{}".format(args.include),
+        "-DCNL_COMPILE_TIME_FAMILY={}".format(family),
+        "-DCNL_COMPILE_TIME_COUNT={}".format(count),
+        "-fsyntax-only",
+        source
+    ]
+    if args.report_dir:
+        command.append("-ftime-report")
+
+    start = perf_counter()
+    process = Popen(command, stdout=DEVNULL, stderr=PIPE)
+    diagnostics = process.stderr.read()
+    _, status, usage = wait4(process.pid, 0)
+    real_time = perf_counter() - start
+    if status != 0:
+        stderr.write(diagnostics.decode("utf-8", "replace"))
+        raise RuntimeError("failed to compile {} with {} instantiations".format(family, count))
+
+    if args.report_dir:
+        report = path.join(args.report_dir, "{}-{}.txt".format(family, count))
+        with open(report, "wb") as file:
+            file.write(diagnostics)
+
+    name = "compile/{}/{}".format(family, count)
+    return {
+        "name": name,
+        "run_name": name,
+        "run_type": "iteration",
+        "iterations": 1,
+        "real_time": real_time * 1e9,
+        "cpu_time": (usage.ru_utime + usage.ru_stime) * 1e9,
+        "time_unit": "ns",
+        # kilobytes on Linux
+        "max_rss": usage.ru_maxrss
+    }
+
+
+if __name__ == "__main__":
+    parser = ArgumentParser(description="Measure the time and memory taken to instantiate CNL types.")
+    parser.add_argument("--compiler", help="C++ compiler", default="c++")
+    parser.add_argument("--flags", help="compiler flags, e.g. --flags=\"-std=c++20 -O2\"", default="-std=c++20")
+    parser.add_argument("--include", help="CNL include directory",
+                        default=path.join(path.dirname(path.abspath(__file__)), "..", "..", "include"))
+    parser.add_argument("--families", help="type families to instantiate", nargs="+", choices=families, default=families)
+    parser.add_argument("--counts", help="numbers of types to instantiate", nargs="+", type=int, default=[1, 16, 64])
+    parser.add_argument("--repetitions", help="number of times to compile each translation unit", type=int, default=3)
+    parser.add_argument("--report-dir", help="directory in which to store the output of -ftime-report")
+    parser.add_argument("--output", help="path to the JSON file of results; by default, print them")
+    args = parser.parse_args()
+
+    benchmarks = []
+    for family in args.families:
+        for count in args.counts:
+            for _ in range(args.repetitions):
+                result = compile_once(args, family, count)
+                print("{:<48} {:>8.2f} s {:>10} kB".format(
+                    result["name"], result["cpu_time"] * 1e-9, result["max_rss"]), file=stderr)
+                benchmarks.append(result)
+
+    results = {"context": {"compiler": args.compiler, "flags": args.flags}, "benchmarks": benchmarks}
+    if args.output:
+        with open(args.output, "w") as file:
+            dump(results, file, indent=2)
+    else:
+        dump(results, stdout, indent=2)
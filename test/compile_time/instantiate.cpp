@@ -0,0 +1,72 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief translation unit which instantiates many distinct CNL types, for measuring compile time
+///
+/// Not built as part of a test executable. compile_time.py compiles it with the following
+/// macros defined:
+/// - CNL_COMPILE_TIME_FAMILY: one of the families below, e.g. `static_number`;
+/// - CNL_COMPILE_TIME_COUNT: the number of distinct types of that family to instantiate.
+///
+/// Each type is exercised with the same set of operations.
+
+#include <cnl/all.h>
+
+#include <array>
+#include <utility>
+
+#if !defined(CNL_COMPILE_TIME_FAMILY) || !defined(CNL_COMPILE_TIME_COUNT)
+#error CNL_COMPILE_TIME_FAMILY and CNL_COMPILE_TIME_COUNT must be defined
+#endif
+
+namespace {
+    ////////////////////////////////////////////////////////////////////////////////
+    // type families, indexed so that each index gives a distinct type
+
+    template<int Index>
+    using static_number = cnl::static_number<8 + Index % 24, -1 - Index / 24>;
+
+    template<int Index>
+    using wide_integer = cnl::wide_integer<64 + Index>;
+
+    template<int Index>
+    using elastic_scaled_integer = cnl::elastic_scaled_integer<8 + Index % 24, -1 - Index / 24>;
+
+    template<int Index>
+    using safe_scaled_integer = cnl::scaled_integer<
+            cnl::rounding_integer<
+                    cnl::overflow_integer<cnl::int64, cnl::saturated_overflow_tag>,
+                    cnl::nearest_rounding_tag>,
+            cnl::power<-1 - Index>>;
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // operations
+
+    template<typename T>
+    auto exercise(T const& lhs, T const& rhs)
+    {
+        auto const sum = lhs + rhs;
+        auto const difference = lhs - rhs;
+        auto const product = lhs * rhs;
+        auto const quotient = lhs / rhs;
+        return static_cast<double>(sum) + static_cast<double>(difference)
+             + static_cast<double>(product) + static_cast<double>(quotient)
+             + static_cast<double>(lhs < rhs) + static_cast<double>(static_cast<T>(sum));
+    }
+
+    template<typename T>
+    using exercise_function = double (*)(T const&, T const&);
+
+    // takes the address of each instantiation so that none are skipped
+    template<int... Indices>
+    auto instantiate(std::integer_sequence<int, Indices...>)
+    {
+        return std::tuple{exercise_function<CNL_COMPILE_TIME_FAMILY<Indices>>{
+                &exercise<CNL_COMPILE_TIME_FAMILY<Indices>>}...};
+    }
+}
+
+auto const instantiations = instantiate(std::make_integer_sequence<int, CNL_COMPILE_TIME_COUNT>{});
@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+
+"""Compares the time taken to compile the unit tests by including CNL headers and by importing CNL.
+
+Compiles the module interface unit, include/cnl/cnl.cppm, once. Then each source file is compiled
+twice with -fsyntax-only: as it is, and with its CNL headers replaced by `import cnl;`. Only
+source files which include CNL through <cnl/...> headers can be rewritten in this way; others
+are skipped. Source files which fail to compile when rewritten are reported and left out of the
+totals, e.g. where a compiler does not yet support some part of C++20 modules.
+
+Results are written in the JSON format of google/benchmark, named
+"module/<include|import>/<source>", and "module/interface" for the module interface unit.
+"""
+
+from argparse import ArgumentParser
+from json import dump
+from os import path, wait4
+from re import compile as compile_regex
+from shlex import split
+from subprocess import DEVNULL, PIPE, Popen
+from sys import stderr, stdout
+from tempfile import TemporaryDirectory
+
+cnl_include = compile_regex(r'^\s*#\s*include\s*<cnl/[^>]*>')
+local_include = compile_regex(r'^\s*#\s*include\s*"')
+
+
+def run(command, cwd):
+    """Runs a compiler command and returns the CPU time taken, or None if compilation failed."""
+    process = Popen(command, cwd=cwd, stdout=DEVNULL, stderr=PIPE)
+    diagnostics = process.stderr.read()
+    _, status, usage = wait4(process.pid, 0)
+    if status != 0:
+        return None, diagnostics.decode("utf-8", "replace")
+    return usage.ru_utime + usage.ru_stime, None
+
+
+def rewrite(source):
+    """Returns the content of source with its CNL headers replaced by an import declaration.
+
+    The import declaration follows every other #include, as some compilers reject textual
+    inclusion of standard headers after an import declaration. Returns None if the source
+    contains local includes, which may include CNL headers in turn."""
+    with open(source) as file:
+        lines = file.read().splitlines()
+    if any(local_include.match(line) for line in lines):
+        return None
+
+    cnl_lines = [index for index, line in enumerate(lines) if cnl_include.match(line)]
+    if not cnl_lines:
+        return None
+
+    last_include = max(index for index, line in enumerate(lines) if line.lstrip().startswith("#include"))
+    rewritten = ["" if index in cnl_lines else line for index, line in enumerate(lines)]
+    rewritten.insert(last_include + 1, "import cnl;")
+    return "\n".join(rewritten) + "\n"
+
+
+def result(name, cpu_time):
+    return {
+        "name": name,
+        "run_name": name,
+        "run_type": "iteration",
+        "iterations": 1,
+        "real_time": cpu_time * 1e9,
+        "cpu_time": cpu_time * 1e9,
+        "time_unit": "ns"
+    }
+
+
+if __name__ == "__main__":
+    root = path.join(path.dirname(path.abspath(__file__)), "..", "..")
+    parser = ArgumentParser(description="Compare compile times of the unit tests with and without the cnl module.")
+    parser.add_argument("--compiler", help="C++ compiler", default="c++")
+    parser.add_argument("--flags", help="compiler flags, e.g. --flags=\"-std=c++20\"", default="-std=c++20")
+    parser.add_argument("--module-flags", help="flags which enable modules", default="-fmodules-ts")
+    parser.add_argument("--include", help="CNL include directory", default=path.join(root, "include"))
+    parser.add_argument("--test-include", help="additional include directory, e.g. of GoogleTest", action="append", default=[])
+    parser.add_argument("--output", help="path to the JSON file of results; by default, print them")
+    parser.add_argument("sources", help="source files to compile", nargs="+")
+    args = parser.parse_args()
+
+    flags = [args.compiler] + split(args.flags) + split(args.module_flags) + [
+        "-I{}".format(directory) for directory in [args.include] + args.test_include]
+
+    with TemporaryDirectory() as work_dir:
+        interface = path.join(args.include, "cnl", "cnl.cppm")
+        interface_time, diagnostics = run(
+            flags + ["-x", "c++", "-c", interface, "-o", path.join(work_dir, "cnl.o")], work_dir)
+        if interface_time is None:
+            stderr.write(diagnostics)
+            raise RuntimeError("failed to compile {}".format(interface))
+
+        benchmarks = [result("module/interface", interface_time)]
+        totals = {"include": 0., "import": 0.}
+        failures = []
+        for source in args.sources:
+            content = rewrite(source)
+            if content is None:
+                continue
+            name = path.relpath(path.abspath(source), path.join(root, "test"))
+            imported = path.join(work_dir, path.basename(source))
+            with open(imported, "w") as file:
+                file.write(content)
+
+            include_time, _ = run(flags + ["-fsyntax-only", path.abspath(source)], work_dir)
+            if include_time is None:
+                print("skipping {}, which fails to compile".format(name), file=stderr)
+                continue
+            import_time, _ = run(flags + ["-fsyntax-only", imported], work_dir)
+            if import_time is None:
+                failures.append(name)
+                continue
+
+            totals["include"] += include_time
+            totals["import"] += import_time
+            benchmarks += [result("module/include/{}".format(name), include_time),
+                           result("module/import/{}".format(name), import_time)]
+            print("{:<56} {:>6.2f} s {:>6.2f} s".format(name, include_time, import_time), file=stderr)
+
+    compiled = (len(benchmarks) - 1) // 2
+    print("module interface: {:.2f} s".format(interface_time), file=stderr)
+    print("{} sources: {:.2f} s including, {:.2f} s importing".format(
+        compiled, totals["include"], totals["import"]), file=stderr)
+    if failures:
+        print("{} sources failed to compile with import cnl: {}".format(
+            len(failures), " ".join(failures)), file=stderr)
+
+    results = {"context": {"compiler": args.compiler, "flags": args.flags}, "benchmarks": benchmarks}
+    if args.output:
+        with open(args.output, "w") as file:
+            dump(results, file, indent=2)
+    else:
+        dump(results, stdout, indent=2)
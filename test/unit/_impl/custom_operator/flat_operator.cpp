@@ -0,0 +1,60 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/_impl/custom_operator/flat_operator.h>
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/static_number.h>
+
+#include <type_traits>
+
+namespace {
+    using cnl::_impl::identical;
+
+    namespace test_flat_operator {
+        static_assert(std::is_same_v<
+                      cnl::_impl::add_op,
+                      cnl::_impl::flat_operator_t<cnl::_impl::add_op, int, int>>);
+        static_assert(std::is_same_v<
+                      cnl::_impl::add_op,
+                      cnl::_impl::flat_operator_t<cnl::_impl::add_op, cnl::rounding_integer<>, int>>);
+        static_assert(std::is_same_v<
+                      cnl::custom_operator<
+                              cnl::_impl::multiply_op,
+                              cnl::op_value<cnl::rounding_integer<>>,
+                              cnl::op_value<cnl::rounding_integer<>>>,
+                      cnl::_impl::flat_operator_t<
+                              cnl::_impl::multiply_op, cnl::rounding_integer<>, cnl::rounding_integer<>>>);
+    }
+
+    namespace test_is_transparent_operator {
+        static_assert(cnl::_impl::is_transparent_operator<
+                      cnl::custom_operator<
+                              cnl::_impl::add_op,
+                              cnl::op_value<int, cnl::nearest_rounding_tag>,
+                              cnl::op_value<int, cnl::nearest_rounding_tag>>,
+                      cnl::_impl::add_op>);
+        static_assert(!cnl::_impl::is_transparent_operator<
+                      cnl::custom_operator<
+                              cnl::_impl::divide_op,
+                              cnl::op_value<int, cnl::nearest_rounding_tag>,
+                              cnl::op_value<int, cnl::nearest_rounding_tag>>,
+                      cnl::_impl::divide_op>);
+        static_assert(!cnl::_impl::is_transparent_operator<
+                      cnl::custom_operator<
+                              cnl::_impl::add_op,
+                              cnl::op_value<int, cnl::saturated_overflow_tag>,
+                              cnl::op_value<int, cnl::saturated_overflow_tag>>,
+                      cnl::_impl::add_op>);
+    }
+
+    namespace test_static_number {
+        using number = cnl::static_number<15, -8>;
+
+        static_assert(identical(cnl::static_number<16, -8>{5.5}, number{2.25} + number{3.25}));
+        static_assert(identical(cnl::static_number<30, -16>{7.3125}, number{2.25} * number{3.25}));
+        static_assert(number{2.25} < number{3.25});
+        static_assert(!(number{3.25} < number{2.25}));
+    }
+}
@@ -0,0 +1,52 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cnl/_impl/config.h>
+#include <cnl/_impl/power_value.h>
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/scaled_integer.h>
+
+namespace {
+    using cnl::_impl::identical;
+
+    namespace test_size {
+        // promoted to int
+        static_assert(10 == cnl::_impl::power_table<cnl::uint8, 10>::values.size());
+        static_assert(10 == cnl::_impl::power_table<cnl::int32, 10>::values.size());
+        static_assert(19 == cnl::_impl::power_table<cnl::int64, 10>::values.size());
+        static_assert(20 == cnl::_impl::power_table<cnl::uint64, 10>::values.size());
+        static_assert(21 == cnl::_impl::power_table<cnl::uint32, 3>::values.size());
+#if defined(CNL_INT128_ENABLED)
+        static_assert(39 == cnl::_impl::power_table<cnl::uint128, 10>::values.size());
+#endif
+    }
+
+    namespace test_values {
+        static_assert(identical(1, cnl::_impl::power_table<cnl::int8, 10>::values[0]));
+        static_assert(identical(1000000000, cnl::_impl::power_table<cnl::int32, 10>::values.back()));
+        static_assert(identical(
+                cnl::int64{1000000000000000000}, cnl::_impl::power_table<cnl::int64, 10>::values.back()));
+        static_assert(identical(
+                cnl::uint64{10000000000000000000ULL}, cnl::_impl::power_table<cnl::uint64, 10>::values.back()));
+        static_assert(identical(3486784401U, cnl::_impl::power_table<cnl::uint32, 3>::values.back()));
+    }
+
+    namespace test_power_value {
+        static_assert(identical(100, cnl::_impl::power_value<short, 2, 10>()));
+        static_assert(identical(cnl::int64{100000}, cnl::_impl::power_value<cnl::int64, 5, 10>()));
+        static_assert(identical(cnl::uint32{243}, cnl::_impl::power_value<cnl::uint32, 5, 3>()));
+    }
+
+    namespace test_decimal_rescale {
+        using cents = cnl::scaled_integer<cnl::int64, cnl::power<-2, 10>>;
+        using mills = cnl::scaled_integer<cnl::int64, cnl::power<-3, 10>>;
+        using millions = cnl::scaled_integer<cnl::int64, cnl::power<6, 10>>;
+
+        static_assert(identical(mills{12.34}, mills{cents{12.34}}));
+        static_assert(identical(cents{12.34}, cents{mills{12.345}}));
+        static_assert(identical(cents{-12.34}, cents{mills{-12.345}}));
+        static_assert(identical(millions{42000000}, millions{cents{42123456.78}}));
+    }
+}
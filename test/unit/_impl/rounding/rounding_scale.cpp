@@ -0,0 +1,167 @@
+
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests for <cnl/_impl/rounding/rounding_scale.h>
+
+#include <cnl/_impl/rounding/rounding_scale.h>
+
+#include <cnl/_impl/duplex_integer.h>
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/cstdint.h>
+
+using cnl::_impl::identical;
+
+namespace {
+    namespace test_sign_mask {
+        static_assert(identical(-1, cnl::_impl::sign_mask(-5)));
+        static_assert(identical(0, cnl::_impl::sign_mask(5)));
+        static_assert(identical(0, cnl::_impl::sign_mask(0)));
+        static_assert(identical(-1, cnl::_impl::sign_mask(cnl::int8{-128})));
+        static_assert(identical(
+                cnl::_impl::duplex_integer<cnl::int32, cnl::uint32>{-1},
+                cnl::_impl::sign_mask(cnl::_impl::duplex_integer<cnl::int32, cnl::uint32>{-3})));
+        static_assert(identical(
+                cnl::_impl::duplex_integer<cnl::int32, cnl::uint32>{0},
+                cnl::_impl::sign_mask(cnl::_impl::duplex_integer<cnl::int32, cnl::uint32>{3})));
+    }
+
+    namespace test_nearest_binary {
+        template<int Shift, typename Rep>
+        constexpr auto nearest(Rep const& rep)
+        {
+            return cnl::_impl::rounding_scale_down<cnl::nearest_rounding_tag, Shift, 2>(rep);
+        }
+
+        static_assert(identical(0, nearest<2>(1)));
+        static_assert(identical(1, nearest<2>(2)));
+        static_assert(identical(1, nearest<2>(5)));
+        static_assert(identical(2, nearest<2>(6)));
+        static_assert(identical(0, nearest<2>(-1)));
+        static_assert(identical(-1, nearest<2>(-2)));
+        static_assert(identical(-1, nearest<2>(-5)));
+        static_assert(identical(-2, nearest<2>(-6)));
+
+        static_assert(identical(1U, nearest<2>(2U)));
+        static_assert(identical(2U, nearest<2>(6U)));
+        static_assert(identical(0x40000000U, nearest<2>(0xffffffffU)));
+
+        static_assert(identical(-64, nearest<1>(cnl::int8{-128})));
+        static_assert(identical(128, nearest<1>(cnl::uint8{255})));
+
+        static_assert(identical(cnl::int16{-0x7f80}, static_cast<cnl::int16>(nearest<8>(cnl::int32{-0x7f7f80}))));
+        static_assert(identical(cnl::int16{-0x7f7f}, static_cast<cnl::int16>(nearest<8>(cnl::int32{-0x7f7f7f}))));
+        static_assert(identical(cnl::int16{0x7f80}, static_cast<cnl::int16>(nearest<8>(cnl::int32{0x7f7f80}))));
+        static_assert(identical(cnl::int16{0x7f7f}, static_cast<cnl::int16>(nearest<8>(cnl::int32{0x7f7f7f}))));
+
+        using duplex = cnl::_impl::duplex_integer<cnl::int32, cnl::uint32>;
+        static_assert(identical(duplex{-2}, nearest<2>(duplex{-6})));
+        static_assert(identical(duplex{-1}, nearest<2>(duplex{-5})));
+        static_assert(identical(duplex{2}, nearest<2>(duplex{6})));
+        static_assert(identical(duplex{1}, nearest<2>(duplex{5})));
+        static_assert(identical(duplex{-0x40000000LL}, nearest<33>(duplex{-0x7fffffffffffffffLL})));
+
+        using unsigned_duplex = cnl::_impl::duplex_integer<cnl::uint32, cnl::uint32>;
+        static_assert(identical(unsigned_duplex{2}, nearest<33>(unsigned_duplex{0x300000000ULL})));
+        static_assert(identical(unsigned_duplex{1}, nearest<33>(unsigned_duplex{0x2ffffffffULL})));
+    }
+
+    namespace test_nearest_decimal {
+        template<int Shift, typename Rep>
+        constexpr auto nearest(Rep const& rep)
+        {
+            return cnl::_impl::rounding_scale_down<cnl::nearest_rounding_tag, Shift, 10>(rep);
+        }
+
+        static_assert(identical(0, nearest<1>(4)));
+        static_assert(identical(1, nearest<1>(5)));
+        static_assert(identical(0, nearest<1>(-4)));
+        static_assert(identical(-1, nearest<1>(-5)));
+        static_assert(identical(12LL, nearest<2>(1249LL)));
+        static_assert(identical(13LL, nearest<2>(1250LL)));
+        static_assert(identical(-12LL, nearest<2>(-1249LL)));
+        static_assert(identical(-13LL, nearest<2>(-1250LL)));
+        static_assert(identical(13ULL, nearest<2>(1250ULL)));
+
+        using duplex = cnl::_impl::duplex_integer<cnl::int32, cnl::uint32>;
+        static_assert(identical(duplex{-13}, nearest<2>(duplex{-1250})));
+        static_assert(identical(duplex{12}, nearest<2>(duplex{1249})));
+    }
+
+    namespace test_stochastic {
+        template<int Shift, int Radix, typename Rep>
+        constexpr auto stochastic(Rep const& rep, cnl::uint64 bits)
+        {
+            return cnl::_impl::rounding_scale_down<cnl::stochastic_rounding_tag, Shift, Radix>(rep, bits);
+        }
+
+        constexpr auto min_bits = cnl::uint64{0};
+        constexpr auto max_bits = ~min_bits;
+        constexpr auto half_bits = cnl::uint64{1} << 63;
+
+        static_assert(identical(1, stochastic<2, 2>(5, min_bits)));
+        static_assert(identical(2, stochastic<2, 2>(5, max_bits)));
+        static_assert(identical(-2, stochastic<2, 2>(-5, min_bits)));
+        static_assert(identical(-1, stochastic<2, 2>(-5, max_bits)));
+        static_assert(identical(-1, stochastic<2, 2>(-6, half_bits)));
+        static_assert(identical(1, stochastic<2, 2>(4, max_bits)));
+        static_assert(identical(1U, stochastic<2, 2>(6U, min_bits)));
+        static_assert(identical(2U, stochastic<2, 2>(6U, half_bits)));
+
+        // for non-binary radixes, the noise is the bits modulo the divisor
+        static_assert(identical(-13LL, stochastic<2, 10>(-1250LL, 0)));
+        static_assert(identical(-13LL, stochastic<2, 10>(-1250LL, 49)));
+        static_assert(identical(-12LL, stochastic<2, 10>(-1250LL, 50)));
+        static_assert(identical(-12LL, stochastic<2, 10>(-1200LL, 99)));
+        static_assert(identical(12ULL, stochastic<2, 10>(1250ULL, 49)));
+        static_assert(identical(13ULL, stochastic<2, 10>(1250ULL, 50)));
+
+        using duplex = cnl::_impl::duplex_integer<cnl::int32, cnl::uint32>;
+        static_assert(identical(duplex{-2}, stochastic<2, 2>(duplex{-5}, min_bits)));
+        static_assert(identical(duplex{-1}, stochastic<2, 2>(duplex{-5}, max_bits)));
+        static_assert(identical(duplex{-13}, stochastic<2, 10>(duplex{-1250}, 49)));
+        static_assert(identical(duplex{-12}, stochastic<2, 10>(duplex{-1250}, 50)));
+    }
+
+    namespace test_tie_to_even {
+        template<int Shift, int Radix, typename Rep>
+        constexpr auto tie_to_even(Rep const& rep)
+        {
+            return cnl::_impl::rounding_scale_down<cnl::tie_to_even_rounding_tag, Shift, Radix>(rep);
+        }
+
+        static_assert(identical(0, tie_to_even<1, 2>(1)));
+        static_assert(identical(2, tie_to_even<1, 2>(3)));
+        static_assert(identical(2, tie_to_even<1, 2>(5)));
+        static_assert(identical(0, tie_to_even<1, 2>(-1)));
+        static_assert(identical(-2, tie_to_even<1, 2>(-3)));
+        static_assert(identical(-2, tie_to_even<1, 2>(-5)));
+        static_assert(identical(1, tie_to_even<2, 2>(5)));
+        static_assert(identical(2, tie_to_even<2, 2>(7)));
+        static_assert(identical(-1, tie_to_even<2, 2>(-5)));
+        static_assert(identical(-2, tie_to_even<2, 2>(-7)));
+        static_assert(identical(0x80000000U, tie_to_even<1, 2>(0xffffffffU)));
+        static_assert(identical(0x7ffffffeU, tie_to_even<1, 2>(0xfffffffdU)));
+
+        static_assert(identical(12LL, tie_to_even<2, 10>(1250LL)));
+        static_assert(identical(14LL, tie_to_even<2, 10>(1350LL)));
+        static_assert(identical(13LL, tie_to_even<2, 10>(1251LL)));
+        static_assert(identical(-12LL, tie_to_even<2, 10>(-1250LL)));
+        static_assert(identical(-14LL, tie_to_even<2, 10>(-1350LL)));
+        static_assert(identical(-13LL, tie_to_even<2, 10>(-1251LL)));
+        static_assert(identical(-12LL, tie_to_even<2, 10>(-1249LL)));
+        static_assert(identical(12ULL, tie_to_even<2, 10>(1250ULL)));
+        static_assert(identical(14ULL, tie_to_even<2, 10>(1350ULL)));
+        static_assert(identical(0, tie_to_even<1, 3>(1)));
+        static_assert(identical(1, tie_to_even<1, 3>(2)));
+
+        using duplex = cnl::_impl::duplex_integer<cnl::int32, cnl::uint32>;
+        static_assert(identical(duplex{-2}, tie_to_even<1, 2>(duplex{-5})));
+        static_assert(identical(duplex{2}, tie_to_even<1, 2>(duplex{5})));
+        static_assert(identical(duplex{-12}, tie_to_even<2, 10>(duplex{-1250})));
+        static_assert(identical(duplex{14}, tie_to_even<2, 10>(duplex{1350})));
+    }
+}
@@ -8,3 +8,23 @@
 /// \brief test of `cnl/cmath.h`
 
 #include <cnl/cmath.h>
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+    using cnl::_impl::identical;
+
+    // integer overload is selected regardless of header order
+    static_assert(identical(7, cnl::sqrt(49)));
+    static_assert(identical(
+            cnl::scaled_integer<int, cnl::power<-2>>{1.5},
+            cnl::sqrt(cnl::scaled_integer<int, cnl::power<-4>>{2.25})));
+
+    TEST(cmath, sqrt_floating_point)  // NOLINT
+    {
+        ASSERT_EQ(1.5, cnl::sqrt(2.25));
+        ASSERT_EQ(1.5F, cnl::sqrt(2.25F));
+    }
+}
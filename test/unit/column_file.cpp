@@ -0,0 +1,159 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl::column_writer and cnl::column_reader
+
+#include <cnl/column_file.h>
+#include <cnl/elastic_integer.h>
+#include <cnl/overflow_integer.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/scaled_integer.h>
+#include <cnl/wide_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace {
+    using q16 = cnl::scaled_integer<cnl::int32, cnl::power<-16>>;
+    using safe_q4 = cnl::scaled_integer<
+            cnl::overflow_integer<
+                    cnl::rounding_integer<cnl::int16, cnl::nearest_rounding_tag>,
+                    cnl::saturated_overflow_tag>,
+            cnl::power<-4, 10>>;
+
+    namespace test_header_of {
+        static_assert(cnl::column_value<int>);
+        static_assert(cnl::column_value<q16>);
+        static_assert(cnl::column_value<cnl::elastic_integer<12>>);
+        static_assert(cnl::column_value<safe_q4>);
+        static_assert(!cnl::column_value<cnl::wide_integer<100>>);
+        static_assert(!cnl::column_value<double>);
+
+        static_assert(cnl::column_header_of<q16>.rep_bytes == 4);
+        static_assert(cnl::column_header_of<q16>.is_signed == 1);
+        static_assert(cnl::column_header_of<q16>.digits == 31);
+        static_assert(cnl::column_header_of<q16>.exponent == -16);
+        static_assert(cnl::column_header_of<q16>.radix == 2);
+        static_assert(cnl::column_header_of<q16>.rounding == 0);
+        static_assert(cnl::column_header_of<q16>.overflow == 0);
+
+        static_assert(cnl::column_header_of<safe_q4>.exponent == -4);
+        static_assert(cnl::column_header_of<safe_q4>.radix == 10);
+        static_assert(cnl::column_header_of<safe_q4>.rounding == 1);
+        static_assert(cnl::column_header_of<safe_q4>.overflow == 2);
+
+        static_assert(cnl::column_header_of<cnl::elastic_integer<12>>.rep_bytes == 4);
+        static_assert(cnl::column_header_of<cnl::elastic_integer<12>>.digits == 12);
+        static_assert(!cnl::column_header_of<q16>.same_type(cnl::column_header_of<cnl::int32>));
+
+        // the header round-trips
+        static_assert([] {
+            auto written = cnl::column_header_of<safe_q4>;
+            written.block_size = 100;
+            written.count = 12345678901;
+            written.blocks_offset = 64;
+            auto read = cnl::column_header{};
+            return cnl::_impl::read_column_header(cnl::_impl::write_column_header(written), read)
+                && read.same_type(written) && read.block_size == 100 && read.count == 12345678901
+                && read.blocks_offset == 64;
+        }());
+    }
+
+    class column_file : public ::testing::Test {
+    protected:
+        void TearDown() override
+        {
+            std::filesystem::remove(path);
+        }
+
+        std::string const path = (std::filesystem::temp_directory_path()
+                                  / (std::string{"cnl_column_file_"}
+                                     + ::testing::UnitTest::GetInstance()->current_test_info()->name()))
+                                         .string();
+    };
+
+    TEST_F(column_file, round_trip)  // NOLINT
+    {
+        auto samples = std::vector<q16>(10000);
+        for (auto i = 0; i != int(samples.size()); ++i) {
+            samples[i] = q16{(i % 1000) / 16. - 30.};
+        }
+
+        {
+            auto writer = cnl::column_writer<q16>{};
+            ASSERT_FALSE(writer.open(path.c_str(), 1024));
+            writer.append(samples);
+            EXPECT_EQ(samples.size(), writer.size());
+            ASSERT_FALSE(writer.close());
+        }
+
+        auto reader = cnl::column_reader<q16>{};
+        ASSERT_FALSE(reader.open(path.c_str()));
+        EXPECT_EQ(1024U, reader.header().block_size);
+        auto const values = reader.values();
+        ASSERT_EQ(samples.size(), values.size());
+        EXPECT_TRUE(std::equal(begin(samples), end(samples), begin(values)));
+
+        // 9 full blocks and one partial block
+        auto const blocks = reader.blocks();
+        ASSERT_EQ(10U, blocks.size());
+        EXPECT_EQ(q16{-30.}, blocks[0].min);
+        EXPECT_EQ(q16{999 / 16. - 30.}, blocks[0].max);
+        EXPECT_EQ(q16{(9216 % 1000) / 16. - 30.}, blocks[9].min);
+    }
+
+    TEST_F(column_file, empty)  // NOLINT
+    {
+        ASSERT_FALSE(cnl::column_writer<safe_q4>{}.open(path.c_str()));
+
+        auto reader = cnl::column_reader<safe_q4>{};
+        ASSERT_FALSE(reader.open(path.c_str()));
+        EXPECT_TRUE(reader.values().empty());
+        EXPECT_TRUE(reader.blocks().empty());
+    }
+
+    TEST_F(column_file, type_mismatch)  // NOLINT
+    {
+        {
+            auto writer = cnl::column_writer<q16>{};
+            ASSERT_FALSE(writer.open(path.c_str()));
+            writer.push_back(q16{1.5});
+        }
+
+        EXPECT_EQ(cnl::column_errc::type_mismatch, cnl::column_reader<cnl::int32>{}.open(path.c_str()));
+        using q15 = cnl::scaled_integer<cnl::int32, cnl::power<-15>>;
+        EXPECT_EQ(cnl::column_errc::type_mismatch, cnl::column_reader<q15>{}.open(path.c_str()));
+
+        auto reader = cnl::column_reader<q16>{};
+        ASSERT_FALSE(reader.open(path.c_str()));
+        EXPECT_EQ(q16{1.5}, reader.values()[0]);
+    }
+
+    TEST_F(column_file, errors)  // NOLINT
+    {
+        auto reader = cnl::column_reader<q16>{};
+        EXPECT_EQ(std::errc::no_such_file_or_directory, reader.open(path.c_str()));
+
+        {
+            auto writer = cnl::column_writer<q16>{};
+            ASSERT_FALSE(writer.open(path.c_str()));
+            writer.append(std::vector<q16>(100));
+        }
+        std::filesystem::resize_file(path, 64 + 99 * 4);
+        EXPECT_EQ(cnl::column_errc::truncated, reader.open(path.c_str()));
+        EXPECT_FALSE(reader.is_open());
+
+        std::filesystem::resize_file(path, 63);
+        EXPECT_EQ(cnl::column_errc::not_a_column_file, reader.open(path.c_str()));
+    }
+}
@@ -0,0 +1,182 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl::complex, cnl::complex_span and the kernels which operate on them
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/complex.h>
+#include <cnl/elastic_scaled_integer.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+using cnl::_impl::identical;
+
+namespace {
+    using q15 = cnl::scaled_integer<cnl::int16, cnl::power<-15>>;
+    using rounding_q15 = cnl::scaled_integer<cnl::rounding_integer<cnl::int16>, cnl::power<-15>>;
+    using q30 = cnl::scaled_integer<cnl::int64, cnl::power<-30>>;
+
+    namespace test_complex {
+        //! [complex example]
+        using e15 = cnl::elastic_scaled_integer<15, -15>;
+        constexpr auto a = cnl::complex{e15{.5}, e15{-.25}};
+        constexpr auto b = cnl::complex{e15{.75}, e15{.5}};
+
+        // the product of two 16-bit complex numbers has 32-bit parts
+        static_assert(identical(
+                cnl::complex{cnl::elastic_scaled_integer<31, -30>{.5}, cnl::elastic_scaled_integer<31, -30>{.0625}},
+                a * b));
+        //! [complex example]
+
+        static_assert(identical(cnl::complex{e15{.5}, e15{.25}}, cnl::conj(a)));
+        static_assert(identical(cnl::elastic_scaled_integer<31, -30>{.3125}, cnl::norm(a)));
+        static_assert(identical(cnl::complex{cnl::elastic_scaled_integer<16, -15>{1.25}, cnl::elastic_scaled_integer<16, -15>{.25}}, a + b));
+        static_assert(identical(cnl::complex{cnl::elastic_scaled_integer<16, -15>{-.25}, cnl::elastic_scaled_integer<16, -15>{-.75}}, a - b));
+        static_assert(identical(cnl::complex{-e15{.5}, -e15{-.25}}, -a));
+        static_assert(a == cnl::complex{e15{.5}, e15{-.25}});
+        static_assert(!(a == b));
+
+        static_assert(std::is_same_v<q15, cnl::complex<q15>::value_type>);
+    }
+
+    namespace test_complex_product {
+        using q7 = cnl::scaled_integer<cnl::int8, cnl::power<-7>>;
+
+        static_assert(std::is_same_v<q30, cnl::complex_product_t<q15, q15>>);
+        static_assert(std::is_same_v<
+                      cnl::scaled_integer<cnl::int32, cnl::power<-14>>, cnl::complex_product_t<q7, q7>>);
+        static_assert(std::is_same_v<q30, cnl::complex_norm_t<q15>>);
+    }
+
+    namespace test_complex_span {
+        TEST(complex_span, example)  // NOLINT
+        {
+            //! [complex_span example]
+            auto a_real = std::array<q15, 3>{.5, -1, .25};
+            auto a_imag = std::array<q15, 3>{.25, -1, 0};
+            auto b_real = std::array<q15, 3>{.5, -1, -.5};
+            auto b_imag = std::array<q15, 3>{-.5, -1, .125};
+            auto out_real = std::array<q30, 3>{};
+            auto out_imag = std::array<q30, 3>{};
+
+            cnl::complex_multiply(
+                    cnl::complex_span{a_real, a_imag}, cnl::complex_span{b_real, b_imag},
+                    cnl::complex_span{out_real, out_imag});
+
+            // (.5 + .25i) * (.5 - .5i)
+            EXPECT_EQ(q30{.375}, out_real[0]);
+            EXPECT_EQ(q30{-.125}, out_imag[0]);
+
+            // the product of the most negative values is held
+            EXPECT_EQ(q30{0}, out_real[1]);
+            EXPECT_EQ(q30{2.}, out_imag[1]);
+            //! [complex_span example]
+
+            auto const span = cnl::complex_span{a_real, a_imag};
+            EXPECT_EQ(3U, span.size());
+            EXPECT_TRUE(identical(cnl::complex{q15{.25}, q15{0}}, span[2]));
+        }
+
+        template<typename T>
+        auto make_parts(std::size_t size, int seed)
+        {
+            auto parts = std::vector<T>(size);
+            for (auto index = std::size_t{0}; index != size; ++index) {
+                parts[index] = cnl::wrap<T>(static_cast<cnl::int16>(
+                        (index % 5 == 0) ? -32768 : (index * 7919 + seed * 104729) % 65536 - 32768));
+            }
+            return parts;
+        }
+
+        // compares the kernels with the scalar operators of cnl::complex in 64 bits
+        TEST(complex_span, kernels)  // NOLINT
+        {
+            constexpr auto size = 1001;
+            auto const a_real = make_parts<q15>(size, 1);
+            auto const a_imag = make_parts<q15>(size, 2);
+            auto const b_real = make_parts<q15>(size, 3);
+            auto const b_imag = make_parts<q15>(size, 4);
+            auto const a = cnl::complex_span{a_real, a_imag};
+            auto const b = cnl::complex_span{b_real, b_imag};
+
+            auto product_real = std::vector<q30>(size);
+            auto product_imag = std::vector<q30>(size);
+            auto conj_real = std::vector<q30>(size);
+            auto conj_imag = std::vector<q30>(size);
+            auto norms = std::vector<q30>(size);
+            cnl::complex_multiply(a, b, cnl::complex_span{product_real, product_imag});
+            cnl::complex_multiply_conj(a, b, cnl::complex_span{conj_real, conj_imag});
+            cnl::complex_norm(a, norms);
+
+            for (auto index = std::size_t{0}; index != size; ++index) {
+                auto const wide_a = cnl::complex{q30{a_real[index]}, q30{a_imag[index]}};
+                auto const wide_b = cnl::complex{q30{b_real[index]}, q30{b_imag[index]}};
+
+                auto const product = wide_a * wide_b;
+                EXPECT_EQ(product.real, product_real[index]) << index;
+                EXPECT_EQ(product.imag, product_imag[index]) << index;
+
+                auto const conj_product = wide_a * cnl::conj(wide_b);
+                EXPECT_EQ(conj_product.real, conj_real[index]) << index;
+                EXPECT_EQ(conj_product.imag, conj_imag[index]) << index;
+
+                EXPECT_EQ(cnl::norm(wide_a), norms[index]) << index;
+            }
+        }
+
+        TEST(complex_span, requantization)  // NOLINT
+        {
+            auto a_real = std::vector<q15>{.5, .75};
+            auto a_imag = std::vector<q15>{.5, 0};
+            auto const b_real = std::vector<q15>{.5, .5};
+            auto const b_imag = std::vector<q15>{.5, 0};
+
+            // the products overwrite a
+            auto const a = cnl::complex_span{a_real, a_imag};
+            cnl::complex_multiply(a, cnl::complex_span{b_real, b_imag}, a);
+            EXPECT_EQ(q15{0}, a_real[0]);
+            EXPECT_EQ(q15{.5}, a_imag[0]);
+            EXPECT_EQ(q15{.375}, a_real[1]);
+
+            auto out_real = std::vector<rounding_q15>(2);
+            auto out_imag = std::vector<rounding_q15>(2);
+            cnl::complex_multiply_conj(
+                    cnl::complex_span{b_real, b_imag}, cnl::complex_span{b_real, b_imag},
+                    cnl::complex_span{out_real, out_imag});
+            EXPECT_EQ(rounding_q15{.5}, out_real[0]);
+            EXPECT_EQ(rounding_q15{0}, out_imag[0]);
+
+            // 3/32768 * .5 is rounded to 2/32768
+            auto const c_real = std::vector<q15>{cnl::wrap<q15>(3)};
+            auto const c_imag = std::vector<q15>{0};
+            auto const half = std::vector<q15>{.5};
+            auto const zero = std::vector<q15>{0};
+            cnl::complex_multiply(
+                    cnl::complex_span{c_real, c_imag}, cnl::complex_span{half, zero},
+                    cnl::complex_span{std::span(out_real).first(1), std::span(out_imag).first(1)});
+            EXPECT_EQ(cnl::wrap<rounding_q15>(2), out_real[0]);
+        }
+
+        TEST(complex_span, elastic)  // NOLINT
+        {
+            using e7 = cnl::elastic_scaled_integer<7, -7>;
+            auto const real = std::array<e7, 2>{-1, .5};
+            auto const imag = std::array<e7, 2>{-1, -.5};
+            auto norms = std::array<cnl::complex_norm_t<e7>, 2>{};
+            cnl::complex_norm(cnl::complex_span{real, imag}, norms);
+            EXPECT_EQ(2, norms[0]);
+            EXPECT_EQ(.5, norms[1]);
+        }
+    }
+}
@@ -0,0 +1,114 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl::compressed_vector and cnl::decompress
+
+#include <cnl/compressed.h>
+#include <cnl/elastic_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace {
+    using q16 = cnl::scaled_integer<cnl::int32, cnl::power<-16>>;
+    using elastic12 = cnl::elastic_integer<12>;
+
+    static_assert(cnl::compressed_vector<q16>::block_size == 128);
+    static_assert(!cnl::_impl::compressible<float>);
+
+    // a slowly-changing signal which drifts upward
+    auto make_signal(std::size_t size)
+    {
+        auto signal = std::vector<q16>(size);
+        for (auto index = std::size_t{0}; index != size; ++index) {
+            signal[index] = q16{double(index) / 4096. - 10.} + cnl::wrap<q16>(int(index * 7919 % 97));
+        }
+        return signal;
+    }
+
+    TEST(compressed_vector, empty)  // NOLINT
+    {
+        auto const compressed = cnl::compressed_vector<q16>{std::vector<q16>{}};
+        EXPECT_TRUE(compressed.empty());
+        EXPECT_EQ(0U, compressed.num_blocks());
+        EXPECT_EQ(0U, compressed.size_bytes());
+    }
+
+    TEST(compressed_vector, round_trip)  // NOLINT
+    {
+        auto const signal = make_signal(1000);
+        auto const compressed = cnl::compressed_vector<q16>{signal};
+        ASSERT_EQ(signal.size(), compressed.size());
+        ASSERT_EQ(8U, compressed.num_blocks());
+        EXPECT_EQ(1000U - 7 * 128, compressed.block_length(7));
+        EXPECT_LT(compressed.size_bytes(), signal.size() * sizeof(q16) / 2);
+
+        auto result = std::vector<q16>(signal.size());
+        cnl::decompress(compressed, result);
+        EXPECT_EQ(signal, result);
+
+        auto reps = std::vector<cnl::int32>(signal.size());
+        cnl::decompress(compressed, reps);
+        for (auto index = std::size_t{0}; index != signal.size(); ++index) {
+            ASSERT_EQ(cnl::unwrap(signal[index]), reps[index]);
+            ASSERT_EQ(signal[index], compressed[index]);
+        }
+    }
+
+    TEST(compressed_vector, block_access)  // NOLINT
+    {
+        auto const signal = make_signal(300);
+        auto const compressed = cnl::compressed_vector<q16>{signal};
+        auto block = std::vector<q16>(compressed.block_length(1));
+        compressed.decompress_block(1, block);
+        EXPECT_EQ(std::vector<q16>(signal.begin() + 128, signal.begin() + 256), block);
+
+        EXPECT_EQ(
+                *std::min_element(signal.begin() + 256, signal.end()), compressed.block_min(2));
+    }
+
+    TEST(compressed_vector, widths)  // NOLINT
+    {
+        // constant values need no bits
+        auto const constant = cnl::compressed_vector<elastic12>{std::vector<elastic12>(200, elastic12{-5})};
+        EXPECT_EQ(0, constant.block_width(0));
+        EXPECT_EQ(elastic12{-5}, constant[199]);
+
+        // the full range of a signed rep needs all of its bits
+        auto const extremes = std::vector<cnl::int32>{-2147483647 - 1, 2147483647, 0};
+        auto const full = cnl::compressed_vector<cnl::int32>{extremes};
+        EXPECT_EQ(32, full.block_width(0));
+        auto result = std::vector<cnl::int32>(extremes.size());
+        cnl::decompress(full, result);
+        EXPECT_EQ(extremes, result);
+    }
+
+    TEST(compressed_vector, wide_offsets)  // NOLINT
+    {
+        auto values = std::vector<cnl::int64>(128);
+        for (auto index = 0; index != 128; ++index) {
+            values[index] = (cnl::int64{index} << 40) - (cnl::int64{1} << 46) + index * 3;
+        }
+        values[5] = cnl::int64{-9223372036854775807} - 1;
+        values[6] = cnl::int64{9223372036854775807};
+
+        auto const compressed = cnl::compressed_vector<cnl::int64>{values};
+        EXPECT_EQ(64, compressed.block_width(0));
+        auto result = std::vector<cnl::int64>(values.size());
+        cnl::decompress(compressed, result);
+        EXPECT_EQ(values, result);
+        EXPECT_EQ(values[77], compressed[77]);
+
+        values[5] = values[6] = 0;
+        auto const narrower = cnl::compressed_vector<cnl::int64>{values};
+        EXPECT_EQ(47, narrower.block_width(0));
+        cnl::decompress(narrower, result);
+        EXPECT_EQ(values, result);
+    }
+}
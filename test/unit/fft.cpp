@@ -0,0 +1,203 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl::fft
+
+#include <cnl/fft.h>
+#include <cnl/num_traits.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <vector>
+
+namespace {
+    using q15 = cnl::scaled_integer<cnl::int16, cnl::power<-15>>;
+    using q31 = cnl::scaled_integer<cnl::int32, cnl::power<-31>>;
+
+    namespace test_twiddles {
+        using cnl::_impl::fft_twiddle;
+
+        static_assert(fft_twiddle<cnl::int16>(1, 4).real == 0);
+        static_assert(fft_twiddle<cnl::int16>(1, 4).imag == -32768);
+        static_assert(fft_twiddle<cnl::int16>(2, 4).real == -32768);
+        static_assert(fft_twiddle<cnl::int16>(2, 4).imag == 0);
+        static_assert(fft_twiddle<cnl::int16>(1, 8).real == 23170);
+        static_assert(fft_twiddle<cnl::int16>(1, 8).imag == -23170);
+        static_assert(fft_twiddle<cnl::int16>(5, 8).real == -23170);
+        static_assert(fft_twiddle<cnl::int16>(5, 8).imag == 23170);
+        static_assert(fft_twiddle<cnl::int32>(1, 12).real == 1859775393);
+        static_assert(fft_twiddle<cnl::int32>(1, 12).imag == -1073741824);
+
+        static_assert(cnl::fft_scaling<1>::stages == 0);
+        static_assert(cnl::fft_scaling<2>::stages == 1);
+        static_assert(cnl::fft_scaling<16>::stages == 2);
+        static_assert(cnl::fft_scaling<32>::stages == 3);
+        static_assert(cnl::_impl::fft_twiddle_table<cnl::int16, 32>::size == 16 + 12 + 3);
+    }
+
+    // the discrete Fourier transform in double precision
+    template<typename T, std::size_t Size>
+    auto dft(std::array<T, Size> const& real, std::array<T, Size> const& imag)
+    {
+        auto cos = std::vector<double>(Size);
+        auto sin = std::vector<double>(Size);
+        for (auto n = std::size_t{0}; n != Size; ++n) {
+            auto const angle = -2 * std::numbers::pi * static_cast<double>(n) / Size;
+            cos[n] = std::cos(angle);
+            sin[n] = std::sin(angle);
+        }
+
+        auto result = std::vector<std::array<double, 2>>(Size);
+        for (auto k = std::size_t{0}; k != Size; ++k) {
+            for (auto n = std::size_t{0}; n != Size; ++n) {
+                auto const index = k * n % Size;
+                result[k][0] += double(real[n]) * cos[index] - double(imag[n]) * sin[index];
+                result[k][1] += double(real[n]) * sin[index] + double(imag[n]) * cos[index];
+            }
+        }
+        return result;
+    }
+
+    // the output of cnl::fft is within the given number of its least significant bits of the DFT
+    template<typename T, std::size_t Size>
+    void expect_dft(std::array<T, Size> real, std::array<T, Size> imag, double tolerance)
+    {
+        auto const expected = dft(real, imag);
+        auto const scaling = cnl::fft(real, imag);
+
+        auto exponent = 0;
+        for (auto stage_exponent : scaling.stage_exponents) {
+            exponent += stage_exponent;
+        }
+        ASSERT_EQ(exponent, scaling.exponent);
+
+        auto const scale = std::ldexp(1., scaling.exponent);
+        auto const lsb = scale * double(cnl::wrap<T>(1));
+        for (auto k = std::size_t{0}; k != Size; ++k) {
+            EXPECT_NEAR(expected[k][0], double(real[k]) * scale, tolerance * lsb) << k;
+            EXPECT_NEAR(expected[k][1], double(imag[k]) * scale, tolerance * lsb) << k;
+        }
+    }
+
+    template<typename T, std::size_t Size>
+    auto make_signal(int seed)
+    {
+        auto signal = std::array<T, Size>{};
+        for (auto index = std::size_t{0}; index != Size; ++index) {
+            signal[index] = static_cast<T>(
+                    static_cast<double>((index * 7919 + seed * 104729) % 2001) / 1000. - 1.);
+        }
+        return signal;
+    }
+
+    namespace test_fft {
+        //! [fft example]
+        TEST(fft, example)  // NOLINT
+        {
+            // a complex exponential of frequency 2
+            auto real = std::array<q15, 8>{.5, 0, -.5, 0, .5, 0, -.5, 0};
+            auto imag = std::array<q15, 8>{0, .5, 0, -.5, 0, .5, 0, -.5};
+
+            auto const scaling = cnl::fft(real, imag);
+
+            // the result, 4 at frequency 2, must be multiplied by 2 to the power of exponent
+            EXPECT_EQ(4, scaling.exponent);
+            EXPECT_EQ(q15{.25}, real[2]);
+            EXPECT_EQ(q15{0}, imag[2]);
+        }
+        //! [fft example]
+
+        TEST(fft, impulse)  // NOLINT
+        {
+            auto real = std::array<q15, 64>{};
+            auto imag = std::array<q15, 64>{};
+            real[0] = cnl::wrap<q15>(1);
+
+            // the input is shifted left to use all of the digits and then down again
+            auto const scaling = cnl::fft(real, imag);
+            EXPECT_EQ((std::array<int, 3>{-11, 0, 0}), scaling.stage_exponents);
+            EXPECT_EQ(-11, scaling.exponent);
+            for (auto k = std::size_t{0}; k != real.size(); ++k) {
+                EXPECT_EQ(q15{.0625}, real[k]) << k;
+                EXPECT_EQ(q15{0}, imag[k]) << k;
+            }
+        }
+
+        TEST(fft, full_scale)  // NOLINT
+        {
+            auto real = std::array<q15, 64>{};
+            auto imag = std::array<q15, 64>{};
+            real.fill(q15{-1});
+
+            // each stage of radix 4 shifts by 3 bits, but the output of the first has 1 spare bit
+            auto const scaling = cnl::fft(real, imag);
+            EXPECT_EQ((std::array<int, 3>{3, 2, 2}), scaling.stage_exponents);
+            EXPECT_EQ(-64., double(real[0]) * std::ldexp(1., scaling.exponent));
+            for (auto k = std::size_t{1}; k != real.size(); ++k) {
+                EXPECT_EQ(q15{0}, real[k]) << k;
+            }
+        }
+
+        TEST(fft, zeros)  // NOLINT
+        {
+            auto real = std::array<q15, 16>{};
+            auto imag = std::array<q15, 16>{};
+            auto const scaling = cnl::fft(real, imag);
+            EXPECT_EQ(0, scaling.exponent);
+            EXPECT_EQ((std::array<q15, 16>{}), real);
+            EXPECT_EQ((std::array<q15, 16>{}), imag);
+        }
+
+        TEST(fft, size1)  // NOLINT
+        {
+            auto real = std::array<q15, 1>{.25};
+            auto imag = std::array<q15, 1>{-.5};
+            EXPECT_EQ(0, cnl::fft(real, imag).exponent);
+            EXPECT_EQ(q15{.25}, real[0]);
+            EXPECT_EQ(q15{-.5}, imag[0]);
+        }
+
+        TEST(fft, q15)  // NOLINT
+        {
+            expect_dft(make_signal<q15, 2>(1), make_signal<q15, 2>(2), 2);
+            expect_dft(make_signal<q15, 4>(1), make_signal<q15, 4>(2), 2);
+            expect_dft(make_signal<q15, 8>(1), make_signal<q15, 8>(2), 4);
+            expect_dft(make_signal<q15, 32>(1), make_signal<q15, 32>(2), 6);
+            expect_dft(make_signal<q15, 256>(1), make_signal<q15, 256>(2), 8);
+            expect_dft(make_signal<q15, 2048>(1), make_signal<q15, 2048>(2), 12);
+            expect_dft(make_signal<q15, 4096>(1), make_signal<q15, 4096>(2), 12);
+        }
+
+        TEST(fft, q31)  // NOLINT
+        {
+            expect_dft(make_signal<q31, 16>(3), make_signal<q31, 16>(4), 4);
+            expect_dft(make_signal<q31, 512>(3), make_signal<q31, 512>(4), 10);
+        }
+
+        TEST(fft, rounding_integer)  // NOLINT
+        {
+            using rounding_q15 = cnl::scaled_integer<cnl::rounding_integer<cnl::int16>, cnl::power<-15>>;
+            expect_dft(make_signal<rounding_q15, 128>(5), make_signal<rounding_q15, 128>(6), 8);
+        }
+
+        TEST(fft, int16)  // NOLINT
+        {
+            auto real = std::array<cnl::int16, 4>{100, 200, 300, 400};
+            auto imag = std::array<cnl::int16, 4>{};
+            auto const scaling = cnl::fft(real, imag);
+            EXPECT_EQ(1000, std::ldexp(real[0], scaling.exponent));
+            EXPECT_EQ(-200, std::ldexp(real[1], scaling.exponent));
+            EXPECT_EQ(200, std::ldexp(imag[1], scaling.exponent));
+            EXPECT_EQ(-200, std::ldexp(real[2], scaling.exponent));
+        }
+    }
+}
@@ -0,0 +1,133 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl::fir_filter and cnl::iir_filter
+
+#include <cnl/filter.h>
+#include <cnl/overflow_integer.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace {
+    using q15 = cnl::scaled_integer<cnl::int16, cnl::power<-15>>;
+    using q14 = cnl::scaled_integer<cnl::int16, cnl::power<-14>>;
+    using rounding_q15 = cnl::scaled_integer<cnl::rounding_integer<cnl::int16>, cnl::power<-15>>;
+    using saturated_q15 = cnl::scaled_integer<
+            cnl::overflow_integer<cnl::int16, cnl::saturated_overflow_tag>, cnl::power<-15>>;
+
+    static_assert(std::is_same_v<
+                  cnl::scaled_integer<cnl::int64, cnl::power<-30>>,
+                  cnl::fir_filter<q15, q15, 32>::accumulator_type>);
+    static_assert(std::is_same_v<
+                  cnl::scaled_integer<cnl::int32, cnl::power<-15>>,
+                  cnl::fir_filter<cnl::int8, q15, 4>::accumulator_type>);
+
+    auto make_signal(std::size_t size)
+    {
+        auto signal = std::vector<q15>(size);
+        for (auto index = std::size_t{0}; index != size; ++index) {
+            signal[index] = cnl::wrap<q15>(static_cast<cnl::int16>(index * 7919 % 65536 - 32768));
+        }
+        return signal;
+    }
+
+    namespace test_fir {
+        //! [fir example]
+        TEST(fir_filter, example)  // NOLINT
+        {
+            // a moving average of four samples, rounded to the nearest output value
+            auto filter = cnl::fir_filter<q15, q15, 4, rounding_q15>{{q15{.25}, q15{.25}, q15{.25}, q15{.25}}};
+
+            auto const in = std::array<q15, 5>{q15{.5}, q15{.5}, q15{.5}, q15{-.5}, cnl::wrap<q15>(3)};
+            auto out = std::array<rounding_q15, 5>{};
+            filter.process(in, out);
+
+            // the last output is .125 plus three quarters of the least significant bit
+            EXPECT_EQ((std::array<rounding_q15, 5>{.125, .25, .375, .25, cnl::wrap<rounding_q15>(4096 + 1)}), out);
+        }
+        //! [fir example]
+
+        TEST(fir_filter, blocks)  // NOLINT
+        {
+            constexpr auto taps = std::size_t{31};
+            auto coefficients = std::array<q15, taps>{};
+            for (auto tap = std::size_t{0}; tap != taps; ++tap) {
+                coefficients[tap] = cnl::wrap<q15>(static_cast<cnl::int16>(tap * 2003 % 65536 - 32768));
+            }
+
+            // more samples than a block, processed in pieces which straddle blocks
+            auto const in = make_signal(1000);
+            auto filter = cnl::fir_filter<q15, q15, taps, saturated_q15>{coefficients};
+            auto out = std::vector<saturated_q15>(in.size());
+            filter.process(std::span(in).first(300), std::span(out).first(300));
+            for (auto index = std::size_t{300}; index != 310; ++index) {
+                out[index] = filter(in[index]);
+            }
+            filter.process(std::span(in).subspan(310), std::span(out).subspan(310));
+
+            for (auto index = std::size_t{0}; index != in.size(); ++index) {
+                auto sum = cnl::int64{0};
+                for (auto tap = std::size_t{0}; tap != taps && tap <= index; ++tap) {
+                    sum += cnl::int64{cnl::unwrap(coefficients[tap])} * cnl::unwrap(in[index - tap]);
+                }
+                auto const expected = static_cast<saturated_q15>(
+                        cnl::wrap<cnl::scaled_integer<cnl::int64, cnl::power<-30>>>(sum));
+                ASSERT_EQ(expected, out[index]) << index;
+            }
+
+            filter.reset();
+            EXPECT_EQ(static_cast<saturated_q15>(coefficients[0] * in[0]), filter(in[0]));
+        }
+    }
+
+    namespace test_iir {
+        //! [iir example]
+        TEST(iir_filter, example)  // NOLINT
+        {
+            // a one-pole low-pass filter: y[n] = x[n] / 4 + 3 * y[n-1] / 4
+            auto filter = cnl::iir_filter<q14, q15>{{q14{.25}, q14{0.}, q14{0.}, q14{-.75}, q14{0.}}};
+
+            EXPECT_EQ(q15{.125}, filter(q15{.5}));
+            EXPECT_EQ(q15{.21875}, filter(q15{.5}));
+        }
+        //! [iir example]
+
+        TEST(iir_filter, step_response)  // NOLINT
+        {
+            // Butterworth low-pass with cut-off at a tenth of the sample rate
+            auto const b0 = 0.06745527;
+            auto const b1 = 0.13491055;
+            auto const b2 = 0.06745527;
+            auto const a1 = -1.1429805;
+            auto const a2 = 0.4128016;
+            auto filter = cnl::iir_filter<q14, q15, rounding_q15>{{q14{b0}, q14{b1}, q14{b2}, q14{a1}, q14{a2}}};
+
+            auto x = std::array<double, 2>{};
+            auto y = std::array<double, 2>{};
+            auto const step = q15{.5};
+            for (auto index = 0; index != 200; ++index) {
+                auto const actual = filter(step);
+
+                // the same quantized coefficients in floating point
+                auto const expected = double(q14{b0}) * double(step) + double(q14{b1}) * x[0]
+                                    + double(q14{b2}) * x[1] - double(q14{a1}) * y[0]
+                                    - double(q14{a2}) * y[1];
+                x = {double(step), x[0]};
+                y = {expected, y[0]};
+                ASSERT_NEAR(expected, double(actual), .001) << index;
+            }
+            EXPECT_NEAR(.5, double(filter(step)), .001);
+        }
+    }
+}
@@ -0,0 +1,75 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of composite types with CNL_USE_FORCE_INLINE enabled
+
+#define CNL_USE_FORCE_INLINE 1
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/all.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+    using cnl::_impl::identical;
+
+#if !defined(CNL_FORCE_INLINE_ENABLED)
+#error CNL_FORCE_INLINE_ENABLED not defined by CNL_USE_FORCE_INLINE
+#endif
+
+    using static_number = cnl::static_number<15, -8>;
+    using safe_scaled_integer = cnl::scaled_integer<
+            cnl::rounding_integer<
+                    cnl::overflow_integer<cnl::int32, cnl::saturated_overflow_tag>,
+                    cnl::nearest_rounding_tag>,
+            cnl::power<-8>>;
+
+    namespace test_static_number {
+        static_assert(identical(cnl::static_number<16, -8>{3.75}, static_number{1.25} + static_number{2.5}));
+        static_assert(identical(cnl::static_number<30, -16>{3.125}, static_number{1.25} * static_number{2.5}));
+        static_assert(static_number{1.25} < static_number{2.5});
+
+        // run-time operations must be compiled for the functions to be inlined
+        TEST(force_inline, static_number)  // NOLINT
+        {
+            auto lhs = static_number{1.25};
+            auto const rhs = static_number{2.5};
+            EXPECT_EQ(3.75, static_cast<double>(lhs + rhs));
+            EXPECT_EQ(-1.25, static_cast<double>(lhs - rhs));
+            EXPECT_EQ(3.125, static_cast<double>(lhs * rhs));
+            EXPECT_EQ(2., static_cast<double>(rhs / lhs));
+            EXPECT_TRUE(lhs < rhs);
+            lhs += rhs;
+            EXPECT_EQ(3.75, static_cast<double>(lhs));
+            ++lhs;
+            EXPECT_EQ(4.75, static_cast<double>(lhs));
+        }
+    }
+
+    namespace test_safe_scaled_integer {
+        TEST(force_inline, safe_scaled_integer)  // NOLINT
+        {
+            auto const lhs = safe_scaled_integer{1.25};
+            auto const rhs = safe_scaled_integer{2.5};
+            EXPECT_EQ(3.75, static_cast<double>(lhs + rhs));
+            EXPECT_EQ(3.125, static_cast<double>(lhs * rhs));
+            EXPECT_TRUE(lhs < rhs);
+            EXPECT_EQ(
+                    static_cast<double>(cnl::numeric_limits<cnl::int32>::max()) / 256,
+                    static_cast<double>(safe_scaled_integer{1e9}));
+        }
+    }
+
+    namespace test_wide_integer {
+        TEST(force_inline, wide_integer)  // NOLINT
+        {
+            auto const lhs = cnl::wide_integer<200>{1} << 150;
+            auto const rhs = cnl::wide_integer<200>{3};
+            EXPECT_EQ(cnl::wide_integer<200>{3} << 150, lhs * rhs);
+            EXPECT_EQ(lhs, (lhs * rhs) / rhs);
+        }
+    }
+}
@@ -0,0 +1,104 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl/instrumentation.h with CNL_USE_INSTRUMENTATION enabled
+
+#define CNL_USE_INSTRUMENTATION 1
+
+#include <cnl/all.h>
+#include <cnl/instrumentation.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string_view>
+#include <thread>
+
+namespace {
+#if !defined(CNL_INSTRUMENTATION_ENABLED)
+#error CNL_INSTRUMENTATION_ENABLED not defined by CNL_USE_INSTRUMENTATION
+#endif
+
+    using saturated_integer = cnl::overflow_integer<cnl::int32, cnl::saturated_overflow_tag>;
+    constexpr auto big = 0x60000000;
+    constexpr auto max = cnl::numeric_limits<cnl::int32>::max();
+
+    [[nodiscard]] auto count(std::string_view event, std::string_view operation)
+    {
+        auto const counters = cnl::instrumentation::snapshot();
+        auto total = cnl::uint64{0};
+        for (auto const& c : counters) {
+            if (c.event == event && c.operation.find(operation) != std::string::npos) {
+                total += c.count;
+            }
+        }
+        return total;
+    }
+
+    // instrumentation does not get in the way of constant evaluation
+    static_assert(saturated_integer{big} + saturated_integer{big} == max);
+
+    TEST(instrumentation, operation)  // NOLINT
+    {
+        cnl::instrumentation::reset();
+        auto lhs = cnl::scaled_integer<int, cnl::power<-8>>{1.25};
+        auto const rhs = cnl::scaled_integer<int, cnl::power<-8>>{2.5};
+        for (auto i = 0; i != 3; ++i) {
+            lhs = lhs + rhs;
+        }
+        EXPECT_EQ(8.75, static_cast<double>(lhs));
+        EXPECT_EQ(3U, count("operation", "add_op"));
+    }
+
+    TEST(instrumentation, overflow)  // NOLINT
+    {
+        cnl::instrumentation::reset();
+        auto const lhs = saturated_integer{big};
+        auto const rhs = saturated_integer{0x100};
+        EXPECT_EQ(big + 0x100, lhs + rhs);
+        EXPECT_EQ(max, lhs + lhs);
+        EXPECT_EQ(max, lhs + lhs);
+        EXPECT_EQ(2U, count("overflow", "add_op"));
+    }
+
+    TEST(instrumentation, rounding)  // NOLINT
+    {
+        cnl::instrumentation::reset();
+        auto const from = cnl::scaled_integer<int, cnl::power<-8>>{1.75};
+        auto const to = cnl::convert<cnl::nearest_rounding_tag, cnl::power<>, cnl::scaled_integer<int>>(from);
+        EXPECT_EQ(2, static_cast<int>(to));
+        EXPECT_EQ(1U, count("rounding", "convert_op"));
+    }
+
+    TEST(instrumentation, threads)  // NOLINT
+    {
+        cnl::instrumentation::reset();
+        auto const add = [] {
+            auto const lhs = saturated_integer{big};
+            EXPECT_EQ(max, lhs + lhs);
+        };
+        auto thread = std::thread{add};
+        add();
+        thread.join();
+
+        // counts of a finished thread are kept
+        EXPECT_EQ(2U, count("overflow", "add_op"));
+    }
+
+    TEST(instrumentation, write_csv)  // NOLINT
+    {
+        cnl::instrumentation::reset();
+        auto const lhs = saturated_integer{big};
+        EXPECT_EQ(max, lhs + lhs);
+
+        auto out = std::ostringstream{};
+        cnl::instrumentation::write_csv(out, cnl::instrumentation::snapshot());
+        auto const csv = out.str();
+        EXPECT_EQ(0U, csv.find("event,operation,type,count\n"));
+        EXPECT_NE(std::string::npos, csv.find("overflow,\"cnl::_impl::add_op\","));
+    }
+}
@@ -0,0 +1,146 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl::dot and cnl::gemm
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/elastic_integer.h>
+#include <cnl/linalg.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+using cnl::_impl::identical;
+
+namespace {
+    using q7 = cnl::scaled_integer<cnl::int8, cnl::power<-7>>;
+    using q14 = cnl::scaled_integer<cnl::int32, cnl::power<-14>>;
+
+    namespace test_dot_result {
+        static_assert(std::is_same_v<
+                      cnl::scaled_integer<cnl::int16, cnl::power<-14>>, cnl::dot_result_t<q7, q7, 1>>);
+        static_assert(std::is_same_v<q14, cnl::dot_result_t<q7, q7, 128>>);
+        static_assert(std::is_same_v<
+                      cnl::scaled_integer<cnl::int64, cnl::power<-14>>, cnl::dot_result_t<q7, q7, 1 << 17>>);
+        static_assert(std::is_same_v<
+                      cnl::elastic_integer<22>,
+                      cnl::dot_result_t<cnl::elastic_integer<7>, cnl::elastic_integer<7>, 128>>);
+        static_assert(std::is_same_v<
+                      cnl::elastic_integer<23, unsigned>,
+                      cnl::dot_result_t<cnl::elastic_integer<8, unsigned>, cnl::elastic_integer<8, unsigned>, 128>>);
+    }
+
+    namespace test_dot {
+        //! [dot example]
+        constexpr auto weights = std::array<q7, 3>{q7{.5}, q7{-.25}, q7{.75}};
+        constexpr auto activations = std::array<q7, 3>{q7{-1.}, q7{.5}, q7{.5}};
+
+        // the sum of three products of 8-bit numbers needs 17 digits
+        static_assert(identical(q14{-.25}, cnl::dot(weights, activations)));
+        //! [dot example]
+
+        // the greatest possible sum
+        constexpr auto most_negative = std::array<q7, 128>{
+                q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.},
+                q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.},
+                q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.},
+                q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.},
+                q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.},
+                q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.},
+                q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.},
+                q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.},
+                q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.},
+                q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.},
+                q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.},
+                q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.},
+                q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.},
+                q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.},
+                q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.},
+                q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}, q7{-1.}};
+        static_assert(identical(q14{128.}, cnl::dot(most_negative, most_negative)));
+
+        TEST(dot, dynamic_extent)  // NOLINT
+        {
+            // more products than fit in one 32-bit chunk
+            constexpr auto size = 200000;
+            auto a = std::vector<q7>(size);
+            auto b = std::vector<q7>(size);
+            auto expected = cnl::int64{0};
+            for (auto index = 0; index != size; ++index) {
+                auto const rep_a = static_cast<cnl::int8>(index % 256 - 128);
+                auto const rep_b = static_cast<cnl::int8>((index % 3 == 0) ? -128 : index % 101);
+                a[index] = cnl::wrap<q7>(rep_a);
+                b[index] = cnl::wrap<q7>(rep_b);
+                expected += cnl::int64{rep_a} * rep_b;
+            }
+
+            auto const actual = cnl::dot(a, b);
+            static_assert(std::is_same_v<
+                          cnl::scaled_integer<cnl::int64, cnl::power<-14>>, decltype(cnl::dot(a, b))>);
+            EXPECT_EQ(expected, cnl::unwrap(actual));
+        }
+    }
+
+    namespace test_gemm {
+        //! [gemm example]
+        using rounding_q7 = cnl::scaled_integer<cnl::rounding_integer<cnl::int8>, cnl::power<-7>>;
+
+        TEST(gemm, example)  // NOLINT
+        {
+            // 2x3 matrix times 3x2 matrix
+            auto const a = std::vector<q7>{q7{.5}, q7{.25}, q7{0.}, q7{-.5}, q7{.125}, q7{.75}};
+            auto const b = std::vector<q7>{q7{.5}, q7{-.5}, q7{.25}, q7{.25}, q7{.0078125}, q7{.5}};
+
+            // the exact products are rounded to the nearest multiple of 2^-7,
+            // e.g. -.212890625 becomes -.2109375
+            auto c = std::vector<rounding_q7>(4);
+            cnl::gemm(a, b, c, 2, 2, 3);
+            EXPECT_EQ((std::vector<rounding_q7>{.3125, -.1875, -.2109375, .65625}), c);
+        }
+        //! [gemm example]
+
+        TEST(gemm, blocks)  // NOLINT
+        {
+            // dimensions which are not multiples of the block sizes
+            constexpr auto m = std::size_t{5};
+            constexpr auto n = std::size_t{70};
+            constexpr auto k = std::size_t{300};
+
+            auto a = std::vector<q7>(m * k);
+            auto b = std::vector<q7>(k * n);
+            for (auto index = std::size_t{0}; index != a.size(); ++index) {
+                a[index] = cnl::wrap<q7>(static_cast<cnl::int8>(index * 37 % 256 - 128));
+            }
+            for (auto index = std::size_t{0}; index != b.size(); ++index) {
+                b[index] = cnl::wrap<q7>(static_cast<cnl::int8>(index * 91 % 255 - 127));
+            }
+
+            auto exact = std::vector<q14>(m * n);
+            cnl::gemm(a, b, exact, m, n, k);
+            auto rounded = std::vector<rounding_q7>(m * n);
+            cnl::gemm(a, b, rounded, m, n, k);
+
+            for (auto row = std::size_t{0}; row != m; ++row) {
+                for (auto column = std::size_t{0}; column != n; ++column) {
+                    auto expected = cnl::int64{0};
+                    for (auto depth = std::size_t{0}; depth != k; ++depth) {
+                        expected += cnl::int64{cnl::unwrap(a[row * k + depth])}
+                                  * cnl::unwrap(b[depth * n + column]);
+                    }
+                    auto const result = cnl::wrap<cnl::scaled_integer<cnl::int64, cnl::power<-14>>>(expected);
+                    ASSERT_EQ(static_cast<q14>(result), exact[row * n + column]);
+                    ASSERT_EQ(static_cast<rounding_q7>(result), rounded[row * n + column]);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,122 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl::fma and cnl::multiply_add
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/cmath.h>
+#include <cnl/elastic_integer.h>
+#include <cnl/overflow_integer.h>
+#include <cnl/scaled_integer.h>
+#include <cnl/static_number.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+namespace {
+    using cnl::_impl::identical;
+
+    namespace test_native {
+        // intermediate product exceeds int
+        static_assert(identical(1500000000, cnl::fma(50000, 50000, -1000000000)));
+        static_assert(identical(7U, cnl::fma(2U, 3U, 1U)));
+        static_assert(identical(cnl::int64{-5}, cnl::fma(cnl::int64{-2}, cnl::int64{3}, cnl::int64{1})));
+        static_assert(identical(cnl::int64{1}, cnl::fma(cnl::int8{-128}, cnl::int8{-128}, cnl::int64{-16383})));
+    }
+
+    namespace test_exact_multiply_add {
+        static_assert(identical(
+                cnl::int64{4611686016279904256},
+                cnl::_impl::exact_multiply_add<int, int, int>{}(-2147483647 - 1, -2147483647 - 1, -2147483647 - 1)));
+        static_assert(identical(
+                cnl::uint64{18446744069414584320ULL},
+                cnl::_impl::exact_multiply_add<unsigned, unsigned, unsigned>{}(4294967295U, 4294967295U, 4294967295U)));
+        static_assert(!cnl::_impl::exactly_multiply_addable<int, unsigned, int>);
+#if defined(CNL_INT128_ENABLED)
+        static_assert(identical(
+                cnl::int128{1} << 64,
+                cnl::_impl::exact_multiply_add<cnl::int64, cnl::int64, cnl::int64>{}(
+                        cnl::int64{1} << 32, cnl::int64{1} << 32, cnl::int64{0})));
+#endif
+
+        using duplex = cnl::_impl::duplex_integer<cnl::int32, cnl::uint32>;
+        static_assert(identical(
+                cnl::_impl::duplex_integer<duplex, cnl::_impl::duplex_integer<cnl::uint32, cnl::uint32>>{
+                        cnl::int64{1} << 32}
+                        * cnl::_impl::duplex_integer<duplex, cnl::_impl::duplex_integer<cnl::uint32, cnl::uint32>>{
+                                cnl::int64{1} << 32}
+                        - 1,
+                cnl::_impl::exact_multiply_add<duplex, duplex, duplex>{}(
+                        duplex{cnl::int64{1} << 32}, duplex{cnl::int64{1} << 32}, duplex{-1})));
+    }
+
+    namespace test_overflow_integer {
+        using saturated_int = cnl::overflow_integer<int, cnl::saturated_overflow_tag>;
+
+        // checked once, at the end
+        static_assert(identical(
+                saturated_int{1500000000},
+                cnl::fma(saturated_int{50000}, saturated_int{50000}, saturated_int{-1000000000})));
+        static_assert(identical(
+                saturated_int{1147483647},
+                saturated_int{50000} * saturated_int{50000} + saturated_int{-1000000000}));
+
+        static_assert(identical(
+                saturated_int{2147483647},
+                cnl::fma(saturated_int{50000}, saturated_int{50000}, saturated_int{0})));
+        static_assert(identical(
+                saturated_int{-2147483647 - 1},
+                cnl::fma(saturated_int{-50000}, saturated_int{50000}, saturated_int{0})));
+    }
+
+    namespace test_scaled_integer {
+        using sample = cnl::scaled_integer<cnl::overflow_integer<int, cnl::saturated_overflow_tag>, cnl::power<-8>>;
+        using accumulator = cnl::scaled_integer<cnl::overflow_integer<cnl::int64, cnl::saturated_overflow_tag>, cnl::power<-16>>;
+
+        static_assert(identical(
+                accumulator{1000},
+                cnl::fma(sample{200}, sample{200}, accumulator{-39000.})));
+        static_assert(accumulator{1000} != sample{200} * sample{200} + accumulator{-39000.});
+        static_assert(identical(
+                accumulator{-1.75},
+                cnl::fma(sample{.5}, sample{-1.5}, accumulator{-1})));
+
+        // addend aligned with the product
+        static_assert(identical(
+                cnl::scaled_integer<int, cnl::power<-2>>{3.25},
+                cnl::fma(
+                        cnl::scaled_integer<int, cnl::power<-1>>{1.5},
+                        cnl::scaled_integer<int, cnl::power<-1>>{1.5},
+                        cnl::scaled_integer<int, cnl::power<0>>{1})));
+
+        // decimal
+        static_assert(identical(
+                cnl::scaled_integer<cnl::int64, cnl::power<-4, 10>>{12.5625},
+                cnl::fma(
+                        cnl::scaled_integer<cnl::int64, cnl::power<-2, 10>>{1.25},
+                        cnl::scaled_integer<cnl::int64, cnl::power<-2, 10>>{10.},
+                        cnl::scaled_integer<cnl::int64, cnl::power<-4, 10>>{.0625})));
+    }
+
+    namespace test_elastic {
+        static_assert(identical(
+                cnl::elastic_integer<15>{1} * cnl::elastic_integer<15>{1} + cnl::elastic_integer<15>{1},
+                cnl::fma(cnl::elastic_integer<15>{1}, cnl::elastic_integer<15>{1}, cnl::elastic_integer<15>{1})));
+        static_assert(identical(
+                cnl::static_number<16, -8>{1.5} * cnl::static_number<16, -8>{-2} + cnl::static_number<32, -16>{1},
+                cnl::fma(cnl::static_number<16, -8>{1.5}, cnl::static_number<16, -8>{-2}, cnl::static_number<32, -16>{1})));
+    }
+
+    TEST(multiply_add, floating_point)  // NOLINT
+    {
+        // 1 + 2^-27 squared is 1 + 2^-26 + 2^-54 which rounds to 1 + 2^-26
+        auto const x = 1. + std::ldexp(1., -27);
+        auto const y = -(1. + std::ldexp(1., -26));
+        ASSERT_EQ(std::ldexp(1., -54), cnl::fma(x, x, y));
+        ASSERT_EQ(std::fma(x, x, y), cnl::fma(x, x, y));
+    }
+}
@@ -0,0 +1,187 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl::packed_array and cnl::packed_vector
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/elastic_integer.h>
+#include <cnl/packed.h>
+#include <cnl/scaled_integer.h>
+#include <cnl/static_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+using cnl::_impl::identical;
+
+namespace {
+    using elastic12 = cnl::elastic_integer<12>;
+    using static20 = cnl::static_integer<20>;
+    using unsigned_elastic5 = cnl::elastic_integer<5, unsigned>;
+
+    namespace test_width {
+        static_assert(cnl::packed_array<elastic12, 10>::element_width == 13);
+        static_assert(cnl::packed_array<static20, 10>::element_width == 21);
+        static_assert(cnl::packed_array<unsigned_elastic5, 10>::element_width == 5);
+        static_assert(cnl::packed_array<cnl::int64, 10>::element_width == 64);
+
+        // 64 elements of 13 bits fill 13 words, plus one word of padding
+        static_assert(sizeof(cnl::packed_array<elastic12, 64>) == 14 * sizeof(cnl::uint64));
+        static_assert(sizeof(cnl::packed_array<elastic12, 64>) < sizeof(cnl::int16) * 64);
+    }
+
+    namespace test_iterator {
+        static_assert(std::random_access_iterator<cnl::packed_array<elastic12, 10>::iterator>);
+        static_assert(std::random_access_iterator<cnl::packed_array<elastic12, 10>::const_iterator>);
+        static_assert(std::output_iterator<cnl::packed_array<elastic12, 10>::iterator, elastic12>);
+        static_assert(std::ranges::random_access_range<cnl::packed_vector<elastic12>>);
+    }
+
+    namespace test_array {
+        constexpr auto three = cnl::packed_array<elastic12, 3>{1, -2048, 2047};
+        static_assert(identical(elastic12{-2048}, three[1]));
+        static_assert(identical(elastic12{2047}, three[2]));
+        constexpr auto one = cnl::packed_array<elastic12, 3>{1};
+        static_assert(identical(elastic12{0}, one.back()));
+
+        static_assert([] {
+            auto a = cnl::packed_array<elastic12, 10>{};
+            for (auto i = 0; i != 10; ++i) {
+                a[i] = elastic12{(i * 997) % 4096 - 2048};
+            }
+            for (auto i = 0; i != 10; ++i) {
+                if (a[i] != elastic12{(i * 997) % 4096 - 2048}) {
+                    return false;
+                }
+            }
+            return true;
+        }());
+
+        constexpr auto unsigned_elements = cnl::packed_array<unsigned_elastic5, 20>{
+                0, 31, 0, 31, 0, 31, 0, 31, 0, 31, 0, 31, 31};
+        static_assert(identical(unsigned_elastic5{31}, unsigned_elements[12]));
+        static_assert(identical(unsigned_elastic5{0}, unsigned_elements[13]));
+
+        TEST(packed_array, random_access)  // NOLINT
+        {
+            auto a = cnl::packed_array<static20, 100>{};
+            for (auto i = 0; i != 100; ++i) {
+                a[i] = static20{i * 10477 - 524288};
+            }
+            for (auto i = 99; i >= 0; --i) {
+                EXPECT_EQ(static20{i * 10477 - 524288}, a[i]);
+            }
+        }
+
+        TEST(packed_array, neighbours)  // NOLINT
+        {
+            auto a = cnl::packed_array<elastic12, 10>{};
+            a.fill(-1);
+            a[4] = 0;
+            EXPECT_EQ(elastic12{-1}, a[3]);
+            EXPECT_EQ(elastic12{0}, a[4]);
+            EXPECT_EQ(elastic12{-1}, a[5]);
+        }
+
+        TEST(packed_array, algorithms)  // NOLINT
+        {
+            auto a = cnl::packed_array<elastic12, 5>{5, -3, 1, 4, -2};
+            std::sort(a.begin(), a.end(), std::greater<>{});
+            EXPECT_EQ((cnl::packed_array<elastic12, 5>{5, 4, 1, -2, -3}), a);
+            EXPECT_EQ(5, std::accumulate(a.begin(), a.end(), 0, [](int sum, elastic12 e) {
+                          return sum + static_cast<int>(e);
+                      }));
+        }
+    }
+
+    namespace test_vector {
+        TEST(packed_vector, push_back)  // NOLINT
+        {
+            auto v = cnl::packed_vector<elastic12>{};
+            for (auto i = 0; i != 1000; ++i) {
+                v.push_back(elastic12{i % 4096 - 2048});
+            }
+            ASSERT_EQ(1000U, v.size());
+            for (auto i = 0; i != 1000; ++i) {
+                EXPECT_EQ(elastic12{i % 4096 - 2048}, v[i]);
+            }
+            EXPECT_LT(v.words().size_bytes(), 1000 * sizeof(cnl::int16));
+        }
+
+        TEST(packed_vector, resize)  // NOLINT
+        {
+            auto v = cnl::packed_vector<elastic12>(7, elastic12{-5});
+            v.resize(3);
+            v.resize(6);
+            EXPECT_EQ((cnl::packed_vector<elastic12>{-5, -5, -5, 0, 0, 0}), v);
+            v.resize(8, elastic12{9});
+            EXPECT_EQ(elastic12{9}, v.back());
+            v.pop_back();
+            v.clear();
+            EXPECT_TRUE(v.empty());
+            EXPECT_EQ(cnl::packed_vector<elastic12>{}, v);
+        }
+    }
+
+    namespace test_bulk {
+        // more than two blocks of 64 elements and a tail
+        constexpr auto size = 150;
+
+        TEST(packed, unpack)  // NOLINT
+        {
+            auto v = cnl::packed_vector<elastic12>(size);
+            for (auto i = 0; i != size; ++i) {
+                v[i] = elastic12{i * 31 - 2048};
+            }
+
+            auto values = std::vector<elastic12>(size);
+            cnl::unpack(v, values);
+            EXPECT_TRUE(std::equal(v.begin(), v.end(), values.begin()));
+
+            // or unpack to the rep
+            auto reps = std::vector<int>(size);
+            cnl::unpack(v, reps);
+            for (auto i = 0; i != size; ++i) {
+                EXPECT_EQ(i * 31 - 2048, reps[i]);
+            }
+        }
+
+        TEST(packed, pack)  // NOLINT
+        {
+            auto reps = std::vector<int>(size);
+            std::iota(reps.begin(), reps.end(), -75);
+
+            auto a = cnl::packed_array<static20, size>{};
+            a.fill(static20{-1});
+            cnl::pack(reps, a);
+            for (auto i = 0; i != size; ++i) {
+                EXPECT_EQ(static20{i - 75}, a[i]);
+            }
+
+            auto round_trip = std::vector<int>(size);
+            cnl::unpack(a, round_trip);
+            EXPECT_EQ(reps, round_trip);
+        }
+
+        TEST(packed, scaled_integer)  // NOLINT
+        {
+            using scaled = cnl::scaled_integer<cnl::elastic_integer<10>, cnl::power<-4>>;
+            auto values = std::vector<scaled>(size);
+            for (auto i = 0; i != size; ++i) {
+                values[i] = scaled{i / 4. - 20};
+            }
+
+            auto v = cnl::packed_vector<scaled>(size);
+            cnl::pack(values, v);
+            EXPECT_EQ(-20., static_cast<double>(v.front()));
+            EXPECT_EQ(17.25, static_cast<double>(v.back()));
+        }
+    }
+}
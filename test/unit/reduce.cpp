@@ -0,0 +1,119 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl::reduce and cnl::transform_reduce
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/elastic_integer.h>
+#include <cnl/reduce.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+using cnl::_impl::identical;
+
+namespace {
+    using q15 = cnl::scaled_integer<cnl::int16, cnl::power<-15>>;
+
+    namespace test_reduce_result {
+        static_assert(std::is_same_v<q15, cnl::reduce_result_t<q15, 1>>);
+        static_assert(std::is_same_v<
+                      cnl::scaled_integer<cnl::int32, cnl::power<-15>>, cnl::reduce_result_t<q15, 2>>);
+        static_assert(std::is_same_v<
+                      cnl::scaled_integer<cnl::int32, cnl::power<-15>>, cnl::reduce_result_t<q15, 1 << 16>>);
+        static_assert(std::is_same_v<
+                      cnl::scaled_integer<cnl::int64, cnl::power<-15>>, cnl::reduce_result_t<q15, (1 << 16) + 1>>);
+        static_assert(std::is_same_v<
+                      cnl::elastic_integer<14>, cnl::reduce_result_t<cnl::elastic_integer<7>, 128>>);
+        static_assert(std::is_same_v<
+                      cnl::elastic_integer<15, unsigned>,
+                      cnl::reduce_result_t<cnl::elastic_integer<8, unsigned>, 128>>);
+    }
+
+    namespace test_reduce {
+        //! [reduce example]
+        constexpr auto samples = std::array<q15, 4>{q15{.75}, q15{.5}, q15{-.125}, q15{.5}};
+
+        // the sum of four 16-bit numbers needs 17 digits
+        static_assert(identical(
+                cnl::scaled_integer<cnl::int32, cnl::power<-15>>{1.625}, cnl::reduce(samples)));
+        //! [reduce example]
+
+        static_assert(identical(
+                cnl::scaled_integer<cnl::int32, cnl::power<-15>>{1.625},
+                cnl::reduce(cnl::execution::seq, samples)));
+
+        static_assert(identical(cnl::int64{0}, cnl::reduce(std::vector<cnl::int32>{})));
+
+        TEST(reduce, dynamic_extent)  // NOLINT
+        {
+            // more values than fit in one 32-bit chunk
+            auto const values = std::vector<q15>(200000, q15{-1});
+            EXPECT_TRUE(identical(
+                    cnl::scaled_integer<cnl::int64, cnl::power<-15>>{cnl::int64{-200000}}, cnl::reduce(values)));
+        }
+
+        TEST(reduce, parallel)  // NOLINT
+        {
+            auto values = std::vector<q15>(3000017);
+            for (auto index = std::size_t{0}; index != values.size(); ++index) {
+                values[index] = cnl::wrap<q15>(
+                        static_cast<cnl::int16>((index % 7 == 0) ? -32768 : index * 7919 % 65536 - 32768));
+            }
+            auto expected = cnl::int64{0};
+            for (auto const value : values) {
+                expected += cnl::unwrap(value);
+            }
+
+            EXPECT_EQ(expected, cnl::unwrap(cnl::reduce(values)));
+            EXPECT_EQ(expected, cnl::unwrap(cnl::reduce(cnl::execution::par, values)));
+            for (auto threads : {1U, 2U, 3U, 7U, 64U}) {
+                EXPECT_EQ(expected, cnl::unwrap(cnl::reduce(cnl::execution::parallel_policy{threads}, values)))
+                        << threads;
+            }
+        }
+
+        TEST(reduce, parallel_small)  // NOLINT
+        {
+            auto const values = std::vector<int>{1, 2, 3};
+            EXPECT_TRUE(identical(cnl::int64{6}, cnl::reduce(cnl::execution::parallel_policy{8}, values)));
+        }
+
+        TEST(reduce, elastic_integer)  // NOLINT
+        {
+            auto const values = std::vector<cnl::elastic_integer<40>>(1 << 20, (cnl::int64{1} << 40) - 1);
+            EXPECT_TRUE(identical(
+                    cnl::elastic_integer<71>{((cnl::int64{1} << 40) - 1) * (1 << 20)},
+                    cnl::reduce(cnl::execution::parallel_policy{4}, values)));
+        }
+    }
+
+    namespace test_transform_reduce {
+        //! [transform_reduce example]
+        constexpr auto signal = std::array<q15, 3>{q15{-1}, q15{.5}, q15{-.25}};
+
+        // the energy of a signal: the sum of the squares of its samples
+        constexpr auto square = [](q15 sample) { return sample * sample; };
+        static_assert(identical(
+                cnl::scaled_integer<cnl::int64, cnl::power<-30>>{1.3125},
+                cnl::transform_reduce(signal, square)));
+        //! [transform_reduce example]
+
+        TEST(transform_reduce, parallel)  // NOLINT
+        {
+            // the greatest energy
+            auto const values = std::vector<q15>(1 << 20, q15{-1});
+            auto const energy = cnl::transform_reduce(cnl::execution::par, values, square);
+            EXPECT_TRUE(identical(cnl::scaled_integer<cnl::int64, cnl::power<-30>>{cnl::int64{1} << 20}, energy));
+            EXPECT_TRUE(identical(energy, cnl::transform_reduce(values, square)));
+        }
+    }
+}
@@ -0,0 +1,111 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl::from_rep_span and cnl::to_rep_span
+
+#include <cnl/elastic_integer.h>
+#include <cnl/num_traits.h>
+#include <cnl/rep_span.h>
+#include <cnl/scaled_integer.h>
+#include <cnl/static_number.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+    using q15 = cnl::scaled_integer<cnl::int16, cnl::power<-15>>;
+    using elastic_q15 = cnl::scaled_integer<cnl::elastic_integer<15, cnl::int16>, cnl::power<-15>>;
+
+    namespace test_layout {
+        static_assert(cnl::_impl::rep_layout_of<q15, cnl::int16>);
+        static_assert(cnl::_impl::rep_layout_of<elastic_q15, cnl::elastic_integer<15, cnl::int16>>);
+        static_assert(cnl::_impl::rep_layout_of<elastic_q15, cnl::int16>);
+        static_assert(cnl::_impl::rep_layout_of<cnl::static_number<20, -10>, int>);
+        static_assert(!cnl::_impl::rep_layout_of<q15, cnl::uint16>);
+        static_assert(!cnl::_impl::rep_layout_of<q15, int>);
+    }
+
+    namespace test_from_rep_span {
+        static_assert(std::is_same_v<
+                std::span<q15>,
+                decltype(cnl::from_rep_span<q15>(std::declval<std::vector<cnl::int16>&>()))>);
+        static_assert(std::is_same_v<
+                std::span<q15 const>,
+                decltype(cnl::from_rep_span<q15>(std::declval<std::vector<cnl::int16> const&>()))>);
+        static_assert(std::is_same_v<
+                std::span<elastic_q15 const, 4>,
+                decltype(cnl::from_rep_span<elastic_q15>(std::declval<std::array<cnl::int16, 4> const&>()))>);
+
+        TEST(rep_span, from_rep_span)  // NOLINT
+        {
+            auto samples = std::vector<cnl::int16>{-32768, -16384, 0, 16384, 32767};
+            auto const values = cnl::from_rep_span<q15>(samples);
+            ASSERT_EQ(samples.size(), values.size());
+            EXPECT_EQ(static_cast<void*>(samples.data()), static_cast<void*>(values.data()));
+            EXPECT_EQ(q15{-1.}, values[0]);
+            EXPECT_EQ(q15{-.5}, values[1]);
+            EXPECT_EQ(q15{.5}, values[3]);
+
+            // writes through the view modify the buffer
+            values[2] = q15{.25};
+            EXPECT_EQ(8192, samples[2]);
+        }
+
+        TEST(rep_span, from_bytes)  // NOLINT
+        {
+            // e.g. a buffer filled by a DMA transfer
+            auto const bytes = std::array<unsigned char, 4>{0x00, 0x40, 0x00, 0xc0};
+            auto samples = std::array<cnl::int16, 2>{};
+            std::memcpy(samples.data(), bytes.data(), bytes.size());
+
+            auto const values = cnl::from_rep_span<elastic_q15>(samples);
+            EXPECT_EQ(cnl::wrap<elastic_q15>(samples[0]), values[0]);
+            EXPECT_EQ(cnl::wrap<elastic_q15>(samples[1]), values[1]);
+        }
+    }
+
+    namespace test_to_rep_span {
+        static_assert(std::is_same_v<
+                std::span<cnl::int16>,
+                decltype(cnl::to_rep_span(std::declval<std::vector<q15>&>()))>);
+        static_assert(std::is_same_v<
+                std::span<cnl::elastic_integer<15, cnl::int16> const>,
+                decltype(cnl::to_rep_span(std::declval<std::vector<elastic_q15> const&>()))>);
+        static_assert(std::is_same_v<
+                std::span<cnl::int16, 3>,
+                decltype(cnl::to_rep_span<cnl::int16>(std::declval<std::array<elastic_q15, 3>&>()))>);
+
+        TEST(rep_span, to_rep_span)  // NOLINT
+        {
+            auto values = std::array<q15, 3>{q15{-1.}, q15{.5}, q15{.75}};
+            auto const reps = cnl::to_rep_span(values);
+            EXPECT_EQ(-32768, reps[0]);
+            EXPECT_EQ(16384, reps[1]);
+            EXPECT_EQ(24576, reps[2]);
+
+            reps[0] = -8192;
+            EXPECT_EQ(q15{-.25}, values[0]);
+        }
+
+        TEST(rep_span, round_trip)  // NOLINT
+        {
+            auto values = std::vector<elastic_q15>(100);
+            for (auto i = 0; i != 100; ++i) {
+                values[i] = elastic_q15{i / 128.};
+            }
+            auto const reps = cnl::to_rep_span<cnl::int16>(std::as_const(values));
+            auto const round_trip = cnl::from_rep_span<elastic_q15>(reps);
+            EXPECT_TRUE(std::equal(values.begin(), values.end(), round_trip.begin(), round_trip.end()));
+        }
+    }
+}
@@ -257,4 +257,82 @@ namespace {
                     "cnl::shift_right test failed");
         }
     }
+
+    namespace tie_to_even_rounding {
+
+        namespace convert {
+            static_assert(
+                    identical(
+                            cnl::uint8{100}, cnl::convert<
+                                                     cnl::tie_to_even_rounding_tag,
+                                                     cnl::_impl::native_tag, cnl::uint8>(100.5)),
+                    "cnl::convert test failed");
+            static_assert(
+                    identical(
+                            cnl::uint8{102}, cnl::convert<
+                                                     cnl::tie_to_even_rounding_tag,
+                                                     cnl::_impl::native_tag, cnl::uint8>(101.5)),
+                    "cnl::convert test failed");
+            static_assert(
+                    identical(
+                            cnl::int16{-1000},
+                            cnl::convert<
+                                    cnl::tie_to_even_rounding_tag, cnl::_impl::native_tag,
+                                    cnl::int16>(-1000.5L)),
+                    "cnl::convert test failed");
+            static_assert(
+                    identical(
+                            cnl::int16{-1002},
+                            cnl::convert<
+                                    cnl::tie_to_even_rounding_tag, cnl::_impl::native_tag,
+                                    cnl::int16>(-1001.5L)),
+                    "cnl::convert test failed");
+            static_assert(
+                    identical(
+                            55, cnl::convert<
+                                        cnl::tie_to_even_rounding_tag, cnl::_impl::native_tag,
+                                        cnl::int32>(55.2F)),
+                    "cnl::convert test failed");
+            static_assert(
+                    identical(
+                            -1,
+                            cnl::convert<
+                                    cnl::tie_to_even_rounding_tag, cnl::_impl::native_tag, int>(
+                                    -0.51)),
+                    "cnl::convert test failed");
+            static_assert(
+                    identical(
+                            0,
+                            cnl::convert<
+                                    cnl::tie_to_even_rounding_tag, cnl::_impl::native_tag, int>(
+                                    0.50)),
+                    "cnl::convert test failed");
+        }
+
+        namespace divide {
+            static_assert(
+                    identical(-2, cnl::divide<cnl::tie_to_even_rounding_tag>(-990, 660)),
+                    "cnl::divide test failed");
+            static_assert(
+                    identical(2, cnl::divide<cnl::tie_to_even_rounding_tag>(-606, -404)),
+                    "cnl::divide test failed");
+            static_assert(
+                    identical(1, cnl::divide<cnl::tie_to_even_rounding_tag>(8, 9)),
+                    "cnl::divide test failed");
+            static_assert(
+                    identical(0, cnl::divide<cnl::tie_to_even_rounding_tag>(4, -8)),
+                    "cnl::divide test failed");
+            static_assert(
+                    identical(-2, cnl::divide<cnl::tie_to_even_rounding_tag>(-9, 6)),
+                    "cnl::divide test failed");
+            static_assert(
+                    identical(
+                            2, cnl::divide<cnl::tie_to_even_rounding_tag, cnl::uint16, int>(
+                                       999, 666)),
+                    "cnl::divide test failed");
+            static_assert(
+                    identical(2U, cnl::divide<cnl::tie_to_even_rounding_tag>(5U, 2U)),
+                    "cnl::divide test failed");
+        }
+    }
 }
@@ -188,6 +188,19 @@ namespace {
         static_assert(rounding_integer{-0.501} == -1, "cnl::rounding_integer test failed");
     }
 
+    namespace test_tie_to_even_float_conversion {
+        using rounding_integer = cnl::rounding_integer<int, cnl::tie_to_even_rounding_tag>;
+
+        static_assert(rounding_integer{.5} == 0, "cnl::rounding_integer test failed");
+        static_assert(rounding_integer{1.5} == 2, "cnl::rounding_integer test failed");
+        static_assert(rounding_integer{2.5} == 2, "cnl::rounding_integer test failed");
+        static_assert(rounding_integer{-.5} == 0, "cnl::rounding_integer test failed");
+        static_assert(rounding_integer{-1.5} == -2, "cnl::rounding_integer test failed");
+        static_assert(rounding_integer{-2.5} == -2, "cnl::rounding_integer test failed");
+        static_assert(rounding_integer{2.501} == 3, "cnl::rounding_integer test failed");
+        static_assert(rounding_integer{-2.499} == -2, "cnl::rounding_integer test failed");
+    }
+
     namespace test_minus {
         static_assert(
                 identical(rounding_integer<int>{-1}, -rounding_integer<char>{1}),
@@ -209,6 +222,17 @@ namespace {
                                 cnl::_impl::wrapper<int, cnl::nearest_rounding_tag>{6}, 9)));
     }
 
+    namespace divide_tie_to_even {
+        using rounding_integer = cnl::rounding_integer<int, cnl::tie_to_even_rounding_tag>;
+
+        static_assert(identical(rounding_integer{2}, rounding_integer{5} / 2));
+        static_assert(identical(rounding_integer{4}, rounding_integer{7} / 2));
+        static_assert(identical(rounding_integer{-2}, rounding_integer{-5} / 2));
+        static_assert(identical(rounding_integer{-4}, rounding_integer{7} / -2));
+        static_assert(identical(rounding_integer{3}, rounding_integer{11} / 4));
+        static_assert(identical(rounding_integer{2}, rounding_integer{10} / 4));
+    }
+
     namespace divide {
         static_assert(identical(cnl::rounding_integer<>{-1}, cnl::rounding_integer<>{-2} / 3));
         static_assert(identical(cnl::rounding_integer<>{0}, cnl::rounding_integer<>{1} / -3));
@@ -6,6 +6,9 @@
 
 #include <cnl/rounding.h>
 #include <cnl/scaled_integer.h>
+#include <cnl/elastic_integer.h>
+
+#include <cnl/cstdint.h>
 
 #include <cnl/_impl/type_traits/assert_same.h>
 #include <cnl/_impl/type_traits/identical.h>
@@ -48,6 +51,48 @@ namespace {
                                              "cnl::scaled_integer, cnl::scaled_integer>");
     }
 
+    namespace test_nearest_unsigned {
+        static_assert(
+                identical(
+                        cnl::scaled_integer<unsigned, cnl::power<-1>>{1.5},
+                        cnl::convert<
+                                cnl::nearest_rounding_tag, cnl::_impl::native_tag,
+                                cnl::scaled_integer<unsigned, cnl::power<-1>>>(
+                                cnl::scaled_integer<unsigned, cnl::power<-4>>{1.25})),
+                "cnl::convert<cnl::nearest_rounding_tag, "
+                "cnl::scaled_integer<unsigned>, cnl::scaled_integer<unsigned>>");
+        static_assert(
+                identical(
+                        cnl::scaled_integer<unsigned, cnl::power<-1>>{1073741824.},
+                        cnl::convert<
+                                cnl::nearest_rounding_tag, cnl::_impl::native_tag,
+                                cnl::scaled_integer<unsigned, cnl::power<-1>>>(
+                                cnl::scaled_integer<unsigned, cnl::power<-2>>{1073741823.75})),
+                "cnl::convert<cnl::nearest_rounding_tag, "
+                "cnl::scaled_integer<unsigned>, cnl::scaled_integer<unsigned>>");
+    }
+
+    namespace test_nearest_requantize {
+        static_assert(
+                identical(
+                        cnl::scaled_integer<cnl::int16, cnl::power<-8>>{-127.5},
+                        cnl::convert<
+                                cnl::nearest_rounding_tag, cnl::_impl::native_tag,
+                                cnl::scaled_integer<cnl::int16, cnl::power<-8>>>(
+                                cnl::scaled_integer<cnl::int32, cnl::power<-16>>{-127.498046875})),
+                "cnl::convert<cnl::nearest_rounding_tag, "
+                "cnl::scaled_integer<int16>, cnl::scaled_integer<int32>>");
+        static_assert(
+                identical(
+                        cnl::scaled_integer<cnl::int16, cnl::power<-8>>{-127.49609375},
+                        cnl::convert<
+                                cnl::nearest_rounding_tag, cnl::_impl::native_tag,
+                                cnl::scaled_integer<cnl::int16, cnl::power<-8>>>(
+                                cnl::scaled_integer<cnl::int32, cnl::power<-16>>{-127.4980316162109375})),
+                "cnl::convert<cnl::nearest_rounding_tag, "
+                "cnl::scaled_integer<int16>, cnl::scaled_integer<int32>>");
+    }
+
     namespace test_nearest_round_up_float {
         static constexpr auto expected = cnl::scaled_integer<int, cnl::power<-2>>{-0.25};
         static constexpr auto actual = cnl::convert<
@@ -147,4 +192,41 @@ namespace {
         static_assert(
                 identical(cnl::scaled_integer<int, cnl::power<-1>>{0.5}, b));
     }
+
+    namespace test_tie_to_even {
+        template<typename Destination, typename Source>
+        constexpr auto tie_to_even(Source const& from)
+        {
+            return cnl::convert<cnl::tie_to_even_rounding_tag, cnl::_impl::native_tag, Destination>(from);
+        }
+
+        using s7_8 = cnl::scaled_integer<cnl::int16, cnl::power<-8>>;
+        using s15_16 = cnl::scaled_integer<cnl::int32, cnl::power<-16>>;
+        using cents = cnl::scaled_integer<cnl::int64, cnl::power<-2, 10>>;
+        using dimes = cnl::scaled_integer<cnl::int64, cnl::power<-1, 10>>;
+        using dollars = cnl::scaled_integer<cnl::int64, cnl::power<0, 10>>;
+
+        static_assert(identical(s7_8{1.}, tie_to_even<s7_8>(s15_16{1.001953125})));
+        static_assert(identical(s7_8{1.0078125}, tie_to_even<s7_8>(s15_16{1.005859375})));
+        static_assert(identical(s7_8{-1.}, tie_to_even<s7_8>(s15_16{-1.001953125})));
+        static_assert(identical(s7_8{-1.0078125}, tie_to_even<s7_8>(s15_16{-1.005859375})));
+
+        static_assert(identical(dimes{1.2}, tie_to_even<dimes>(cents{1.25})));
+        static_assert(identical(dimes{1.4}, tie_to_even<dimes>(cents{1.35})));
+        static_assert(identical(dimes{-1.2}, tie_to_even<dimes>(cents{-1.25})));
+        static_assert(identical(dimes{-1.4}, tie_to_even<dimes>(cents{-1.35})));
+        static_assert(identical(dollars{2}, tie_to_even<dollars>(cents{2.5})));
+        static_assert(identical(dollars{4}, tie_to_even<dollars>(cents{3.5})));
+
+        static_assert(identical(s7_8{1.}, tie_to_even<s7_8>(1.001953125)));
+        static_assert(identical(s7_8{1.0078125}, tie_to_even<s7_8>(1.005859375)));
+        static_assert(identical(s7_8{-1.}, tie_to_even<s7_8>(-1.001953125)));
+        static_assert(identical(cnl::_impl::from_rep<cents>(cnl::int64{12}), tie_to_even<cents>(.125)));
+
+        using elastic_input = cnl::scaled_integer<cnl::elastic_integer<20>, cnl::power<-4>>;
+        using elastic_result = cnl::scaled_integer<cnl::elastic_integer<20>, cnl::power<-1>>;
+        static_assert(identical(elastic_result{1.}, tie_to_even<elastic_result>(elastic_input{1.25})));
+        static_assert(identical(elastic_result{2.}, tie_to_even<elastic_result>(elastic_input{1.75})));
+        static_assert(identical(elastic_result{-1.}, tie_to_even<elastic_result>(elastic_input{-1.25})));
+    }
 }
@@ -0,0 +1,196 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl::stochastic_rounding_tag
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/rounding.h>
+#include <cnl/rounding_integer.h>
+#include <cnl/scaled_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+namespace {
+    using cnl::_impl::identical;
+
+    using s15_16 = cnl::scaled_integer<cnl::int32, cnl::power<-16>>;
+    using s7_8 = cnl::scaled_integer<cnl::int16, cnl::power<-8>>;
+
+    template<typename Destination, typename Source>
+    constexpr auto stochastic_convert(Source const& from, cnl::uint64 bits)
+    {
+        return cnl::custom_operator<
+                cnl::_impl::convert_op,
+                cnl::op_value<Source, cnl::_impl::native_tag>,
+                cnl::op_value<Destination, cnl::stochastic_rounding_tag>>{}(from, bits);
+    }
+
+    constexpr auto min_bits = cnl::uint64{0};
+    constexpr auto max_bits = ~min_bits;
+
+    namespace test_bits {
+        static_assert(
+                cnl::_impl::stochastic_rounding_bits(0, 0)
+                != cnl::_impl::stochastic_rounding_bits(0, 1));
+        static_assert(
+                cnl::_impl::stochastic_rounding_bits(0, 0)
+                != cnl::_impl::stochastic_rounding_bits(1, 0));
+        static_assert(identical(0., cnl::_impl::stochastic_rounding_fraction<double>(min_bits)));
+        static_assert(cnl::_impl::stochastic_rounding_fraction<double>(max_bits) < 1.);
+        static_assert(cnl::_impl::stochastic_rounding_fraction<float>(max_bits) < 1.F);
+    }
+
+    namespace test_convert_native {
+        static_assert(identical(2, stochastic_convert<int>(2.25, min_bits)));
+        static_assert(identical(3, stochastic_convert<int>(2.25, max_bits)));
+        static_assert(identical(-3, stochastic_convert<int>(-2.25, min_bits)));
+        static_assert(identical(-2, stochastic_convert<int>(-2.25, max_bits)));
+        static_assert(identical(7, stochastic_convert<int>(7., max_bits)));
+        static_assert(identical(7L, stochastic_convert<long>(7, max_bits)));
+    }
+
+    namespace test_convert_scaled_integer {
+        static_assert(identical(
+                s7_8{-127.5},
+                stochastic_convert<s7_8>(s15_16{-127.498046875}, min_bits)));
+        static_assert(identical(
+                s7_8{-127.49609375},
+                stochastic_convert<s7_8>(s15_16{-127.498046875}, max_bits)));
+        static_assert(identical(
+                s7_8{.5},
+                stochastic_convert<s7_8>(s15_16{.5}, max_bits)));
+        static_assert(identical(
+                cnl::scaled_integer<unsigned, cnl::power<-1>>{1.},
+                stochastic_convert<cnl::scaled_integer<unsigned, cnl::power<-1>>>(
+                        cnl::scaled_integer<unsigned, cnl::power<-4>>{1.25}, min_bits)));
+        static_assert(identical(
+                cnl::scaled_integer<unsigned, cnl::power<-1>>{1.5},
+                stochastic_convert<cnl::scaled_integer<unsigned, cnl::power<-1>>>(
+                        cnl::scaled_integer<unsigned, cnl::power<-4>>{1.25}, max_bits)));
+        static_assert(identical(
+                cnl::scaled_integer<long long, cnl::power<-1, 10>>{-1.3},
+                stochastic_convert<cnl::scaled_integer<long long, cnl::power<-1, 10>>>(
+                        cnl::scaled_integer<long long, cnl::power<-2, 10>>{-1.25}, min_bits)));
+        static_assert(identical(
+                cnl::scaled_integer<long long, cnl::power<-1, 10>>{-1.2},
+                stochastic_convert<cnl::scaled_integer<long long, cnl::power<-1, 10>>>(
+                        cnl::scaled_integer<long long, cnl::power<-2, 10>>{-1.25}, max_bits)));
+        static_assert(identical(
+                s7_8{-1.25},
+                stochastic_convert<s7_8>(-1.25, max_bits)));
+        static_assert(identical(
+                s7_8{-0.00390625},
+                stochastic_convert<s7_8>(-0.001, min_bits)));
+        static_assert(identical(
+                s7_8{0.},
+                stochastic_convert<s7_8>(-0.001, max_bits)));
+        static_assert(identical(
+                2,
+                stochastic_convert<int>(s15_16{2.5}, min_bits)));
+        static_assert(identical(
+                3,
+                stochastic_convert<int>(s15_16{2.5}, max_bits)));
+    }
+
+    namespace test_divide {
+        static_assert(identical(
+                2,
+                cnl::custom_operator<
+                        cnl::_impl::divide_op,
+                        cnl::op_value<int, cnl::stochastic_rounding_tag>,
+                        cnl::op_value<int, cnl::stochastic_rounding_tag>>{}(9, 4, 1)));
+        static_assert(identical(
+                3,
+                cnl::custom_operator<
+                        cnl::_impl::divide_op,
+                        cnl::op_value<int, cnl::stochastic_rounding_tag>,
+                        cnl::op_value<int, cnl::stochastic_rounding_tag>>{}(9, 4, 0)));
+        static_assert(identical(
+                -3,
+                cnl::custom_operator<
+                        cnl::_impl::divide_op,
+                        cnl::op_value<int, cnl::stochastic_rounding_tag>,
+                        cnl::op_value<int, cnl::stochastic_rounding_tag>>{}(9, -4, 0)));
+        static_assert(identical(
+                -2,
+                cnl::custom_operator<
+                        cnl::_impl::divide_op,
+                        cnl::op_value<int, cnl::stochastic_rounding_tag>,
+                        cnl::op_value<int, cnl::stochastic_rounding_tag>>{}(-8, 4, 0)));
+    }
+
+    TEST(stochastic_rounding, reproducible)  // NOLINT
+    {
+        auto const input = s15_16{1.001};
+
+        cnl::seed_stochastic_rounding(42);
+        auto expected = std::array<s7_8, 64>{};
+        for (auto& element : expected) {
+            element = cnl::convert<cnl::stochastic_rounding_tag, cnl::_impl::native_tag, s7_8>(input);
+        }
+
+        cnl::seed_stochastic_rounding(42);
+        for (auto const& element : expected) {
+            ASSERT_EQ(element, (cnl::convert<cnl::stochastic_rounding_tag, cnl::_impl::native_tag, s7_8>(input)));
+        }
+    }
+
+    TEST(stochastic_rounding, bulk_matches_scalar)  // NOLINT
+    {
+        auto input = std::array<s15_16, 64>{};
+        for (auto index = 0; index != int(input.size()); ++index) {
+            input[std::size_t(index)] = cnl::_impl::from_rep<s15_16>(index * 0x3b9d - 0x7f7f7f);
+        }
+
+        cnl::seed_stochastic_rounding(7);
+        auto expected = std::array<s7_8, 64>{};
+        for (auto index = std::size_t{}; index != input.size(); ++index) {
+            expected[index] = cnl::convert<cnl::stochastic_rounding_tag, cnl::_impl::native_tag, s7_8>(input[index]);
+        }
+
+        cnl::seed_stochastic_rounding(7);
+        auto actual = std::array<s7_8, 64>{};
+        auto const end = cnl::stochastic_convert(std::begin(input), std::end(input), std::begin(actual));
+        ASSERT_EQ(std::end(actual), end);
+        ASSERT_EQ(expected, actual);
+    }
+
+    TEST(stochastic_rounding, unbiased)  // NOLINT
+    {
+        // a quarter of a result LSB below -3
+        auto const input = cnl::scaled_integer<int, cnl::power<-4>>{-3.0625};
+
+        cnl::seed_stochastic_rounding(0);
+        auto sum = 0;
+        constexpr auto num_samples = 1 << 16;
+        for (auto sample = 0; sample != num_samples; ++sample) {
+            sum += cnl::_impl::to_rep(cnl::convert<
+                                      cnl::stochastic_rounding_tag, cnl::_impl::native_tag,
+                                      cnl::scaled_integer<int, cnl::power<-2>>>(input));
+        }
+
+        // mean of the results, in units of the input LSB, should be close to -49
+        auto const mean = double(sum) * 4. / num_samples;
+        ASSERT_NEAR(-49., mean, .05);
+    }
+
+    TEST(stochastic_rounding, rounding_integer_divide)  // NOLINT
+    {
+        using rounding_integer = cnl::rounding_integer<int, cnl::stochastic_rounding_tag>;
+
+        cnl::seed_stochastic_rounding(0);
+        auto sum = 0;
+        constexpr auto num_samples = 1 << 16;
+        for (auto sample = 0; sample != num_samples; ++sample) {
+            sum += cnl::_impl::to_rep(rounding_integer{10} / rounding_integer{4});
+        }
+
+        auto const mean = double(sum) / num_samples;
+        ASSERT_NEAR(2.5, mean, .05);
+    }
+}
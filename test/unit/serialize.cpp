@@ -0,0 +1,226 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief tests of cnl::serialize and cnl::deserialize
+
+#include <cnl/_impl/type_traits/identical.h>
+#include <cnl/elastic_integer.h>
+#include <cnl/fraction.h>
+#include <cnl/scaled_integer.h>
+#include <cnl/serialize.h>
+#include <cnl/wide_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <system_error>
+#include <vector>
+
+using cnl::_impl::identical;
+
+namespace {
+    using q15 = cnl::scaled_integer<cnl::int16, cnl::power<-15>>;
+    using elastic12 = cnl::elastic_integer<12>;
+    using wide100 = cnl::wide_integer<100>;
+
+    template<typename... Bytes>
+    constexpr auto bytes(Bytes... b)
+    {
+        return std::array<std::byte, sizeof...(Bytes)>{std::byte(b)...};
+    }
+
+    template<typename Encoding = cnl::fixed_width_encoding_tag, typename T>
+    constexpr auto round_trip(T const& value)
+    {
+        auto buffer = std::array<std::byte, cnl::serialized_size<T, Encoding>>{};
+        auto const written = cnl::serialize<Encoding>(buffer, value);
+        auto result = T{0};
+        auto const read = cnl::deserialize<Encoding>(
+                std::span<std::byte const>(buffer.data(), written.ptr), result);
+        return (written.ec == std::errc{} && read.ec == std::errc{} && read.ptr == written.ptr)
+                     ? result
+                     : T{0};
+    }
+
+    template<typename Encoding = cnl::fixed_width_encoding_tag, typename T>
+    auto serialized(T const& value)
+    {
+        auto buffer = std::vector<std::byte>(cnl::serialized_size<T, Encoding>);
+        auto const result = cnl::serialize<Encoding>(buffer, value);
+        buffer.resize(result.ptr - buffer.data());
+        return buffer;
+    }
+
+    template<typename Array>
+    auto as_vector(Array const& a)
+    {
+        return std::vector<std::byte>(a.begin(), a.end());
+    }
+
+    namespace test_serialized_size {
+        static_assert(cnl::serialized_size<cnl::int8> == 1);
+        static_assert(cnl::serialized_size<cnl::uint32> == 4);
+        static_assert(cnl::serialized_size<q15> == 2);
+        static_assert(cnl::serialized_size<elastic12> == 2);
+        static_assert(cnl::serialized_size<cnl::elastic_integer<16>> == 3);
+        static_assert(cnl::serialized_size<wide100> == 13);
+        static_assert(cnl::serialized_size<cnl::fraction<cnl::int16, cnl::uint8>> == 3);
+
+        static_assert(cnl::serialized_size<cnl::int32, cnl::varint_encoding_tag> == 5);
+        static_assert(cnl::serialized_size<cnl::uint64, cnl::varint_encoding_tag> == 10);
+
+        static_assert(!cnl::serializable<float>);
+        static_assert(!cnl::serializable<std::vector<int>>);
+    }
+
+    namespace test_fixed_width {
+        static_assert(identical(cnl::int32{-123456}, round_trip(cnl::int32{-123456})));
+        static_assert(identical(q15{-.75}, round_trip(q15{-.75})));
+        static_assert(identical(elastic12{-2048}, round_trip(elastic12{-2048})));
+        static_assert(identical(
+                cnl::elastic_integer<12, unsigned>{4095},
+                round_trip(cnl::elastic_integer<12, unsigned>{4095})));
+
+        TEST(serialize, little_endian)  // NOLINT
+        {
+            EXPECT_EQ(as_vector(bytes(0x04, 0x03, 0x02, 0x01)), serialized(cnl::int32{0x01020304}));
+            EXPECT_EQ(as_vector(bytes(0x00, 0xc0)), serialized(q15{-.5}));
+            EXPECT_EQ(as_vector(bytes(0xfe, 0xff)), serialized(elastic12{-2}));
+            EXPECT_EQ(as_vector(bytes(0x80, 0x00, 0x00)), serialized(cnl::elastic_integer<16>{128}));
+        }
+
+        TEST(serialize, wide_integer)  // NOLINT
+        {
+            auto const big = wide100{1} << 96;
+            EXPECT_EQ(
+                    as_vector(bytes(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01)), serialized(big));
+            EXPECT_EQ(big, round_trip(big));
+            EXPECT_EQ(-big + 12345, round_trip(-big + 12345));
+            EXPECT_EQ(wide100{-1}, round_trip(wide100{-1}));
+        }
+
+        TEST(serialize, fraction)  // NOLINT
+        {
+            auto const f = cnl::fraction<cnl::int16, cnl::uint8>{-3, 7};
+            EXPECT_EQ(as_vector(bytes(0xfd, 0xff, 0x07)), serialized(f));
+            auto const result = round_trip(f);
+            EXPECT_EQ(f.numerator, result.numerator);
+            EXPECT_EQ(f.denominator, result.denominator);
+        }
+
+        TEST(serialize, out_of_range)  // NOLINT
+        {
+            // 0x1000 needs 14 bits; elastic_integer<12> has 13
+            auto const in = bytes(0x00, 0x10);
+            auto value = elastic12{7};
+            auto const result = cnl::deserialize(in, value);
+            EXPECT_EQ(std::errc::result_out_of_range, result.ec);
+            EXPECT_EQ(elastic12{7}, value);
+        }
+
+        TEST(serialize, too_small)  // NOLINT
+        {
+            auto out = std::array<std::byte, 3>{};
+            EXPECT_EQ(std::errc::value_too_large, cnl::serialize(out, cnl::int32{1}).ec);
+
+            auto value = cnl::int32{};
+            EXPECT_EQ(std::errc::invalid_argument, cnl::deserialize(out, value).ec);
+        }
+    }
+
+    namespace test_varint {
+        using varint = cnl::varint_encoding_tag;
+
+        static_assert(identical(cnl::int64{-1234567890123}, round_trip<varint>(cnl::int64{-1234567890123})));
+        static_assert(identical(q15{-1.}, round_trip<varint>(q15{-1.})));
+
+        TEST(serialize, varint)  // NOLINT
+        {
+            EXPECT_EQ(as_vector(bytes(0x00)), serialized<varint>(cnl::int32{0}));
+            EXPECT_EQ(as_vector(bytes(0x01)), serialized<varint>(cnl::int32{-1}));
+            EXPECT_EQ(as_vector(bytes(0x02)), serialized<varint>(cnl::int32{1}));
+            EXPECT_EQ(as_vector(bytes(0xac, 0x02)), serialized<varint>(cnl::uint32{300}));
+            EXPECT_EQ(
+                    as_vector(bytes(0xff, 0xff, 0xff, 0xff, 0x0f)),
+                    serialized<varint>(cnl::int32{-2147483648}));
+        }
+
+        TEST(serialize, varint_wide_integer)  // NOLINT
+        {
+            auto const big = -(wide100{1} << 90) + 5;
+            EXPECT_EQ(big, round_trip<varint>(big));
+            EXPECT_EQ(2U, serialized<varint>(wide100{-100}).size());
+        }
+
+        TEST(serialize, varint_errors)  // NOLINT
+        {
+            auto value = cnl::uint8{};
+            EXPECT_EQ(std::errc::invalid_argument, cnl::deserialize<varint>(bytes(0x80), value).ec);
+            EXPECT_EQ(
+                    std::errc::result_out_of_range,
+                    cnl::deserialize<varint>(bytes(0x80, 0x02), value).ec);
+            EXPECT_EQ(std::errc{}, cnl::deserialize<varint>(bytes(0xff, 0x01), value).ec);
+            EXPECT_EQ(255, value);
+
+            auto small = cnl::elastic_integer<4>{};
+            EXPECT_EQ(
+                    std::errc::result_out_of_range,
+                    cnl::deserialize<varint>(bytes(0x40), small).ec);
+        }
+    }
+
+    namespace test_bulk {
+        TEST(serialize, bulk_memcpy)  // NOLINT
+        {
+            auto const values = std::vector<q15>{q15{-1.}, q15{-.5}, q15{0.}, q15{.5}};
+            auto buffer = std::vector<std::byte>(values.size() * cnl::serialized_size<q15>);
+            auto const written = cnl::serialize(buffer, values);
+            ASSERT_EQ(std::errc{}, written.ec);
+            EXPECT_EQ(buffer.data() + buffer.size(), written.ptr);
+            EXPECT_EQ(
+                    as_vector(bytes(0x00, 0x80, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x40)), buffer);
+
+            auto result = std::vector<q15>(values.size());
+            EXPECT_EQ(std::errc{}, cnl::deserialize(buffer, result).ec);
+            EXPECT_EQ(values, result);
+
+            EXPECT_EQ(
+                    std::errc::value_too_large,
+                    cnl::serialize(std::span(buffer).first(7), values).ec);
+        }
+
+        TEST(serialize, bulk_elements)  // NOLINT
+        {
+            auto values = std::array<elastic12, 100>{};
+            for (auto i = 0; i != 100; ++i) {
+                values[i] = elastic12{i * 41 - 2048};
+            }
+
+            auto buffer = std::vector<std::byte>(values.size() * cnl::serialized_size<elastic12>);
+            ASSERT_EQ(std::errc{}, cnl::serialize(buffer, values).ec);
+            auto result = std::array<elastic12, 100>{};
+            ASSERT_EQ(std::errc{}, cnl::deserialize(buffer, result).ec);
+            EXPECT_EQ(values, result);
+        }
+
+        TEST(serialize, bulk_varint)  // NOLINT
+        {
+            using varint = cnl::varint_encoding_tag;
+            auto const values = std::vector<cnl::int32>{0, -1, 1000000, -64, 63};
+            auto buffer = std::vector<std::byte>(values.size() * cnl::serialized_size<cnl::int32, varint>);
+            auto const written = cnl::serialize<varint>(buffer, values);
+            ASSERT_EQ(std::errc{}, written.ec);
+            EXPECT_EQ(7, written.ptr - buffer.data());
+
+            auto result = std::vector<cnl::int32>(values.size());
+            auto const read = cnl::deserialize<varint>(
+                    std::span<std::byte const>(buffer.data(), written.ptr), result);
+            EXPECT_EQ(std::errc{}, read.ec);
+            EXPECT_EQ(values, result);
+        }
+    }
+}
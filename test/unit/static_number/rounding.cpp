@@ -5,10 +5,12 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #include <cnl/_impl/type_traits/assert_same.h>
+#include <cnl/_impl/type_traits/identical.h>
 #include <cnl/static_number.h>
 
 namespace {
     using cnl::_impl::assert_same;
+    using cnl::_impl::identical;
 
     namespace test_rounding_t {
         static_assert(
@@ -16,4 +18,23 @@ namespace {
                         cnl::nearest_rounding_tag, cnl::rounding_t<cnl::static_number<1>>>::value,
                 "cnl::rounding_t<cnl::static_number<>> test failed");
     }
+
+    namespace test_tie_to_even {
+        template<int Digits, int Exponent>
+        using static_number = cnl::static_number<Digits, Exponent, cnl::tie_to_even_rounding_tag>;
+
+        static_assert(
+                assert_same<
+                        cnl::tie_to_even_rounding_tag, cnl::rounding_t<static_number<1, 0>>>::value,
+                "cnl::rounding_t<cnl::static_number<>> test failed");
+
+        static_assert(identical(static_number<7, -1>{1.}, static_number<7, -1>{static_number<9, -3>{1.125}}));
+        static_assert(identical(static_number<7, -1>{1.5}, static_number<7, -1>{static_number<9, -3>{1.375}}));
+        static_assert(identical(static_number<7, -1>{-1.}, static_number<7, -1>{static_number<9, -3>{-1.125}}));
+        static_assert(identical(static_number<7, -1>{-1.5}, static_number<7, -1>{static_number<9, -3>{-1.375}}));
+        static_assert(identical(static_number<7, -1>{1.}, static_number<7, -1>{static_number<9, -3>{1.25}}));
+        static_assert(identical(static_number<7, -1>{2.}, static_number<7, -1>{static_number<9, -3>{1.75}}));
+        static_assert(identical(static_number<7, -1>{-1.}, static_number<7, -1>{static_number<9, -3>{-1.25}}));
+        static_assert(identical(static_number<7, -1>{-2.}, static_number<7, -1>{static_number<9, -3>{-1.75}}));
+    }
 }
@@ -0,0 +1,122 @@
+//          Copyright John McFarlane 2021.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief catalogue of CNL functions paired with hand-written native equivalents
+///
+/// This file is compiled to assembly, not to a test executable. For each case, a function named
+/// `zero_cost_<case>_cnl` uses CNL and a function named `zero_cost_<case>_native` does the same
+/// with fundamental types. compare_assembly.py checks that the former compiles to no more
+/// instructions than the latter. Both take and return reps so that the calling conventions match.
+
+#include <cnl/all.h>
+
+#include <cstdint>
+#include <limits>
+
+using cnl::_impl::from_rep;
+using cnl::_impl::to_rep;
+
+extern "C" {
+////////////////////////////////////////////////////////////////////////////////
+// scaled_integer
+
+auto zero_cost_scaled_add_cnl(std::int32_t a, std::int32_t b)
+{
+    using fixed = cnl::scaled_integer<std::int32_t, cnl::power<-16>>;
+    return to_rep(from_rep<fixed>(a) + from_rep<fixed>(b));
+}
+
+auto zero_cost_scaled_add_native(std::int32_t a, std::int32_t b)
+{
+    return a + b;
+}
+
+auto zero_cost_scaled_mul_cnl(std::int32_t a, std::int32_t b)
+{
+    using fixed = cnl::scaled_integer<std::int32_t, cnl::power<-16>>;
+    using wide_fixed = cnl::scaled_integer<std::int64_t, cnl::power<-16>>;
+    return to_rep(static_cast<fixed>(wide_fixed{from_rep<fixed>(a)} * from_rep<fixed>(b)));
+}
+
+auto zero_cost_scaled_mul_native(std::int32_t a, std::int32_t b)
+{
+    // scaled_integer conversion truncates toward zero, like integer division
+    return static_cast<std::int32_t>((std::int64_t{a} * b) / 65536);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// elastic_integer
+
+auto zero_cost_elastic_add_cnl(std::int32_t a, std::int32_t b)
+{
+    using integer = cnl::elastic_integer<31>;
+    return to_rep(from_rep<integer>(a) + from_rep<integer>(b));
+}
+
+auto zero_cost_elastic_add_native(std::int32_t a, std::int32_t b)
+{
+    return std::int64_t{a} + b;
+}
+
+auto zero_cost_elastic_mul_cnl(std::int32_t a, std::int32_t b)
+{
+    using integer = cnl::elastic_integer<31>;
+    return to_rep(from_rep<integer>(a) * from_rep<integer>(b));
+}
+
+auto zero_cost_elastic_mul_native(std::int32_t a, std::int32_t b)
+{
+    return std::int64_t{a} * b;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// overflow_integer
+
+auto zero_cost_saturated_add_cnl(std::int32_t a, std::int32_t b)
+{
+    using integer = cnl::overflow_integer<std::int32_t, cnl::saturated_overflow_tag>;
+    return to_rep(static_cast<integer>(from_rep<integer>(a) + from_rep<integer>(b)));
+}
+
+auto zero_cost_saturated_add_native(std::int32_t a, std::int32_t b)
+{
+    auto const sum = std::int64_t{a} + b;
+    return (sum > std::numeric_limits<std::int32_t>::max())   ? std::numeric_limits<std::int32_t>::max()
+         : (sum < std::numeric_limits<std::int32_t>::lowest()) ? std::numeric_limits<std::int32_t>::lowest()
+                                                               : static_cast<std::int32_t>(sum);
+}
+
+auto zero_cost_saturated_mul_cnl(std::int32_t a, std::int32_t b)
+{
+    using integer = cnl::overflow_integer<std::int32_t, cnl::saturated_overflow_tag>;
+    return to_rep(static_cast<integer>(from_rep<integer>(a) * from_rep<integer>(b)));
+}
+
+auto zero_cost_saturated_mul_native(std::int32_t a, std::int32_t b)
+{
+    auto const product = std::int64_t{a} * b;
+    return (product > std::numeric_limits<std::int32_t>::max())   ? std::numeric_limits<std::int32_t>::max()
+         : (product < std::numeric_limits<std::int32_t>::lowest()) ? std::numeric_limits<std::int32_t>::lowest()
+                                                                   : static_cast<std::int32_t>(product);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// rounding_integer
+
+auto zero_cost_nearest_convert_cnl(std::int32_t a)
+{
+    using rounding = cnl::rounding_integer<std::int32_t, cnl::nearest_rounding_tag>;
+    using fixed = cnl::scaled_integer<rounding, cnl::power<-8>>;
+    using integer = cnl::scaled_integer<rounding, cnl::power<0>>;
+    return to_rep(to_rep(static_cast<integer>(from_rep<fixed>(from_rep<rounding>(a)))));
+}
+
+auto zero_cost_nearest_convert_native(std::int32_t a)
+{
+    // rounds half away from zero
+    return (a + 128 + (a >> 31)) >> 8;
+}
+}
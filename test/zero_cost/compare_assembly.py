@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+
+"""Checks that CNL functions compile to no more instructions than their native equivalents.
+
+Reads assembly files generated from cases.cpp and, for each case, counts the instructions in
+functions `zero_cost_<case>_cnl` and `zero_cost_<case>_native`. A case fails if the CNL
+function has more instructions than the native function plus the overhead allowed below.
+"""
+
+from argparse import ArgumentParser
+from re import compile as compile_regex
+from sys import exit
+
+# cases which are known not to be zero-cost and the number of extra instructions allowed
+allowed_overhead = {
+    # the unreachable trap for an impossible overflow direction is not eliminated,
+    # and overflow is detected with branches rather than in a wider type
+    "saturated_add": 8,
+    "saturated_mul": 16,
+
+    # rounding is applied by adding or subtracting half before a truncating division
+    # rather than with a bias and an arithmetic shift
+    "nearest_convert": 6,
+}
+
+function_type_pattern = compile_regex(r"^\s*\.type\s+([^,\s]+),\s*[@%]function")
+label_pattern = compile_regex(r"^([^\s:#@]+):")
+size_pattern = compile_regex(r"^\s*\.size\s+([^,\s]+),")
+case_pattern = compile_regex(r"^zero_cost_(.+)_(cnl|native)$")
+
+
+def is_instruction(line):
+    stripped = line.strip()
+    return bool(stripped) and not stripped.startswith((".", "#", "@", "//", ";")) and not label_pattern.match(stripped)
+
+
+def count_instructions(lines):
+    """Returns a dictionary of function name to number of instructions.
+
+    Instructions in out-of-line parts of a function (e.g. `foo.cold`) are counted as part of it."""
+    functions = set()
+    counts = {}
+    current = None
+    for line in lines:
+        match = function_type_pattern.match(line)
+        if match:
+            functions.add(match.group(1))
+            continue
+
+        match = label_pattern.match(line)
+        if match and match.group(1) in functions:
+            current = match.group(1).split(".")[0]
+            counts.setdefault(current, 0)
+            continue
+
+        if size_pattern.match(line):
+            current = None
+            continue
+
+        if current and is_instruction(line):
+            counts[current] += 1
+    return counts
+
+
+def check_assembly(path):
+    """Prints a comparison of each case in the given assembly file; returns the number of failures."""
+    with open(path) as file:
+        counts = count_instructions(file.readlines())
+
+    cases = {}
+    for name, count in counts.items():
+        match = case_pattern.match(name)
+        if match:
+            case, variant = match.groups()
+            cases.setdefault(case, {})[variant] = count
+
+    print(path)
+    failures = 0
+    for case, variants in sorted(cases.items()):
+        if set(variants) != {"cnl", "native"}:
+            print("  {:<24} missing a cnl or native function".format(case))
+            failures += 1
+            continue
+
+        overhead = variants["cnl"] - variants["native"]
+        allowed = allowed_overhead.get(case, 0)
+        failed = overhead > allowed
+        failures += failed
+        print("  {:<24} native {:>3}  cnl {:>3}  overhead {:>+3} (allowed {:>+3}){}".format(
+            case, variants["native"], variants["cnl"], overhead, allowed, "  FAILED" if failed else ""))
+    return failures
+
+
+if __name__ == "__main__":
+    parser = ArgumentParser(description="Compare the instruction counts of CNL functions and their native equivalents.")
+    parser.add_argument("assembly", nargs="+", help="assembly files generated from cases.cpp")
+    args = parser.parse_args()
+
+    failures = sum(check_assembly(path) for path in args.assembly)
+    exit(1 if failures else 0)